@@ -8,6 +8,7 @@
 
 #include "../hypro/config.h"
 #include "../hypro/datastructures/hybridAutomata/LocationManager.h"
+#include "../hypro/datastructures/hybridAutomata/TransitionManager.h"
 #include "../hypro/datastructures/hybridAutomata/Transition.h"
 #include "../hypro/datastructures/hybridAutomata/HybridAutomaton.h"
 #include "../hypro/datastructures/Point.h"
@@ -35,7 +36,7 @@ int main(int argc, char const *argv[])
 
 	//Hybrid Automaton Objects: Locations, Transitions, Automaton itself
 	Location<Number>* loc1 = lManager.create();
-	hypro::Transition<Number>* trans = new hypro::Transition<Number>();
+	hypro::Transition<Number>* trans = hypro::TransitionManager<Number>::getInstance().create();
 	HybridAutomaton<Number, Representation> hybrid = HybridAutomaton<Number, Representation>();
 
 	//Other Objects: Vectors, Matrices, Guards...
@@ -6,6 +6,7 @@
 
 #include "config.h"
 #include "datastructures/hybridAutomata/LocationManager.h"
+#include "datastructures/hybridAutomata/TransitionManager.h"
 #include "datastructures/hybridAutomata/Transition.h"
 #include "datastructures/hybridAutomata/HybridAutomaton.h"
 #include "datastructures/Point.h"
@@ -27,7 +28,7 @@ int main()
 
 	// create the discrete structure of the automaton and the automaton itself.
 	Location<Number>* loc1 = lManager.create();
-	hypro::Transition<Number>* trans = new hypro::Transition<Number>();
+	hypro::Transition<Number>* trans = hypro::TransitionManager<Number>::getInstance().create();
 	HybridAutomaton<Number> bBallAutomaton = HybridAutomaton<Number>();
 
 	// matrix defining the flow (note: 3rd dimension for constant parts).
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../../config.h"
+#include "../../datastructures/Point.h"
+#include "../../datastructures/Halfspace.h"
+#include <bitset>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for vertex enumeration of H-polyhedra by the incremental double description method.
+ * @details    The polyhedron Ax <= b is homogenized to the cone {(x,t) | Ax - bt <= 0, t >= 0}, whose extreme rays are
+ * computed by adding one constraint at a time to an initial simplicial cone. Adjacency of rays is decided by the
+ * combinatorial test on their sets of tight constraints, such that the running time depends on the number of
+ * intermediate rays instead of the number of d-subsets of constraints. Rays with t > 0 are the vertices, rays with
+ * t = 0 span the recession cone. For exact number types all sign tests are exact, for floating point numbers a tolerance
+ * is used.
+ * @tparam     Number  The used number type.
+ */
+template<typename Number>
+class DoubleDescription {
+	private:
+		using ZeroSet = std::vector<std::uint64_t>;
+
+		struct Ray {
+			vector_t<Number> direction;
+			ZeroSet zeroSet; // indices of the processed constraints which are tight for this ray
+		};
+
+		matrix_t<Number> mConstraints;			// homogenized and normalized constraints, last row is -t <= 0
+		std::vector<Point<Number>> mPoints;
+		std::vector<vector_t<Number>> mCones;
+		bool mLineality = false;
+
+	public:
+		DoubleDescription() = default;
+		DoubleDescription(const DoubleDescription<Number>& _orig) = default;
+		DoubleDescription(const matrix_t<Number>& constraints, const vector_t<Number>& constants);
+		DoubleDescription(const std::vector<Halfspace<Number>>& hsv);
+		~DoubleDescription() = default;
+
+		/**
+		 * @brief      Computes the vertices and the recession directions.
+		 */
+		void enumerateVertices();
+
+		std::vector<Point<Number>> getPoints() const { return mPoints; }
+		std::vector<vector_t<Number>> getCones() const { return mCones; }
+
+		/**
+		 * @brief      Returns true, if the polyhedron contains a line. In this case no vertices exist.
+		 */
+		bool hasLineality() const { return mLineality; }
+
+	private:
+		void initialize(const matrix_t<Number>& constraints, const vector_t<Number>& constants);
+		bool initialCone(std::vector<Ray>& rays, std::vector<bool>& processed) const;
+		void addConstraint(std::vector<Ray>& rays, unsigned index) const;
+		bool adjacent(const std::vector<Ray>& rays, std::size_t lhs, std::size_t rhs) const;
+
+		static void normalize(vector_t<Number>& vec);
+		static void setBit(ZeroSet& set, unsigned index) { set[index / 64] |= (std::uint64_t(1) << (index % 64)); }
+
+		template<typename N = Number, carl::DisableIf< std::is_same<N,double> > = carl::dummy>
+		static int sign(const Number& val) {
+			return val > 0 ? 1 : (val < 0 ? -1 : 0);
+		}
+
+		template<typename N = Number, carl::EnableIf< std::is_same<N,double> > = carl::dummy>
+		static int sign(const Number& val) {
+			// rays and constraints are normalized, thus an absolute tolerance suffices.
+			return std::abs(val) <= VERTEX_ENUMERATION_TOLERANCE ? 0 : (val > 0 ? 1 : -1);
+		}
+};
+
+} // namespace hypro
+
+#include "DoubleDescription.tpp"
@@ -0,0 +1,231 @@
+#include "DoubleDescription.h"
+
+namespace hypro {
+
+	template<typename Number>
+	DoubleDescription<Number>::DoubleDescription(const matrix_t<Number>& constraints, const vector_t<Number>& constants) {
+		initialize(constraints, constants);
+	}
+
+	template<typename Number>
+	DoubleDescription<Number>::DoubleDescription(const std::vector<Halfspace<Number>>& hsv) {
+		if(hsv.empty()) {
+			return;
+		}
+		matrix_t<Number> constraints = matrix_t<Number>(hsv.size(), hsv.begin()->dimension());
+		vector_t<Number> constants = vector_t<Number>(hsv.size());
+		for(unsigned rowIndex = 0; rowIndex < hsv.size(); ++rowIndex) {
+			constraints.row(rowIndex) = hsv[rowIndex].normal().transpose();
+			constants(rowIndex) = hsv[rowIndex].offset();
+		}
+		initialize(constraints, constants);
+	}
+
+	template<typename Number>
+	void DoubleDescription<Number>::initialize(const matrix_t<Number>& constraints, const vector_t<Number>& constants) {
+		assert(constraints.rows() == constants.rows());
+		unsigned dim = constraints.cols();
+		// homogenize and normalize, duplicate constraints are detected in linear time by hashing.
+		vector_t<Number> nonNegative = vector_t<Number>::Zero(dim+1);
+		nonNegative(dim) = Number(-1);
+		std::unordered_set<vector_t<Number>> known;
+		known.insert(nonNegative);
+		std::vector<vector_t<Number>> rows;
+		for(unsigned rowIndex = 0; rowIndex < constraints.rows(); ++rowIndex) {
+			vector_t<Number> row = vector_t<Number>(dim+1);
+			row.head(dim) = constraints.row(rowIndex).transpose();
+			row(dim) = -constants(rowIndex);
+			normalize(row);
+			if(known.insert(row).second) {
+				rows.emplace_back(std::move(row));
+			}
+		}
+		// t >= 0 is always the last constraint.
+		rows.emplace_back(std::move(nonNegative));
+
+		mConstraints = matrix_t<Number>(rows.size(), dim+1);
+		for(unsigned rowIndex = 0; rowIndex < rows.size(); ++rowIndex) {
+			mConstraints.row(rowIndex) = rows[rowIndex].transpose();
+		}
+	}
+
+	template<typename Number>
+	void DoubleDescription<Number>::normalize(vector_t<Number>& vec) {
+		Number maxEntry = 0;
+		for(unsigned index = 0; index < vec.rows(); ++index) {
+			Number absEntry = carl::abs(vec(index));
+			maxEntry = absEntry > maxEntry ? absEntry : maxEntry;
+		}
+		if(maxEntry != 0) {
+			vec /= maxEntry;
+		}
+	}
+
+	template<typename Number>
+	bool DoubleDescription<Number>::initialCone(std::vector<Ray>& rays, std::vector<bool>& processed) const {
+		unsigned coneDim = mConstraints.cols();
+		// greedily select linearly independent constraints, starting with t >= 0.
+		std::vector<unsigned> basis;
+		basis.push_back(mConstraints.rows()-1);
+		matrix_t<Number> selected = mConstraints.row(mConstraints.rows()-1);
+		for(unsigned rowIndex = 0; rowIndex+1 < mConstraints.rows() && basis.size() < coneDim; ++rowIndex) {
+			matrix_t<Number> candidate = matrix_t<Number>(selected.rows()+1, coneDim);
+			candidate << selected, mConstraints.row(rowIndex);
+			if(unsigned(candidate.fullPivLu().rank()) == candidate.rows()) {
+				selected = candidate;
+				basis.push_back(rowIndex);
+			}
+		}
+		if(basis.size() < coneDim) {
+			// the cone is not pointed.
+			return false;
+		}
+
+		// the rays of the simplicial cone {y | H_B y <= 0} are the columns of -H_B^-1.
+		matrix_t<Number> rayMatrix = selected.fullPivLu().inverse();
+		rayMatrix = -rayMatrix;
+		std::size_t words = (mConstraints.rows() + 63) / 64;
+		for(unsigned colIndex = 0; colIndex < coneDim; ++colIndex) {
+			Ray ray;
+			ray.direction = rayMatrix.col(colIndex);
+			normalize(ray.direction);
+			ray.zeroSet = ZeroSet(words, 0);
+			for(unsigned basisIndex = 0; basisIndex < basis.size(); ++basisIndex) {
+				if(basisIndex != colIndex) {
+					setBit(ray.zeroSet, basis[basisIndex]);
+				}
+			}
+			rays.emplace_back(std::move(ray));
+		}
+		for(auto index : basis) {
+			processed[index] = true;
+		}
+		return true;
+	}
+
+	template<typename Number>
+	bool DoubleDescription<Number>::adjacent(const std::vector<Ray>& rays, std::size_t lhs, std::size_t rhs) const {
+		ZeroSet common(rays[lhs].zeroSet.size());
+		std::size_t commonCount = 0;
+		for(std::size_t word = 0; word < common.size(); ++word) {
+			common[word] = rays[lhs].zeroSet[word] & rays[rhs].zeroSet[word];
+			commonCount += std::bitset<64>(common[word]).count();
+		}
+		// adjacent rays share at least coneDim-2 tight constraints.
+		if(commonCount + 2 < std::size_t(mConstraints.cols())) {
+			return false;
+		}
+		// combinatorial test: no other ray is tight at all common constraints.
+		for(std::size_t other = 0; other < rays.size(); ++other) {
+			if(other == lhs || other == rhs) {
+				continue;
+			}
+			bool superset = true;
+			for(std::size_t word = 0; word < common.size(); ++word) {
+				if((common[word] & rays[other].zeroSet[word]) != common[word]) {
+					superset = false;
+					break;
+				}
+			}
+			if(superset) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename Number>
+	void DoubleDescription<Number>::addConstraint(std::vector<Ray>& rays, unsigned index) const {
+		std::vector<Number> values(rays.size());
+		std::vector<std::size_t> positive;
+		std::vector<std::size_t> negative;
+		std::vector<std::size_t> zero;
+		for(std::size_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex) {
+			values[rayIndex] = mConstraints.row(index).dot(rays[rayIndex].direction);
+			switch(sign(values[rayIndex])) {
+				case 1: positive.push_back(rayIndex); break;
+				case -1: negative.push_back(rayIndex); break;
+				default: zero.push_back(rayIndex);
+			}
+		}
+
+		for(auto rayIndex : zero) {
+			setBit(rays[rayIndex].zeroSet, index);
+		}
+		if(positive.empty()) {
+			return;
+		}
+
+		// combine adjacent pairs of rays on different sides of the new hyperplane.
+		std::vector<Ray> newRays;
+		for(auto pos : positive) {
+			for(auto neg : negative) {
+				if(!adjacent(rays, pos, neg)) {
+					continue;
+				}
+				Ray ray;
+				ray.direction = values[pos] * rays[neg].direction - values[neg] * rays[pos].direction;
+				normalize(ray.direction);
+				ray.zeroSet = ZeroSet(rays[pos].zeroSet.size());
+				for(std::size_t word = 0; word < ray.zeroSet.size(); ++word) {
+					ray.zeroSet[word] = rays[pos].zeroSet[word] & rays[neg].zeroSet[word];
+				}
+				setBit(ray.zeroSet, index);
+				newRays.emplace_back(std::move(ray));
+			}
+		}
+
+		// remove rays violating the new constraint.
+		std::vector<Ray> remaining;
+		remaining.reserve(rays.size() - positive.size() + newRays.size());
+		for(std::size_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex) {
+			if(sign(values[rayIndex]) <= 0) {
+				remaining.emplace_back(std::move(rays[rayIndex]));
+			}
+		}
+		std::move(newRays.begin(), newRays.end(), std::back_inserter(remaining));
+		rays = std::move(remaining);
+	}
+
+	template<typename Number>
+	void DoubleDescription<Number>::enumerateVertices() {
+		mPoints.clear();
+		mCones.clear();
+		mLineality = false;
+		if(mConstraints.rows() == 0) {
+			return;
+		}
+
+		std::vector<Ray> rays;
+		std::vector<bool> processed(mConstraints.rows(), false);
+		if(!initialCone(rays, processed)) {
+			mLineality = true;
+			return;
+		}
+
+		for(unsigned rowIndex = 0; rowIndex < mConstraints.rows() && !rays.empty(); ++rowIndex) {
+			if(!processed[rowIndex]) {
+				addConstraint(rays, rowIndex);
+			}
+		}
+
+		unsigned dim = mConstraints.cols()-1;
+		std::unordered_set<vector_t<Number>> vertices;
+		for(const auto& ray : rays) {
+			if(sign(ray.direction(dim)) > 0) {
+				vector_t<Number> vertex = ray.direction.head(dim) / ray.direction(dim);
+				if(vertices.insert(vertex).second) {
+					mPoints.emplace_back(std::move(vertex));
+				}
+			} else {
+				mCones.emplace_back(ray.direction.head(dim));
+			}
+		}
+		if(mPoints.empty()) {
+			// the polyhedron is empty.
+			mCones.clear();
+		}
+		TRACE("hypro.vertexEnumeration","Enumerated " << mPoints.size() << " vertices and " << mCones.size() << " recession directions.");
+	}
+
+} // namespace hypro
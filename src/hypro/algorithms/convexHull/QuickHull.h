@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../../config.h"
+#include "../../datastructures/Point.h"
+#include "../../datastructures/PointHashSet.h"
+#include "../../datastructures/Halfspace.h"
+#ifdef HYPRO_USE_MULTITHREADING
+#include "../../util/multithreading/ThreadPool.h"
+#include <future>
+#endif
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for facet enumeration of V-polytopes by the Quickhull algorithm.
+ * @details    The hull is maintained as a simplicial complex whose simplices are stored by index in a contiguous arena.
+ * Each simplex holds the indices of its vertices, of its neighbors, where the i-th neighbor shares all vertices except
+ * the i-th one, and an index range into a common buffer of conflict points, i.e. points strictly above the simplex. In
+ * each step the furthest conflict point of a simplex is added, the visible simplices are replaced by a cone over the
+ * horizon and their conflict points are partitioned among the new simplices - for large conflict sets in parallel.
+ * Visibility is decided exactly: for rational numbers directly, for floating point numbers by a filter which falls
+ * back to rational arithmetic close to the hyperplane. In the end coplanar simplices are merged into facets.
+ * @tparam     Number  The used number type.
+ */
+template<typename Number>
+class QuickHull {
+	private:
+		struct Simplex {
+			std::vector<std::size_t> vertices;
+			std::vector<std::size_t> neighbors;		// neighbors[i] is the simplex opposite to vertices[i]
+			vector_t<Number> normal;
+			Number offset;
+			Number filterScale;						// bound on the magnitude of the hyperplane coefficients
+			std::size_t conflictBegin = 0;
+			std::size_t conflictEnd = 0;
+			std::size_t furthest = 0;
+			std::size_t visit = 0;
+			bool visible = false;
+			bool alive = true;
+		};
+
+		std::vector<vector_t<Number>> mPoints;
+		std::vector<Simplex> mSimplices;
+		std::vector<std::size_t> mFreeSimplices;
+		std::vector<std::size_t> mConflicts;
+		std::size_t mLiveConflicts = 0;
+		std::size_t mEpoch = 0;
+		vector_t<Number> mInterior;
+		vector_t<mpq_class> mExactInterior;
+		Number mMaxCoordinate = 0;
+		std::size_t mDimension = 0;
+
+		std::vector<Halfspace<Number>> mHsv;
+		std::vector<Point<Number>> mVertices;
+		std::map<Point<Number>, std::set<Point<Number>>> mNeighborhood;
+		bool mFullDimensional = false;
+
+	public:
+		QuickHull() = default;
+		QuickHull(const QuickHull<Number>& _orig) = default;
+		QuickHull(const std::vector<Point<Number>>& points);
+		~QuickHull() = default;
+
+		/**
+		 * @brief      Computes the facets, the vertices and the neighborhood of the vertices of the convex hull.
+		 */
+		void compute();
+
+		std::vector<Halfspace<Number>> getHsv() const { return mHsv; }
+		std::vector<Point<Number>> getVertices() const { return mVertices; }
+		std::map<Point<Number>, std::set<Point<Number>>> getNeighborhood() const { return mNeighborhood; }
+
+		/**
+		 * @brief      Returns false, if the points do not span the whole space. In this case no facets are computed.
+		 */
+		bool isFullDimensional() const { return mFullDimensional; }
+
+	private:
+		bool initialSimplex();
+		std::size_t createSimplex(std::vector<std::size_t>&& vertices);
+		void addPoint(std::size_t simplex, std::vector<std::size_t>& pending);
+		void partition(const std::vector<std::size_t>& candidates, const std::vector<std::size_t>& simplices);
+		void compactConflicts();
+		void collectResults();
+		int exactSide(const Simplex& simplex, std::size_t point) const;
+
+		Number distance(const Simplex& simplex, std::size_t point) const {
+			return simplex.normal.dot(mPoints[point]) - simplex.offset;
+		}
+
+		template<typename N = Number, carl::DisableIf< std::is_same<N,double> > = carl::dummy>
+		int side(const Simplex&, std::size_t, const Number& dist) const {
+			return dist > 0 ? 1 : (dist < 0 ? -1 : 0);
+		}
+
+		template<typename N = Number, carl::EnableIf< std::is_same<N,double> > = carl::dummy>
+		int side(const Simplex& simplex, std::size_t point, const Number& dist) const {
+			// the filter only decides signs which are certain despite rounding errors.
+			Number bound = CONVEX_HULL_FILTER_TOLERANCE * simplex.filterScale;
+			if(dist > bound) {
+				return 1;
+			}
+			if(dist < -bound) {
+				return -1;
+			}
+			return exactSide(simplex, point);
+		}
+
+		template<typename N = Number, carl::DisableIf< std::is_same<N,double> > = carl::dummy>
+		void initExactInterior() {}
+
+		template<typename N = Number, carl::EnableIf< std::is_same<N,double> > = carl::dummy>
+		void initExactInterior() {
+			mExactInterior = rationalize(mInterior);
+		}
+
+		static vector_t<mpq_class> rationalize(const vector_t<Number>& in);
+
+		template<typename N>
+		static vector_t<N> hyperplaneNormal(const std::vector<vector_t<N>>& vertices);
+};
+
+} // namespace hypro
+
+#include "QuickHull.tpp"
@@ -0,0 +1,505 @@
+#include "QuickHull.h"
+
+namespace hypro {
+
+	template<typename Number>
+	QuickHull<Number>::QuickHull(const std::vector<Point<Number>>& points) {
+		if(points.empty()) {
+			return;
+		}
+		mDimension = points.begin()->dimension();
+		// duplicate points are removed in linear time by hashing, reusing the cached hashes of the points.
+		PointHashSet<Number> known(mDimension);
+		known.reserve(points.size());
+		for(const auto& point : points) {
+			if(known.insert(point).second) {
+				mPoints.push_back(point.rawCoordinates());
+				for(unsigned d = 0; d < mDimension; ++d) {
+					Number absEntry = carl::abs(point.rawCoordinates()(d));
+					mMaxCoordinate = absEntry > mMaxCoordinate ? absEntry : mMaxCoordinate;
+				}
+			}
+		}
+	}
+
+	template<typename Number>
+	vector_t<mpq_class> QuickHull<Number>::rationalize(const vector_t<Number>& in) {
+		vector_t<mpq_class> result = vector_t<mpq_class>(in.rows());
+		for(unsigned index = 0; index < in.rows(); ++index) {
+			result(index) = carl::rationalize<mpq_class>(in(index));
+		}
+		return result;
+	}
+
+	template<typename Number>
+	template<typename N>
+	vector_t<N> QuickHull<Number>::hyperplaneNormal(const std::vector<vector_t<N>>& vertices) {
+		std::size_t dim = vertices.front().rows();
+		vector_t<N> normal = vector_t<N>::Zero(dim);
+		if(dim == 1) {
+			normal(0) = N(1);
+			return normal;
+		}
+		// the normal is given by the signed (d-1)-minors of the matrix of edge vectors.
+		matrix_t<N> edges = matrix_t<N>(dim-1, dim);
+		for(std::size_t row = 1; row < dim; ++row) {
+			edges.row(row-1) = (vertices[row] - vertices[0]).transpose();
+		}
+		matrix_t<N> minor = matrix_t<N>(dim-1, dim-1);
+		for(std::size_t col = 0; col < dim; ++col) {
+			for(std::size_t minorCol = 0; minorCol < dim-1; ++minorCol) {
+				minor.col(minorCol) = edges.col(minorCol < col ? minorCol : minorCol+1);
+			}
+			N det = minor.determinant();
+			normal(col) = col % 2 == 0 ? det : N(-det);
+		}
+		return normal;
+	}
+
+	template<typename Number>
+	int QuickHull<Number>::exactSide(const Simplex& simplex, std::size_t point) const {
+		std::vector<vector_t<mpq_class>> vertices;
+		for(auto vertex : simplex.vertices) {
+			vertices.emplace_back(rationalize(mPoints[vertex]));
+		}
+		vector_t<mpq_class> normal = hyperplaneNormal(vertices);
+		mpq_class offset = normal.dot(vertices.front());
+		mpq_class dist = normal.dot(rationalize(mPoints[point])) - offset;
+		if(normal.dot(mExactInterior) > offset) {
+			dist = -dist;
+		}
+		return dist > 0 ? 1 : (dist < 0 ? -1 : 0);
+	}
+
+	template<typename Number>
+	std::size_t QuickHull<Number>::createSimplex(std::vector<std::size_t>&& vertices) {
+		Simplex simplex;
+		std::vector<vector_t<Number>> coordinates;
+		for(auto vertex : vertices) {
+			coordinates.push_back(mPoints[vertex]);
+		}
+		simplex.vertices = std::move(vertices);
+		simplex.neighbors = std::vector<std::size_t>(mDimension, 0);
+		simplex.normal = hyperplaneNormal(coordinates);
+		simplex.offset = simplex.normal.dot(coordinates.front());
+		if(simplex.normal.dot(mInterior) > simplex.offset) {
+			simplex.normal = -simplex.normal;
+			simplex.offset = -simplex.offset;
+		}
+		// Hadamard's bound on the minors times the magnitude of the evaluated points.
+		simplex.filterScale = 2*mMaxCoordinate + 1;
+		for(std::size_t index = 1; index < coordinates.size(); ++index) {
+			Number edgeNorm = 0;
+			for(unsigned d = 0; d < mDimension; ++d) {
+				edgeNorm += carl::abs(coordinates[index](d) - coordinates[0](d));
+			}
+			simplex.filterScale *= edgeNorm;
+		}
+
+		if(mFreeSimplices.empty()) {
+			mSimplices.emplace_back(std::move(simplex));
+			return mSimplices.size()-1;
+		}
+		std::size_t index = mFreeSimplices.back();
+		mFreeSimplices.pop_back();
+		mSimplices[index] = std::move(simplex);
+		return index;
+	}
+
+	template<typename Number>
+	bool QuickHull<Number>::initialSimplex() {
+		// extreme points in each dimension are tried first, such that the initial simplex is large.
+		std::vector<std::size_t> candidates;
+		for(unsigned d = 0; d < mDimension; ++d) {
+			std::size_t minIndex = 0;
+			std::size_t maxIndex = 0;
+			for(std::size_t index = 1; index < mPoints.size(); ++index) {
+				if(mPoints[index](d) < mPoints[minIndex](d)) {
+					minIndex = index;
+				}
+				if(mPoints[index](d) > mPoints[maxIndex](d)) {
+					maxIndex = index;
+				}
+			}
+			candidates.push_back(minIndex);
+			candidates.push_back(maxIndex);
+		}
+		for(std::size_t index = 0; index < mPoints.size(); ++index) {
+			candidates.push_back(index);
+		}
+
+		std::vector<std::size_t> simplexVertices;
+		simplexVertices.push_back(candidates.front());
+		matrix_t<Number> edges = matrix_t<Number>(mDimension, 0);
+		for(auto candidate : candidates) {
+			if(simplexVertices.size() == mDimension+1) {
+				break;
+			}
+			if(std::find(simplexVertices.begin(), simplexVertices.end(), candidate) != simplexVertices.end()) {
+				continue;
+			}
+			matrix_t<Number> extended = matrix_t<Number>(mDimension, edges.cols()+1);
+			extended.leftCols(edges.cols()) = edges;
+			extended.col(edges.cols()) = mPoints[candidate] - mPoints[simplexVertices.front()];
+			if(unsigned(extended.fullPivLu().rank()) == extended.cols()) {
+				edges = extended;
+				simplexVertices.push_back(candidate);
+			}
+		}
+		if(simplexVertices.size() < mDimension+1) {
+			return false;
+		}
+
+		mInterior = vector_t<Number>::Zero(mDimension);
+		for(auto vertex : simplexVertices) {
+			mInterior += mPoints[vertex];
+		}
+		mInterior /= Number(mDimension+1);
+		initExactInterior();
+
+		// the i-th simplex omits the i-th vertex, thus the simplex opposite to its vertex j omits vertex j.
+		std::vector<std::size_t> simplices;
+		for(std::size_t omitted = 0; omitted <= mDimension; ++omitted) {
+			std::vector<std::size_t> vertices;
+			for(std::size_t index = 0; index <= mDimension; ++index) {
+				if(index != omitted) {
+					vertices.push_back(simplexVertices[index]);
+				}
+			}
+			simplices.push_back(createSimplex(std::move(vertices)));
+		}
+		for(std::size_t omitted = 0; omitted <= mDimension; ++omitted) {
+			for(std::size_t pos = 0; pos < mDimension; ++pos) {
+				mSimplices[simplices[omitted]].neighbors[pos] = simplices[pos < omitted ? pos : pos+1];
+			}
+		}
+
+		std::vector<std::size_t> remaining;
+		for(std::size_t index = 0; index < mPoints.size(); ++index) {
+			if(std::find(simplexVertices.begin(), simplexVertices.end(), index) == simplexVertices.end()) {
+				remaining.push_back(index);
+			}
+		}
+		partition(remaining, simplices);
+		return true;
+	}
+
+	template<typename Number>
+	void QuickHull<Number>::partition(const std::vector<std::size_t>& candidates, const std::vector<std::size_t>& simplices) {
+		// each candidate is assigned to the first simplex it is strictly above, others are inside the hull.
+		std::vector<std::size_t> assignment(candidates.size(), simplices.size());
+		std::vector<Number> distances(candidates.size());
+		auto assign = [&](std::size_t begin, std::size_t end) {
+			for(std::size_t index = begin; index < end; ++index) {
+				for(std::size_t pos = 0; pos < simplices.size(); ++pos) {
+					const Simplex& simplex = mSimplices[simplices[pos]];
+					Number dist = distance(simplex, candidates[index]);
+					if(side(simplex, candidates[index], dist) > 0) {
+						assignment[index] = pos;
+						distances[index] = dist;
+						break;
+					}
+				}
+			}
+		};
+
+		#ifdef HYPRO_USE_MULTITHREADING
+		if(candidates.size() >= 2*CONVEX_HULL_PARALLEL_MIN_POINTS && !ThreadPool::isWorkerThread()) {
+			ThreadPool& pool = ThreadPool::getInstance();
+			std::size_t chunkCount = std::min(pool.size(), candidates.size() / CONVEX_HULL_PARALLEL_MIN_POINTS);
+			std::size_t chunkSize = (candidates.size() + chunkCount - 1) / chunkCount;
+			std::vector<std::future<void>> chunks;
+			for(std::size_t begin = 0; begin < candidates.size(); begin += chunkSize) {
+				chunks.emplace_back(pool.enqueue(assign, begin, std::min(begin + chunkSize, candidates.size())));
+			}
+			for(auto& chunk : chunks) {
+				chunk.get();
+			}
+		} else {
+			assign(0, candidates.size());
+		}
+		#else
+		assign(0, candidates.size());
+		#endif
+
+		// store the conflict sets as consecutive ranges at the end of the conflict buffer.
+		std::vector<std::size_t> counts(simplices.size(), 0);
+		for(auto pos : assignment) {
+			if(pos < simplices.size()) {
+				++counts[pos];
+			}
+		}
+		std::vector<std::size_t> fill(simplices.size());
+		std::size_t next = mConflicts.size();
+		for(std::size_t pos = 0; pos < simplices.size(); ++pos) {
+			mSimplices[simplices[pos]].conflictBegin = next;
+			mSimplices[simplices[pos]].conflictEnd = next;
+			fill[pos] = next;
+			next += counts[pos];
+		}
+		mLiveConflicts += next - mConflicts.size();
+		mConflicts.resize(next);
+
+		std::vector<Number> furthestDistances(simplices.size());
+		for(std::size_t index = 0; index < candidates.size(); ++index) {
+			std::size_t pos = assignment[index];
+			if(pos == simplices.size()) {
+				continue;
+			}
+			Simplex& simplex = mSimplices[simplices[pos]];
+			if(simplex.conflictEnd == simplex.conflictBegin || distances[index] > furthestDistances[pos]) {
+				simplex.furthest = candidates[index];
+				furthestDistances[pos] = distances[index];
+			}
+			mConflicts[fill[pos]++] = candidates[index];
+			++simplex.conflictEnd;
+		}
+	}
+
+	template<typename Number>
+	void QuickHull<Number>::compactConflicts() {
+		std::vector<std::size_t> compacted;
+		compacted.reserve(mLiveConflicts);
+		for(auto& simplex : mSimplices) {
+			if(!simplex.alive) {
+				continue;
+			}
+			std::size_t begin = compacted.size();
+			compacted.insert(compacted.end(), mConflicts.begin() + simplex.conflictBegin, mConflicts.begin() + simplex.conflictEnd);
+			simplex.conflictBegin = begin;
+			simplex.conflictEnd = compacted.size();
+		}
+		mConflicts = std::move(compacted);
+	}
+
+	template<typename Number>
+	void QuickHull<Number>::addPoint(std::size_t start, std::vector<std::size_t>& pending) {
+		std::size_t apex = mSimplices[start].furthest;
+
+		// collect the simplices visible from the apex, which form a connected region.
+		++mEpoch;
+		std::vector<std::size_t> visible;
+		visible.push_back(start);
+		mSimplices[start].visit = mEpoch;
+		mSimplices[start].visible = true;
+		for(std::size_t index = 0; index < visible.size(); ++index) {
+			for(auto neighbor : mSimplices[visible[index]].neighbors) {
+				Simplex& simplex = mSimplices[neighbor];
+				if(simplex.visit == mEpoch) {
+					continue;
+				}
+				simplex.visit = mEpoch;
+				simplex.visible = side(simplex, apex, distance(simplex, apex)) > 0;
+				if(simplex.visible) {
+					visible.push_back(neighbor);
+				}
+			}
+		}
+
+		// create the cone over the horizon ridges, the apex replaces the vertex opposite to the horizon neighbor.
+		std::vector<std::size_t> created;
+		std::map<std::vector<std::size_t>, std::pair<std::size_t, std::size_t>> openRidges;
+		for(auto current : visible) {
+			for(std::size_t pos = 0; pos < mDimension; ++pos) {
+				std::size_t neighbor = mSimplices[current].neighbors[pos];
+				if(mSimplices[neighbor].visit == mEpoch && mSimplices[neighbor].visible) {
+					continue;
+				}
+				std::vector<std::size_t> vertices = mSimplices[current].vertices;
+				vertices[pos] = apex;
+				std::size_t index = createSimplex(std::move(vertices));
+				mSimplices[index].neighbors[pos] = neighbor;
+				std::replace(mSimplices[neighbor].neighbors.begin(), mSimplices[neighbor].neighbors.end(), current, index);
+				created.push_back(index);
+
+				// ridges containing the apex are shared by two new simplices.
+				for(std::size_t other = 0; other < mDimension; ++other) {
+					if(other == pos) {
+						continue;
+					}
+					std::vector<std::size_t> ridge = mSimplices[index].vertices;
+					ridge.erase(ridge.begin() + other);
+					std::sort(ridge.begin(), ridge.end());
+					auto match = openRidges.find(ridge);
+					if(match == openRidges.end()) {
+						openRidges.emplace(std::move(ridge), std::make_pair(index, other));
+					} else {
+						mSimplices[index].neighbors[other] = match->second.first;
+						mSimplices[match->second.first].neighbors[match->second.second] = index;
+						openRidges.erase(match);
+					}
+				}
+			}
+		}
+		assert(openRidges.empty());
+
+		// release the visible simplices and redistribute their conflict points.
+		std::vector<std::size_t> candidates;
+		for(auto current : visible) {
+			Simplex& simplex = mSimplices[current];
+			for(std::size_t index = simplex.conflictBegin; index < simplex.conflictEnd; ++index) {
+				if(mConflicts[index] != apex) {
+					candidates.push_back(mConflicts[index]);
+				}
+			}
+			mLiveConflicts -= simplex.conflictEnd - simplex.conflictBegin;
+			simplex.alive = false;
+			simplex.conflictBegin = simplex.conflictEnd = 0;
+			mFreeSimplices.push_back(current);
+		}
+		partition(candidates, created);
+		for(auto index : created) {
+			if(mSimplices[index].conflictEnd > mSimplices[index].conflictBegin) {
+				pending.push_back(index);
+			}
+		}
+		if(mConflicts.size() > 2*mLiveConflicts + mPoints.size()) {
+			compactConflicts();
+		}
+	}
+
+	template<typename Number>
+	void QuickHull<Number>::collectResults() {
+		// merge coplanar neighboring simplices into facets.
+		std::vector<std::size_t> parent(mSimplices.size());
+		for(std::size_t index = 0; index < parent.size(); ++index) {
+			parent[index] = index;
+		}
+		auto findRoot = [&parent](std::size_t index) {
+			while(parent[index] != index) {
+				parent[index] = parent[parent[index]];
+				index = parent[index];
+			}
+			return index;
+		};
+		for(std::size_t index = 0; index < mSimplices.size(); ++index) {
+			const Simplex& simplex = mSimplices[index];
+			if(!simplex.alive) {
+				continue;
+			}
+			for(auto neighbor : simplex.neighbors) {
+				if(neighbor < index) {
+					continue;
+				}
+				const Simplex& other = mSimplices[neighbor];
+				std::size_t pos = std::find(other.neighbors.begin(), other.neighbors.end(), index) - other.neighbors.begin();
+				std::size_t opposite = other.vertices[pos];
+				if(side(simplex, opposite, distance(simplex, opposite)) == 0) {
+					parent[findRoot(neighbor)] = findRoot(index);
+				}
+			}
+		}
+
+		std::map<std::size_t, std::size_t> facetIndices;
+		std::vector<vector_t<Number>> normals;
+		std::vector<std::vector<std::size_t>> facetsOfPoint(mPoints.size());
+		for(std::size_t index = 0; index < mSimplices.size(); ++index) {
+			if(!mSimplices[index].alive) {
+				continue;
+			}
+			std::size_t root = findRoot(index);
+			auto facet = facetIndices.find(root);
+			if(facet == facetIndices.end()) {
+				facet = facetIndices.emplace(root, normals.size()).first;
+				const Simplex& representative = mSimplices[root];
+				Number maxEntry = 0;
+				for(unsigned d = 0; d < mDimension; ++d) {
+					Number absEntry = carl::abs(representative.normal(d));
+					maxEntry = absEntry > maxEntry ? absEntry : maxEntry;
+				}
+				normals.push_back(representative.normal / maxEntry);
+				mHsv.emplace_back(normals.back(), Number(representative.offset / maxEntry));
+			}
+			for(auto vertex : mSimplices[index].vertices) {
+				facetsOfPoint[vertex].push_back(facet->second);
+			}
+		}
+
+		auto rank = [&normals, this](const std::vector<std::size_t>& facets) {
+			matrix_t<Number> stacked = matrix_t<Number>(facets.size(), mDimension);
+			for(std::size_t row = 0; row < facets.size(); ++row) {
+				stacked.row(row) = normals[facets[row]].transpose();
+			}
+			return std::size_t(stacked.fullPivLu().rank());
+		};
+
+		// vertices of the simplices which lie in the relative interior of a face are dropped.
+		std::vector<std::vector<std::size_t>> verticesOfFacet(normals.size());
+		for(std::size_t index = 0; index < mPoints.size(); ++index) {
+			auto& facets = facetsOfPoint[index];
+			if(facets.empty()) {
+				continue;
+			}
+			std::sort(facets.begin(), facets.end());
+			facets.erase(std::unique(facets.begin(), facets.end()), facets.end());
+			if(facets.size() < mDimension || rank(facets) < mDimension) {
+				facets.clear();
+				continue;
+			}
+			mVertices.emplace_back(mPoints[index]);
+			mNeighborhood[mVertices.back()];
+			for(auto facet : facets) {
+				verticesOfFacet[facet].push_back(index);
+			}
+		}
+
+		// two vertices are adjacent, if the facets containing both intersect in an edge.
+		std::set<std::pair<std::size_t, std::size_t>> tested;
+		for(const auto& vertices : verticesOfFacet) {
+			for(std::size_t first = 0; first < vertices.size(); ++first) {
+				for(std::size_t second = first+1; second < vertices.size(); ++second) {
+					if(!tested.emplace(vertices[first], vertices[second]).second) {
+						continue;
+					}
+					std::vector<std::size_t> common;
+					std::set_intersection(facetsOfPoint[vertices[first]].begin(), facetsOfPoint[vertices[first]].end(),
+										  facetsOfPoint[vertices[second]].begin(), facetsOfPoint[vertices[second]].end(),
+										  std::back_inserter(common));
+					if(common.size() + 1 >= mDimension && rank(common) + 1 == mDimension) {
+						Point<Number> lhs(mPoints[vertices[first]]);
+						Point<Number> rhs(mPoints[vertices[second]]);
+						mNeighborhood[lhs].insert(rhs);
+						mNeighborhood[rhs].insert(lhs);
+					}
+				}
+			}
+		}
+		if(mDimension == 1 && mVertices.size() == 2) {
+			mNeighborhood[mVertices.front()].insert(mVertices.back());
+			mNeighborhood[mVertices.back()].insert(mVertices.front());
+		}
+	}
+
+	template<typename Number>
+	void QuickHull<Number>::compute() {
+		mSimplices.clear();
+		mFreeSimplices.clear();
+		mConflicts.clear();
+		mLiveConflicts = 0;
+		mHsv.clear();
+		mVertices.clear();
+		mNeighborhood.clear();
+		mFullDimensional = mDimension > 0 && mPoints.size() > mDimension && initialSimplex();
+		if(!mFullDimensional) {
+			return;
+		}
+
+		std::vector<std::size_t> pending;
+		for(std::size_t index = 0; index < mSimplices.size(); ++index) {
+			if(mSimplices[index].conflictEnd > mSimplices[index].conflictBegin) {
+				pending.push_back(index);
+			}
+		}
+		while(!pending.empty()) {
+			std::size_t current = pending.back();
+			pending.pop_back();
+			if(mSimplices[current].alive && mSimplices[current].conflictEnd > mSimplices[current].conflictBegin) {
+				addPoint(current, pending);
+			}
+		}
+
+		collectResults();
+		TRACE("hypro.convexHull","Computed " << mHsv.size() << " facets and " << mVertices.size() << " vertices of " << mPoints.size() << " points.");
+	}
+
+} // namespace hypro
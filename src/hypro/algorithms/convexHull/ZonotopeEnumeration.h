@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../../config.h"
+#include "../../datastructures/Point.h"
+#include "../../datastructures/Halfspace.h"
+#include "../../util/Permutator.h"
+#include "../../util/linearOptimization/Optimizer.h"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for the exact vertex and facet enumeration of zonotopes.
+ * @details    Zero generators are removed and parallel generators are merged first, such that each remaining generator
+ * contributes to the boundary. The vertices of a zonotope correspond to the full-dimensional cells of the central
+ * hyperplane arrangement of its generators: in the plane these are found by sorting the generators by angle, in higher
+ * dimensions the cells are constructed incrementally, where a linear program is only solved for the side of a new
+ * hyperplane not containing the known interior point of a cell. The facets of a full-dimensional zonotope are spanned by
+ * (d-1)-subsets of the generators, which allows to construct the H-representation without vertices for low orders.
+ * @tparam     Number  The used number type.
+ */
+template<typename Number>
+class ZonotopeEnumeration {
+	private:
+		struct Cell {
+			std::vector<signed char> signs;	// sign of each processed generator on the cell
+			vector_t<Number> point;			// interior point of the cell
+		};
+
+		vector_t<Number> mCenter;
+		std::vector<vector_t<Number>> mGenerators;	// non-zero and pairwise non-parallel
+		std::vector<Point<Number>> mVertices;
+		std::vector<Halfspace<Number>> mHsv;
+		bool mFullDimensional = false;
+
+	public:
+		ZonotopeEnumeration() = default;
+		ZonotopeEnumeration(const ZonotopeEnumeration<Number>& _orig) = default;
+		ZonotopeEnumeration(const vector_t<Number>& center, const matrix_t<Number>& generators);
+		~ZonotopeEnumeration() = default;
+
+		/**
+		 * @brief      Computes the vertices.
+		 */
+		void enumerateVertices();
+
+		/**
+		 * @brief      Computes the facets, if the zonotope is full-dimensional.
+		 */
+		void enumerateFacets();
+
+		std::vector<Point<Number>> getVertices() const { return mVertices; }
+		std::vector<Halfspace<Number>> getHsv() const { return mHsv; }
+
+		/**
+		 * @brief      Returns the generators after removal of zero generators and merging of parallel generators.
+		 */
+		const std::vector<vector_t<Number>>& generators() const { return mGenerators; }
+
+		/**
+		 * @brief      Returns false, if the generators do not span the whole space. In this case no facets are computed.
+		 */
+		bool isFullDimensional() const { return mFullDimensional; }
+
+	private:
+		void enumeratePlanarVertices();
+		void enumerateCells();
+		vector_t<Number> vertex(const std::vector<signed char>& signs) const;
+		static vector_t<Number> normalize(const vector_t<Number>& vec);
+
+		template<typename N = Number, carl::DisableIf< std::is_same<N,double> > = carl::dummy>
+		static int sign(const Number& val) {
+			return val > 0 ? 1 : (val < 0 ? -1 : 0);
+		}
+
+		template<typename N = Number, carl::EnableIf< std::is_same<N,double> > = carl::dummy>
+		static int sign(const Number& val) {
+			// interior points of cells are scaled to distance at least one from all hyperplanes.
+			return std::abs(val) <= VERTEX_ENUMERATION_TOLERANCE ? 0 : (val > 0 ? 1 : -1);
+		}
+};
+
+} // namespace hypro
+
+#include "ZonotopeEnumeration.tpp"
@@ -0,0 +1,218 @@
+#include "ZonotopeEnumeration.h"
+
+namespace hypro {
+
+	template<typename Number>
+	ZonotopeEnumeration<Number>::ZonotopeEnumeration(const vector_t<Number>& center, const matrix_t<Number>& generators)
+		: mCenter(center)
+	{
+		assert(center.rows() == generators.rows() || generators.cols() == 0);
+		// parallel generators are merged in linear time by hashing their normalized directions.
+		std::unordered_map<vector_t<Number>, std::size_t> directions;
+		vector_t<Number> zero = vector_t<Number>::Zero(center.rows());
+		for(unsigned colIndex = 0; colIndex < generators.cols(); ++colIndex) {
+			vector_t<Number> generator = generators.col(colIndex);
+			if(generator == zero) {
+				continue;
+			}
+			vector_t<Number> direction = normalize(generator);
+			if(generator.dot(direction) < 0) {
+				generator = -generator;
+			}
+			auto known = directions.find(direction);
+			if(known == directions.end()) {
+				directions.emplace(std::move(direction), mGenerators.size());
+				mGenerators.emplace_back(std::move(generator));
+			} else {
+				mGenerators[known->second] += generator;
+			}
+		}
+
+		if(!mGenerators.empty()) {
+			matrix_t<Number> spanning = matrix_t<Number>(center.rows(), mGenerators.size());
+			for(std::size_t colIndex = 0; colIndex < mGenerators.size(); ++colIndex) {
+				spanning.col(colIndex) = mGenerators[colIndex];
+			}
+			mFullDimensional = (spanning.fullPivLu().rank() == center.rows());
+		}
+	}
+
+	template<typename Number>
+	vector_t<Number> ZonotopeEnumeration<Number>::normalize(const vector_t<Number>& vec) {
+		// scale by the largest absolute entry and let the first non-zero entry be positive.
+		Number maxEntry = 0;
+		int firstSign = 0;
+		for(unsigned index = 0; index < vec.rows(); ++index) {
+			Number absEntry = carl::abs(vec(index));
+			maxEntry = absEntry > maxEntry ? absEntry : maxEntry;
+			if(firstSign == 0 && vec(index) != 0) {
+				firstSign = vec(index) > 0 ? 1 : -1;
+			}
+		}
+		if(maxEntry == 0) {
+			return vec;
+		}
+		return firstSign > 0 ? vector_t<Number>(vec / maxEntry) : vector_t<Number>(-vec / maxEntry);
+	}
+
+	template<typename Number>
+	vector_t<Number> ZonotopeEnumeration<Number>::vertex(const std::vector<signed char>& signs) const {
+		assert(signs.size() == mGenerators.size());
+		vector_t<Number> result = mCenter;
+		for(std::size_t index = 0; index < signs.size(); ++index) {
+			if(signs[index] > 0) {
+				result += mGenerators[index];
+			} else {
+				result -= mGenerators[index];
+			}
+		}
+		return result;
+	}
+
+	template<typename Number>
+	void ZonotopeEnumeration<Number>::enumerateVertices() {
+		mVertices.clear();
+		if(mCenter.rows() == 0) {
+			return;
+		}
+		if(mGenerators.empty()) {
+			mVertices.emplace_back(mCenter);
+			return;
+		}
+		if(mCenter.rows() == 2) {
+			enumeratePlanarVertices();
+		} else {
+			enumerateCells();
+		}
+		TRACE("hypro.vertexEnumeration","Enumerated " << mVertices.size() << " vertices of a zonotope with " << mGenerators.size() << " generators.");
+	}
+
+	template<typename Number>
+	void ZonotopeEnumeration<Number>::enumeratePlanarVertices() {
+		// orient all generators into the upper half-plane and sort them by angle.
+		std::vector<vector_t<Number>> sorted = mGenerators;
+		vector_t<Number> current = mCenter;
+		for(auto& generator : sorted) {
+			if(generator(1) < 0 || (generator(1) == 0 && generator(0) < 0)) {
+				generator = -generator;
+			}
+			current -= generator;
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const vector_t<Number>& lhs, const vector_t<Number>& rhs){
+			return lhs(0) * rhs(1) - lhs(1) * rhs(0) > 0;
+		});
+
+		// walk counterclockwise around the boundary, starting at the lowest vertex.
+		mVertices.reserve(2 * sorted.size());
+		for(const auto& generator : sorted) {
+			mVertices.emplace_back(current);
+			current += Number(2) * generator;
+		}
+		for(const auto& generator : sorted) {
+			mVertices.emplace_back(current);
+			current -= Number(2) * generator;
+		}
+	}
+
+	template<typename Number>
+	void ZonotopeEnumeration<Number>::enumerateCells() {
+		std::size_t dim = mCenter.rows();
+		std::vector<Cell> cells;
+		vector_t<Number> first = mGenerators[0] / mGenerators[0].dot(mGenerators[0]);
+		cells.emplace_back(Cell{std::vector<signed char>(1, 1), first});
+		cells.emplace_back(Cell{std::vector<signed char>(1, -1), vector_t<Number>(-first)});
+
+		Optimizer<Number> optimizer;
+		for(std::size_t generatorIndex = 1; generatorIndex < mGenerators.size(); ++generatorIndex) {
+			const vector_t<Number>& generator = mGenerators[generatorIndex];
+			std::vector<Cell> refined;
+			refined.reserve(2 * cells.size());
+			for(auto& cell : cells) {
+				int side = sign(generator.dot(cell.point));
+				for(signed char newSign : {1, -1}) {
+					Cell next;
+					next.signs = cell.signs;
+					next.signs.push_back(newSign);
+					if(side == newSign) {
+						// the known interior point lies on this side, no linear program is required.
+						next.point = cell.point;
+						refined.emplace_back(std::move(next));
+						continue;
+					}
+					// the cell is split, iff s_i * g_i^T x >= 1 is feasible for all processed generators.
+					matrix_t<Number> constraints = matrix_t<Number>(next.signs.size(), dim);
+					vector_t<Number> constants = -vector_t<Number>::Ones(next.signs.size());
+					vector_t<Number> objective = vector_t<Number>::Zero(dim);
+					for(std::size_t row = 0; row < next.signs.size(); ++row) {
+						vector_t<Number> oriented = next.signs[row] > 0 ? mGenerators[row] : vector_t<Number>(-mGenerators[row]);
+						constraints.row(row) = -oriented.transpose();
+						objective -= oriented;
+					}
+					optimizer.setMatrix(constraints);
+					optimizer.setVector(constants);
+					EvaluationResult<Number> result = optimizer.evaluate(objective, true);
+					if(result.errorCode == SOLUTION::FEAS) {
+						next.point = result.optimumValue;
+						refined.emplace_back(std::move(next));
+					}
+				}
+			}
+			cells = std::move(refined);
+		}
+
+		mVertices.reserve(cells.size());
+		for(const auto& cell : cells) {
+			mVertices.emplace_back(vertex(cell.signs));
+		}
+	}
+
+	template<typename Number>
+	void ZonotopeEnumeration<Number>::enumerateFacets() {
+		mHsv.clear();
+		if(!mFullDimensional) {
+			return;
+		}
+		std::size_t dim = mCenter.rows();
+		// each facet normal is orthogonal to d-1 linearly independent generators, duplicates are detected by hashing.
+		std::unordered_set<vector_t<Number>> known;
+		matrix_t<Number> spanning = matrix_t<Number>(dim-1, dim);
+		matrix_t<Number> minor = matrix_t<Number>(dim-1, dim-1);
+		vector_t<Number> zero = vector_t<Number>::Zero(dim);
+		Permutator permutator(mGenerators.size(), dim-1);
+		while(!permutator.end()) {
+			std::vector<unsigned> subset = permutator();
+			vector_t<Number> normal = vector_t<Number>(dim);
+			if(dim == 1) {
+				normal(0) = Number(1);
+			} else {
+				for(std::size_t row = 0; row < subset.size(); ++row) {
+					spanning.row(row) = mGenerators[subset[row]].transpose();
+				}
+				// the normal is given by the signed (d-1)-minors.
+				for(std::size_t col = 0; col < dim; ++col) {
+					for(std::size_t minorCol = 0; minorCol < dim-1; ++minorCol) {
+						minor.col(minorCol) = spanning.col(minorCol < col ? minorCol : minorCol+1);
+					}
+					Number det = minor.determinant();
+					normal(col) = col % 2 == 0 ? det : Number(-det);
+				}
+				if(normal == zero) {
+					continue;
+				}
+			}
+			normal = normalize(normal);
+			if(!known.insert(normal).second) {
+				continue;
+			}
+			Number centerValue = normal.dot(mCenter);
+			Number extent = 0;
+			for(const auto& generator : mGenerators) {
+				extent += carl::abs(Number(normal.dot(generator)));
+			}
+			mHsv.emplace_back(normal, Number(centerValue + extent));
+			mHsv.emplace_back(vector_t<Number>(-normal), Number(extent - centerValue));
+		}
+		TRACE("hypro.vertexEnumeration","Constructed " << mHsv.size() << " facets of a zonotope with " << mGenerators.size() << " generators.");
+	}
+
+} // namespace hypro
@@ -0,0 +1,191 @@
+/**
+ * Conservative interval hulls of state sets, which allow to reject guards and bad states without exact tests.
+ * @file IntervalHull.h
+ */
+
+#pragma once
+#include "../../config.h"
+#include "../../representations/GeometricObject.h"
+#include <type_traits>
+
+namespace hypro {
+namespace reachability {
+
+/**
+ * @brief      Class for an axis-aligned box over-approximating a state set.
+ * @details    The hull is either computed directly from a set (exact) or obtained by propagating another hull through
+ * set operations in closed form. Propagated hulls are conservative, i.e. they contain the interval hull of the resulting
+ * set, but may grow due to the wrapping effect. An invalid hull does not carry any information.
+ * @tparam     Number  The used number type.
+ */
+template<typename Number>
+class IntervalHull {
+  private:
+	vector_t<Number> mLower;
+	vector_t<Number> mUpper;
+	bool mValid = false;
+	bool mExact = false;
+
+  public:
+	IntervalHull() = default;
+	IntervalHull( const IntervalHull<Number>& _orig ) = default;
+	IntervalHull( const vector_t<Number>& _lower, const vector_t<Number>& _upper, bool _exact = true )
+		: mLower( _lower ), mUpper( _upper ), mValid( true ), mExact( _exact ) {
+		assert( _lower.rows() == _upper.rows() );
+	}
+
+	IntervalHull<Number>& operator=( const IntervalHull<Number>& _orig ) = default;
+
+	bool valid() const { return mValid; }
+	/**
+	 * @brief      Returns true, if the hull has been computed from a set and not by propagation.
+	 */
+	bool exact() const { return mExact; }
+	const vector_t<Number>& lower() const { return mLower; }
+	const vector_t<Number>& upper() const { return mUpper; }
+
+	/**
+	 * @brief      Computes a hull of the image under x -> A*x + b as center A*c + b and radius |A|*r.
+	 */
+	IntervalHull<Number> affineTransformation( const matrix_t<Number>& A, const vector_t<Number>& b ) const {
+		if ( !mValid ) {
+			return IntervalHull<Number>();
+		}
+		vector_t<Number> center = A * vector_t<Number>( ( mLower + mUpper ) / Number( 2 ) ) + b;
+		vector_t<Number> radius = A.array().abs().matrix() * vector_t<Number>( ( mUpper - mLower ) / Number( 2 ) );
+		return IntervalHull<Number>( center - radius, center + radius, false );
+	}
+
+	IntervalHull<Number> minkowskiSum( const IntervalHull<Number>& rhs ) const {
+		if ( !mValid || !rhs.valid() ) {
+			return IntervalHull<Number>();
+		}
+		return IntervalHull<Number>( mLower + rhs.lower(), mUpper + rhs.upper(), false );
+	}
+
+	IntervalHull<Number> intersect( const IntervalHull<Number>& rhs ) const {
+		if ( !mValid ) {
+			return rhs;
+		}
+		if ( !rhs.valid() ) {
+			return *this;
+		}
+		return IntervalHull<Number>( mLower.cwiseMax( rhs.lower() ), mUpper.cwiseMin( rhs.upper() ), false );
+	}
+
+	IntervalHull<Number> unite( const IntervalHull<Number>& rhs ) const {
+		if ( !mValid || !rhs.valid() ) {
+			return IntervalHull<Number>();
+		}
+		return IntervalHull<Number>( mLower.cwiseMin( rhs.lower() ), mUpper.cwiseMax( rhs.upper() ), mExact && rhs.exact() );
+	}
+
+	/**
+	 * @brief      Checks whether the hull proves that no point of the set satisfies all passed halfspaces.
+	 * @details    The minimal value of the hull in direction n is n*c - |n|*r, which is computed for all rows at once.
+	 * @return     True, if the hull lies outside of one of the halfspaces. False, if no decision is possible.
+	 */
+	bool separatedFrom( const matrix_t<Number>& _mat, const vector_t<Number>& _vec ) const {
+		assert( _mat.rows() == _vec.rows() );
+		if ( !mValid || _mat.rows() == 0 ) {
+			return false;
+		}
+		assert( _mat.cols() == mLower.rows() );
+		for ( unsigned d = 0; d < mLower.rows(); ++d ) {
+			if ( mLower( d ) > mUpper( d ) ) {
+				return true;
+			}
+		}
+		vector_t<Number> minima = _mat * vector_t<Number>( ( mLower + mUpper ) / Number( 2 ) ) -
+								  _mat.array().abs().matrix() * vector_t<Number>( ( mUpper - mLower ) / Number( 2 ) );
+		for ( unsigned rowIndex = 0; rowIndex < _mat.rows(); ++rowIndex ) {
+			if ( minima( rowIndex ) > _vec( rowIndex ) ) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+/**
+ * @brief      True for the representations whose interval hull is obtained without a general conversion, i.e. cheap
+ * enough to pay off as a pre-test.
+ */
+template<typename Number, typename Representation>
+struct providesIntervalHull : std::integral_constant<bool,
+	std::is_same<Representation, Box<Number>>::value || std::is_same<Representation, Zonotope<Number>>::value ||
+	std::is_same<Representation, VPolytope<Number>>::value || std::is_same<Representation, SupportFunction<Number>>::value ||
+	std::is_same<Representation, HPolytope<Number>>::value> {};
+
+/**
+ * @brief      Computes the interval hull of a state set directly from its representation, where possible in closed form.
+ */
+template<typename Number>
+IntervalHull<Number> computeIntervalHull( const Box<Number>& _set ) {
+	if ( _set.dimension() == 0 ) {
+		return IntervalHull<Number>();
+	}
+	return IntervalHull<Number>( _set.limits().first.rawCoordinates(), _set.limits().second.rawCoordinates() );
+}
+
+template<typename Number>
+IntervalHull<Number> computeIntervalHull( const Zonotope<Number>& _set ) {
+	if ( _set.dimension() == 0 ) {
+		return IntervalHull<Number>();
+	}
+	vector_t<Number> radius = vector_t<Number>::Zero( _set.dimension() );
+	if ( _set.generators().cols() > 0 ) {
+		radius = _set.generators().array().abs().rowwise().sum().matrix();
+	}
+	return IntervalHull<Number>( _set.center() - radius, _set.center() + radius );
+}
+
+template<typename Number>
+IntervalHull<Number> computeIntervalHull( const VPolytope<Number>& _set ) {
+	if ( _set.dimension() == 0 || _set.vertices().empty() ) {
+		return IntervalHull<Number>();
+	}
+	vector_t<Number> lower = _set.vertices().front().rawCoordinates();
+	vector_t<Number> upper = lower;
+	for ( const auto& vertex : _set.vertices() ) {
+		lower = lower.cwiseMin( vertex.rawCoordinates() );
+		upper = upper.cwiseMax( vertex.rawCoordinates() );
+	}
+	return IntervalHull<Number>( lower, upper );
+}
+
+template<typename Number>
+IntervalHull<Number> computeIntervalHull( const SupportFunction<Number>& _set ) {
+	std::size_t dim = _set.dimension();
+	if ( dim == 0 ) {
+		return IntervalHull<Number>();
+	}
+	matrix_t<Number> directions = matrix_t<Number>( 2 * dim, dim );
+	directions << matrix_t<Number>::Identity( dim, dim ), -matrix_t<Number>::Identity( dim, dim );
+	std::vector<EvaluationResult<Number>> results = _set.multiEvaluate( directions, true, false );
+	vector_t<Number> lower = vector_t<Number>( dim );
+	vector_t<Number> upper = vector_t<Number>( dim );
+	for ( std::size_t d = 0; d < dim; ++d ) {
+		// unbounded or empty sets do not provide a hull.
+		if ( results[d].errorCode != SOLUTION::FEAS || results[dim + d].errorCode != SOLUTION::FEAS ) {
+			return IntervalHull<Number>();
+		}
+		upper( d ) = results[d].supportValue;
+		lower( d ) = -results[dim + d].supportValue;
+	}
+	return IntervalHull<Number>( lower, upper );
+}
+
+template<typename Number>
+IntervalHull<Number> computeIntervalHull( const HPolytope<Number>& _set ) {
+	// evaluates the 2d axis directions instead of enumerating vertices.
+	return computeIntervalHull<Number>( Converter<Number>::toBox( _set, CONV_MODE::ALTERNATIVE ) );
+}
+
+template<typename Number, typename Representation>
+IntervalHull<Number> computeIntervalHull( const Representation& _set ) {
+	return computeIntervalHull<Number>( Converter<Number>::toBox( _set ) );
+}
+
+}  // namespace reachability
+}  // namespace hypro
@@ -12,6 +12,8 @@
 
 #pragma once
 #include "util.h"
+#include "IntervalHull.h"
+#include "VisitedStates.h"
 #include "Settings.h"
 #include "config.h"
 #include "datastructures/hybridAutomata/HybridAutomaton.h"
@@ -50,6 +52,9 @@ using flowpipe_t = std::vector<Representation>;
 template<typename Number>
 using initialSet = boost::tuple<unsigned, State<Number>>;
 
+template<typename Number>
+class ReachTaylorModel;
+
 /**
  * @brief      Class implementing a basic reachbility analysis algorithm for linear hybrid automata.
  *
@@ -65,6 +70,7 @@ private:
     Number mBloatingFactor = 0;
 	std::map<unsigned, std::vector<flowpipe_t<Representation>>> mReachableStates;
 	std::list<initialSet<Number>> mWorkingQueue;
+	VisitedStates<Number> mVisitedStates;  // initial sets of computed flowpipes, used to prune subsumed initial sets
 	Plotter<Number>& plotter = Plotter<Number>::getInstance();
 
 	mutable bool mIntersectedBadStates;
@@ -80,7 +86,8 @@ public:
 
 	/**
 	 * @brief Computes the forward reachability of the given automaton.
-	 * @details
+	 * @details Automata with polynomial flows are analyzed using Taylor models, see ReachTaylorModel, whose segments are
+	 * converted to the used representation.
 	 * @return The flowpipe as a result of this computation.
 	 */
 	std::vector<std::pair<unsigned, flowpipe_t<Representation>>> computeForwardReachability();
@@ -124,16 +131,28 @@ public:
 	 */
 	bool intersectGuard( Transition<Number>* _trans, const State<Number>& _segment, State<Number>& result ) const;
 
-	bool checkTransitions(const State<Number>& _state, const carl::Interval<Number>& currentTime, std::vector<boost::tuple<Transition<Number>*, State<Number>>>& nextInitialSets) const;
+	/**
+	 * @brief Collects the states satisfying the guards of the outgoing transitions of the passed state.
+	 * @details If an interval hull of the set of the state is passed, guards which are separated from the hull are skipped without an exact test.
+	 *
+	 * @param _state The state.
+	 * @param currentTime The time interval covered by the state.
+	 * @param nextInitialSets The collected guard satisfying states.
+	 * @param _hull An optional interval hull of the set of the state, which is computed lazily.
+	 * @return True, if some transition is enabled.
+	 */
+	bool checkTransitions(const State<Number>& _state, const carl::Interval<Number>& currentTime, std::vector<boost::tuple<Transition<Number>*, State<Number>>>& nextInitialSets, IntervalHull<Number>* _hull = nullptr) const;
 
 	const ReachabilitySettings<Number>& settings() const { return mSettings; }
 	void setSettings(const ReachabilitySettings<Number>& settings) { mSettings = settings; }
 
 private:
 
+	std::vector<std::pair<unsigned, flowpipe_t<Representation>>> computeTaylorModelReachability();
 	matrix_t<Number> computeTrafoMatrix( Location<Number>* _loc ) const;
 	boost::tuple<bool, State<Number>, matrix_t<Number>, vector_t<Number>> computeFirstSegment( const State<Number>& _state ) const;
-	bool intersectBadStates( const State<Number>& _state, const Representation& _segment ) const;
+	bool intersectBadStates( const State<Number>& _state, const Representation& _segment, IntervalHull<Number>& _hull ) const;
+	bool rejectedByHull( const Representation& _segment, IntervalHull<Number>& _hull, const matrix_t<Number>& _mat, const vector_t<Number>& _vec ) const;
 };
 
 }  // namespace reachability
@@ -143,5 +162,6 @@ private:
 #include "discreteHandling.tpp"
 #include "firstSegment.tpp"
 #include "terminationHandling.tpp"
+#include "ReachTaylorModel.h"
 
 //#include "Reach_SF.h"
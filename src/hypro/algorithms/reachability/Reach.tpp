@@ -20,6 +20,17 @@ namespace reachability {
 		// collect all computed reachable states
 		std::vector<std::pair<unsigned, flowpipe_t<Representation>>> collectedReachableStates;
 
+		// polynomial dynamics are not covered by the flow matrices, they require Taylor model flowpipes.
+		representation_name type = Representation::type();
+		for ( const auto location : mAutomaton.locations() ) {
+			if ( location->hasPolynomialFlow() ) {
+				type = representation_name::taylor_model;
+			}
+		}
+		if ( type == representation_name::taylor_model ) {
+			return computeTaylorModelReachability();
+		}
+
 		for ( const auto& state : mAutomaton.initialStates() ) {
 			if(mCurrentLevel <= mSettings.jumpDepth){
 				// Convert representation in state from matrix and vector to used representation type.
@@ -27,7 +38,6 @@ namespace reachability {
 				s.location = state.second.location;
 
 				HPolytope<Number> tmpSet(state.second.set.first, state.second.set.second);
-				representation_name type = Representation::type();
 				switch(type){
 					case representation_name::box: {
 						s.set = Converter<Number>::toBox(tmpSet);
@@ -85,6 +95,25 @@ namespace reachability {
 		return collectedReachableStates;
 	}
 
+	template<typename Number, typename Representation>
+	std::vector<std::pair<unsigned, flowpipe_t<Representation>>> Reach<Number,Representation>::computeTaylorModelReachability() {
+		ReachTaylorModel<Number> reacher( mAutomaton, mSettings );
+		std::vector<std::pair<unsigned, flowpipe_t<Box<Number>>>> boxFlowpipes = reacher.computeForwardReachability();
+		mIntersectedBadStates = reacher.reachedBadStates();
+
+		std::vector<std::pair<unsigned, flowpipe_t<Representation>>> collectedReachableStates;
+		collectedReachableStates.reserve( boxFlowpipes.size() );
+		for ( const auto& boxFlowpipe : boxFlowpipes ) {
+			flowpipe_t<Representation> flowpipe;
+			flowpipe.reserve( boxFlowpipe.second.size() );
+			for ( const auto& segment : boxFlowpipe.second ) {
+				flowpipe.emplace_back( Representation( segment.matrix(), segment.vector() ) );
+			}
+			collectedReachableStates.emplace_back( boxFlowpipe.first, flowpipe );
+		}
+		return collectedReachableStates;
+	}
+
 
 	template<typename Number, typename Representation>
 	flowpipe_t<Representation> Reach<Number,Representation>::computeForwardTimeClosure( const State<Number>& _state ) {
@@ -101,6 +130,8 @@ namespace reachability {
 		std::vector<boost::tuple<Transition<Number>*, State<Number>>> nextInitialSets;
 
 		boost::tuple<bool, State<Number>, matrix_t<Number>, vector_t<Number>> initialSetup = computeFirstSegment(_state);
+		// states reachable from subsets of this initial set are covered by the flowpipe computed here.
+		addVisited<Number,Representation>(mVisitedStates, _state);
 #ifdef REACH_DEBUG
 		std::cout << "Valuation fulfills Invariant?: ";
 		std::cout << boost::get<0>(initialSetup) << std::endl;
@@ -108,6 +139,8 @@ namespace reachability {
 		if ( boost::get<0>(initialSetup) ) {
 			assert(!boost::get<1>(initialSetup).timestamp.isUnbounded());
 			bool noFlow = false;
+			// conservative interval hull of the current segment, used to skip guards and bad states cheaply.
+			IntervalHull<Number> segmentHull;
 
 			// if the location does not have dynamic behaviour, check guards and exit loop.
 			if(boost::get<2>(initialSetup) == matrix_t<Number>::Identity(boost::get<2>(initialSetup).rows(), boost::get<2>(initialSetup).cols()) &&
@@ -115,7 +148,7 @@ namespace reachability {
 				noFlow = true;
 				// Collect potential new initial states from discrete behaviour.
 				if(mCurrentLevel < mSettings.jumpDepth) {
-					checkTransitions(_state, carl::Interval<Number>(Number(0),mSettings.timeBound), nextInitialSets);
+					checkTransitions(_state, carl::Interval<Number>(Number(0),mSettings.timeBound), nextInitialSets, &segmentHull);
 				}
 			}
 
@@ -129,7 +162,7 @@ namespace reachability {
 			flowpipe.push_back( currentSegment );
 
 			// Check for bad states intersection. The first segment is validated against the invariant, already.
-			if(intersectBadStates(_state, currentSegment)){
+			if(intersectBadStates(_state, currentSegment, segmentHull)){
 				// clear queue to stop whole algorithm
 				while(!mWorkingQueue.empty()){
 					mWorkingQueue.pop_front();
@@ -169,7 +202,7 @@ namespace reachability {
 					currentState.set = currentSegment;
 					currentState.timestamp += carl::Interval<Number>(currentLocalTime-mSettings.timeStep,currentLocalTime);
 					currentState.timestamp = currentState.timestamp.intersect(carl::Interval<Number>(Number(0), mSettings.timeBound));
-					checkTransitions(currentState, currentState.timestamp, nextInitialSets);
+					checkTransitions(currentState, currentState.timestamp, nextInitialSets, &segmentHull);
 				}
 
 				// perform linear transformation on the last segment of the flowpipe
@@ -192,8 +225,11 @@ namespace reachability {
 				// nonautonomPart = nonautonomPart.linearTransformation( boost::get<2>(initialSetup), vector_t<Number>::Zero(autonomPart.dimension()));
 				nonautonomPart = nonautonomPart.linearTransformation(boost::get<2>(initialSetup));
 				totalBloating = totalBloating.minkowskiSum(nonautonomPart);
+				segmentHull = IntervalHull<Number>();
 #else
 				nextSegment =  currentSegment.affineTransformation(boost::get<2>(initialSetup), boost::get<3>(initialSetup));
+				// the hull of the intersection with the invariant is contained in the hull of the transformed segment.
+				segmentHull = segmentHull.affineTransformation(boost::get<2>(initialSetup), boost::get<3>(initialSetup));
 #endif
 				// extend flowpipe (only if still within Invariant of location)
 				std::pair<bool, Representation> newSegment = nextSegment.satisfiesHalfspaces( _state.location->invariant().mat, _state.location->invariant().vec );
@@ -204,7 +240,7 @@ namespace reachability {
 #endif
 				if ( newSegment.first ) {
 					flowpipe.push_back( newSegment.second );
-					if(intersectBadStates(_state, newSegment.second)){
+					if(intersectBadStates(_state, newSegment.second, segmentHull)){
 						// clear queue to stop whole algorithm
 						while(!mWorkingQueue.empty()){
 							mWorkingQueue.pop_front();
@@ -0,0 +1,93 @@
+/**
+ * ReachTaylorModel holds a forward reachability analysis algorithm for hybrid automata with polynomial dynamics based on
+ * Taylor model flowpipes.
+ * @file ReachTaylorModel.h
+ */
+
+#pragma once
+#include "Reach.h"
+#include "representations/TaylorModel/continuous.h"
+#include "util/VariablePool.h"
+
+namespace hypro {
+namespace reachability {
+
+/**
+ * @brief      Parameters of the Taylor model flowpipe construction.
+ * @details    The time step of the ReachabilitySettings is the maximal step size. If a Picard step fails to verify the
+ * remainder estimation, the step size is halved down to minTimeStep, afterwards the order is increased up to maxOrder.
+ * Successful steps enlarge the step size again.
+ */
+template<typename Number>
+struct TaylorModelSettings {
+	exponent order = 4;
+	exponent maxOrder = 8;
+	Number minTimeStep = Number(1e-4);
+	Number remainderEstimation = Number(1e-2);
+	unsigned contractionSplits = 4;  // number of time subintervals for guard intersection
+};
+
+/**
+ * @brief      Class implementing a forward reachability analysis algorithm for hybrid automata with polynomial dynamics.
+ * @details    Flowpipes are computed by Picard iteration on Taylor models. The segments of the flowpipe as well as guard
+ * and bad state intersections are over-approximated by boxes. The dynamics of a location is given by its polynomial
+ * flow, e.g. as parsed from a Flow* model, or else by its affine flow matrix. Reach dispatches automata with polynomial
+ * flows to this engine, other dynamics can be set for each location via setPolynomialFlow.
+ *
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class ReachTaylorModel {
+private:
+	HybridAutomaton<Number> mAutomaton;
+	ReachabilitySettings<Number> mSettings;
+	TaylorModelSettings<Number> mTMSettings;
+	std::size_t mCurrentLevel;
+	std::list<initialSet<Number>> mWorkingQueue;
+	VisitedStates<Number> mVisitedStates;
+	std::map<const Location<Number>*, PolynomialODE<Number>> mODEs;
+	std::map<const Location<Number>*, std::pair<Number, exponent>> mStepControl;  // adapted step size and order per location
+	std::vector<carl::Variable> mVariables;  // state variables
+	std::vector<carl::Variable> mInitialVariables;  // normalized variables of initial sets
+	carl::Variable mTime;
+
+	mutable bool mIntersectedBadStates;
+
+public:
+	ReachTaylorModel( const HybridAutomaton<Number>& _automaton, const ReachabilitySettings<Number>& _settings = ReachabilitySettings<Number>(),
+					  const TaylorModelSettings<Number>& _tmSettings = TaylorModelSettings<Number>() );
+
+	/**
+	 * @brief Sets polynomial dynamics for a location, which take precedence over its flow. The ODE is defined over the variables of the VariablePool, i.e.
+	 * the variable with index i describes dimension i.
+	 */
+	void setPolynomialFlow( const Location<Number>* _loc, const PolynomialODE<Number>& _ode ) { mODEs[_loc] = _ode; }
+
+	/**
+	 * @brief Computes the forward reachability of the given automaton.
+	 * @return The flowpipes as sequences of boxes, each annotated with the id of its location.
+	 */
+	std::vector<std::pair<unsigned, flowpipe_t<Box<Number>>>> computeForwardReachability();
+
+	/**
+	 * @brief Computes the forward time closure of the passed state, whose set is a box, and collects guard intersections.
+	 */
+	flowpipe_t<Box<Number>> computeForwardTimeClosure( const State<Number>& _state );
+
+	bool reachedBadStates() const { return mIntersectedBadStates; }
+
+	const ReachabilitySettings<Number>& settings() const { return mSettings; }
+	const TaylorModelSettings<Number>& tmSettings() const { return mTMSettings; }
+
+private:
+	PolynomialODE<Number> polynomialFlow( const Location<Number>* _loc );
+	Flowpipe<Number> toFlowpipe( const Box<Number>& _box ) const;
+	Box<Number> toBox( Range<Number>& _range ) const;
+	std::pair<bool, Box<Number>> contract( Flowpipe<Number>& _flowpipe, exponent _order, const matrix_t<Number>& _mat, const vector_t<Number>& _vec ) const;
+	bool intersectBadStates( const State<Number>& _state, const Box<Number>& _segment ) const;
+};
+
+}  // namespace reachability
+}  // namespace hypro
+
+#include "ReachTaylorModel.tpp"
@@ -0,0 +1,290 @@
+#include "ReachTaylorModel.h"
+
+namespace hypro {
+namespace reachability {
+
+	template<typename Number>
+	ReachTaylorModel<Number>::ReachTaylorModel( const HybridAutomaton<Number>& _automaton, const ReachabilitySettings<Number>& _settings,
+												const TaylorModelSettings<Number>& _tmSettings )
+		: mAutomaton( _automaton ), mSettings( _settings ), mTMSettings( _tmSettings ), mCurrentLevel( 0 ), mTime( carl::freshRealVariable( "t" ) ), mIntersectedBadStates( false ) {
+			std::size_t dimension = 0;
+			if ( !mAutomaton.initialStates().empty() ) {
+				dimension = mAutomaton.initialStates().begin()->second.set.first.cols();
+			}
+			for ( std::size_t d = 0; d < dimension; ++d ) {
+				mVariables.push_back( VariablePool::getInstance().carlVarByIndex( unsigned( d ) ) );
+				mInitialVariables.push_back( carl::freshRealVariable( "x0_" + std::to_string( d ) ) );
+			}
+		}
+
+	template<typename Number>
+	std::vector<std::pair<unsigned, flowpipe_t<Box<Number>>>> ReachTaylorModel<Number>::computeForwardReachability() {
+		std::vector<std::pair<unsigned, flowpipe_t<Box<Number>>>> collectedReachableStates;
+
+		for ( const auto& state : mAutomaton.initialStates() ) {
+			State<Number> s;
+			s.location = state.second.location;
+			s.set = Converter<Number>::toBox( HPolytope<Number>( state.second.set.first, state.second.set.second ) );
+			s.timestamp = carl::Interval<Number>( 0 );
+			DEBUG( "hypro.reacher", "Adding initial set " << boost::get<Box<Number>>( s.set ) );
+			mWorkingQueue.emplace_back( initialSet<Number>( mCurrentLevel, s ) );
+		}
+
+		while ( !mWorkingQueue.empty() ) {
+			initialSet<Number> nextInitialSet = mWorkingQueue.front();
+			mWorkingQueue.pop_front();
+
+			mCurrentLevel = boost::get<0>( nextInitialSet );
+			assert( mCurrentLevel <= mSettings.jumpDepth );
+			INFO( "hypro.reacher", "Depth " << mCurrentLevel << ", Location: " << boost::get<1>( nextInitialSet ).location->id() );
+			flowpipe_t<Box<Number>> newFlowpipe = computeForwardTimeClosure( boost::get<1>( nextInitialSet ) );
+
+			collectedReachableStates.emplace_back( std::make_pair( boost::get<1>( nextInitialSet ).location->id(), newFlowpipe ) );
+		}
+
+		return collectedReachableStates;
+	}
+
+	template<typename Number>
+	flowpipe_t<Box<Number>> ReachTaylorModel<Number>::computeForwardTimeClosure( const State<Number>& _state ) {
+		assert( !_state.timestamp.isUnbounded() );
+		flowpipe_t<Box<Number>> flowpipe;
+		Location<Number>* loc = _state.location;
+		const matrix_t<Number>& invariantMat = loc->invariant().mat;
+		const vector_t<Number>& invariantVec = loc->invariant().vec;
+
+		std::pair<bool, Box<Number>> initialSegment = boost::get<Box<Number>>( _state.set ).satisfiesHalfspaces( invariantMat, invariantVec );
+		if ( !initialSegment.first ) {
+			return flowpipe;
+		}
+		mVisitedStates.add( loc, initialSegment.second );
+		flowpipe.push_back( initialSegment.second );
+		if ( intersectBadStates( _state, initialSegment.second ) ) {
+			mWorkingQueue.clear();
+			return flowpipe;
+		}
+
+		PolynomialODE<Number> ode = polynomialFlow( loc );
+		Flowpipe<Number> tmFlowpipe = toFlowpipe( initialSegment.second );
+
+		Range<Number> estimation;
+		for ( const auto& v : mVariables ) {
+			estimation.assign( v, carl::Interval<Number>( -mTMSettings.remainderEstimation, mTMSettings.remainderEstimation ) );
+		}
+
+		// the step size and order are adapted per location and reused upon reentering the location.
+		auto stepControl = mStepControl.find( loc );
+		if ( stepControl == mStepControl.end() ) {
+			stepControl = mStepControl.emplace( loc, std::make_pair( mSettings.timeStep, mTMSettings.order ) ).first;
+		}
+		Number& step = stepControl->second.first;
+		exponent& order = stepControl->second.second;
+
+		// guard satisfying sets are aggregated per transition.
+		std::map<Transition<Number>*, State<Number>> guardSatisfyingStates;
+
+		Number currentLocalTime = 0;
+		while ( currentLocalTime < mSettings.timeBound ) {
+			Number currentStep = step < mSettings.timeBound - currentLocalTime ? step : Number( mSettings.timeBound - currentLocalTime );
+			Flowpipe<Number> nextFlowpipe;
+			if ( tmFlowpipe.next_picard( nextFlowpipe, ode, mTime, carl::toDouble( currentStep ), order, estimation ) == 0 ) {
+				// the remainder could not be verified, decrease the step size first, then increase the order.
+				if ( step / 2 >= mTMSettings.minTimeStep ) {
+					step /= 2;
+				} else if ( order < mTMSettings.maxOrder ) {
+					++order;
+				} else {
+					WARN( "hypro.reacher", "Taylor model flowpipe construction stopped at time " << carl::toDouble( currentLocalTime ) << ", the remainder estimation is too small." );
+					break;
+				}
+				continue;
+			}
+			INFO( "hypro.reacher", "Time: " << carl::toDouble( currentLocalTime ) << ", step: " << carl::toDouble( currentStep ) << ", order: " << order );
+
+			Range<Number> range;
+			nextFlowpipe.enclosure( range, order );
+			std::pair<bool, Box<Number>> segment = toBox( range ).satisfiesHalfspaces( invariantMat, invariantVec );
+			if ( !segment.first ) {
+				break;
+			}
+			flowpipe.push_back( segment.second );
+			if ( intersectBadStates( _state, segment.second ) ) {
+				mWorkingQueue.clear();
+				return flowpipe;
+			}
+
+			carl::Interval<Number> timestamp = _state.timestamp + carl::Interval<Number>( currentLocalTime, Number( currentLocalTime + currentStep ) );
+			if ( mCurrentLevel < mSettings.jumpDepth ) {
+				for ( Transition<Number>* transition : loc->outgoing() ) {
+					std::pair<bool, Box<Number>> guardSatisfyingSet = contract( nextFlowpipe, order, transition->guard().mat, transition->guard().vec );
+					if ( guardSatisfyingSet.first ) {
+						guardSatisfyingSet = guardSatisfyingSet.second.satisfiesHalfspaces( invariantMat, invariantVec );
+					}
+					if ( !guardSatisfyingSet.first ) {
+						continue;
+					}
+
+					auto aggregated = guardSatisfyingStates.find( transition );
+					if ( aggregated == guardSatisfyingStates.end() ) {
+						State<Number> s;
+						s.location = loc;
+						s.set = guardSatisfyingSet.second;
+						s.timestamp = timestamp;
+						guardSatisfyingStates.emplace( transition, s );
+					} else {
+						aggregated->second.set = boost::get<Box<Number>>( aggregated->second.set ).unite( guardSatisfyingSet.second );
+						aggregated->second.timestamp = aggregated->second.timestamp.convexHull( timestamp );
+					}
+				}
+			}
+
+			tmFlowpipe = nextFlowpipe;
+			currentLocalTime += currentStep;
+			if ( step * 2 <= mSettings.timeStep ) {
+				step *= 2;
+			}
+		}
+
+		for ( auto& guardPair : guardSatisfyingStates ) {
+			State<Number> s = guardPair.second;
+			s.location = guardPair.first->target();
+			s.set = boost::get<Box<Number>>( s.set ).affineTransformation( guardPair.first->reset().mat, guardPair.first->reset().vec );
+			if ( !isVisited<Number, Box<Number>>( mVisitedStates, s ) ) {
+				mWorkingQueue.emplace_back( mCurrentLevel + 1, s );
+			}
+		}
+
+		return flowpipe;
+	}
+
+	template<typename Number>
+	PolynomialODE<Number> ReachTaylorModel<Number>::polynomialFlow( const Location<Number>* _loc ) {
+		auto odeIt = mODEs.find( _loc );
+		if ( odeIt != mODEs.end() ) {
+			return odeIt->second;
+		}
+
+		PolynomialODE<Number> ode;
+		std::size_t dimension = mVariables.size();
+		if ( _loc->hasPolynomialFlow() ) {
+			// monomials are given by the indices of their variables.
+			assert( _loc->polynomialFlow().size() == dimension );
+			for ( std::size_t rowIndex = 0; rowIndex < dimension; ++rowIndex ) {
+				MultivariatePolynomial<carl::Interval<Number>> rhs;
+				for ( const auto& term : _loc->polynomialFlow()[rowIndex] ) {
+					Term<carl::Interval<Number>> monomial( carl::Interval<Number>( term.second ) );
+					for ( unsigned variableIndex : term.first ) {
+						assert( variableIndex < dimension );
+						monomial *= mVariables[variableIndex];
+					}
+					rhs += monomial;
+				}
+				ode.assign( mVariables[rowIndex], rhs );
+			}
+			mODEs[_loc] = ode;
+			return ode;
+		}
+
+		// the flow matrix describes the affine dynamics x' = A*x + b, where b is stored in the last column.
+		const matrix_t<Number>& flow = _loc->flow();
+		assert( flow.rows() > dimension && flow.cols() > dimension );
+		for ( std::size_t rowIndex = 0; rowIndex < dimension; ++rowIndex ) {
+			MultivariatePolynomial<carl::Interval<Number>> rhs;
+			for ( std::size_t colIndex = 0; colIndex < dimension; ++colIndex ) {
+				if ( flow( rowIndex, colIndex ) != 0 ) {
+					rhs += Term<carl::Interval<Number>>( carl::Interval<Number>( flow( rowIndex, colIndex ) ), mVariables[colIndex], 1 );
+				}
+			}
+			if ( flow( rowIndex, dimension ) != 0 ) {
+				rhs += Term<carl::Interval<Number>>( carl::Interval<Number>( flow( rowIndex, dimension ) ) );
+			}
+			ode.assign( mVariables[rowIndex], rhs );
+		}
+
+		mODEs[_loc] = ode;
+		return ode;
+	}
+
+	template<typename Number>
+	Flowpipe<Number> ReachTaylorModel<Number>::toFlowpipe( const Box<Number>& _box ) const {
+		assert( _box.dimension() == mVariables.size() );
+		TaylorModelVec<Number> tmv;
+		Domain<Number> domain;
+
+		// each dimension is described by center + radius * x0 with x0 in [-1,1].
+		for ( std::size_t d = 0; d < mVariables.size(); ++d ) {
+			carl::Interval<Number> I = _box.interval( d );
+			Number center = ( I.lower() + I.upper() ) / 2;
+			Number radius = ( I.upper() - I.lower() ) / 2;
+
+			TaylorModel<Number> tm( carl::Interval<Number>( center ) );
+			if ( radius != 0 ) {
+				tm += TaylorModel<Number>( Term<carl::Interval<Number>>( carl::Interval<Number>( radius ), mInitialVariables[d], 1 ) );
+			}
+			tmv.assign( mVariables[d], tm );
+			domain.assign( mInitialVariables[d], carl::Interval<Number>( -1, 1 ) );
+		}
+		domain.assign( mTime, carl::Interval<Number>( 0 ) );
+
+		return Flowpipe<Number>( tmv, domain );
+	}
+
+	template<typename Number>
+	Box<Number> ReachTaylorModel<Number>::toBox( Range<Number>& _range ) const {
+		std::vector<carl::Interval<Number>> intervals;
+		for ( const auto& v : mVariables ) {
+			carl::Interval<Number> I;
+			_range.find_assignment( I, v );
+			intervals.push_back( I );
+		}
+		return Box<Number>( intervals );
+	}
+
+	template<typename Number>
+	std::pair<bool, Box<Number>> ReachTaylorModel<Number>::contract( Flowpipe<Number>& _flowpipe, exponent _order, const matrix_t<Number>& _mat, const vector_t<Number>& _vec ) const {
+		TaylorModelVec<Number> tmv;
+		Domain<Number> domain;
+		_flowpipe.composition( tmv, domain, _order );
+
+		// contract the time domain: only subintervals whose range satisfies the constraints contribute.
+		carl::Interval<Number> timeDomain;
+		domain.find_assignment( timeDomain, mTime );
+		Number width = timeDomain.diameter() / Number( mTMSettings.contractionSplits );
+
+		std::pair<bool, Box<Number>> result( false, Box<Number>() );
+		for ( unsigned split = 0; split < mTMSettings.contractionSplits; ++split ) {
+			Number lower = timeDomain.lower() + width * Number( split );
+			Number upper = split + 1 == mTMSettings.contractionSplits ? timeDomain.upper() : Number( lower + width );
+			domain.assign( mTime, carl::Interval<Number>( lower, upper ) );
+
+			Range<Number> range;
+			tmv.enclosure( range, domain );
+			std::pair<bool, Box<Number>> part = toBox( range ).satisfiesHalfspaces( _mat, _vec );
+			if ( part.first ) {
+				result = result.first ? std::make_pair( true, result.second.unite( part.second ) ) : part;
+			}
+		}
+
+		return result;
+	}
+
+	template<typename Number>
+	bool ReachTaylorModel<Number>::intersectBadStates( const State<Number>& _state, const Box<Number>& _segment ) const {
+		const auto& localBadStates = mAutomaton.localBadStates( _state.location );
+		if ( !localBadStates.empty() &&
+			 _segment.satisfiesHalfspaces( localBadStates.front()->set.first, localBadStates.front()->set.second ).first ) {
+			mIntersectedBadStates = true;
+			return true;
+		}
+
+		for ( const auto& set : mAutomaton.globalBadStates() ) {
+			if ( _segment.satisfiesHalfspaces( set.first, set.second ).first ) {
+				mIntersectedBadStates = true;
+				return true;
+			}
+		}
+		return false;
+	}
+
+} // namespace reachability
+} // namespace hypro
@@ -90,7 +90,7 @@ namespace hypro {
 			if(mCurrentLevel <= mSettings.jumpDepth) {
 				State<Number> guardSatisfyingState;
 				bool locallyUrgent = false;
-				for( auto transition : _state.location->transitions() ){
+				for( auto transition : _state.location->outgoing() ){
 					// handle time-triggered transitions
 					if(transition->isTimeTriggered()){
 #ifdef REACH_DEBUG
@@ -135,7 +135,7 @@ namespace hypro {
 					// Collect potential new initial states from discrete behaviour.
 					if(mCurrentLevel < mSettings.jumpDepth) {
 						State<Number> guardSatisfyingState;
-						for( auto transition : _state.location->transitions() ){
+						for( auto transition : _state.location->outgoing() ){
 							// handle time-triggered transitions
 							if(transition->isTimeTriggered()){
 #ifdef REACH_DEBUG
@@ -230,7 +230,7 @@ namespace hypro {
 						currentState.timestamp += carl::Interval<Number>(currentLocalTime-mSettings.timeStep,currentLocalTime);
 						currentState.timestamp = currentState.timestamp.intersect(carl::Interval<Number>(Number(0), mSettings.timeBound));
 						bool fireTimeTriggeredTransition = false;
-						for( auto transition : _state.location->transitions() ){
+						for( auto transition : _state.location->outgoing() ){
 							#ifdef REACH_DEBUG
 							std::cout << "Checking transition " << transition->source()->id() << " -> " << transition->target()->id() << std::endl;
 							#endif
@@ -812,13 +812,13 @@ namespace hypro {
 
 					SupportFunction<Number> tmp =  deltaValuation;
 				    if(!errorBoxVector[1].empty()) {
-				    	SupportFunction<Number> a = SupportFunction<Number>(errorBoxVector[1].matrix(), errorBoxVector[1].vector());
+				    	SupportFunction<Number> a = Converter<Number>::toSupportFunction(errorBoxVector[1]);
 				    	tmp = deltaValuation.minkowskiSum(a);
 				    }
 					firstSegment = tmp.unite(initialPair.second);
 					Box<Number> differenceBox = errorBoxVector[2];
 					differenceBox = Number(Number(1)/Number(4)) * differenceBox;
-					firstSegment = firstSegment.minkowskiSum( SupportFunction<Number>(differenceBox.matrix(), differenceBox.vector()) );
+					firstSegment = firstSegment.minkowskiSum( Converter<Number>::toSupportFunction(differenceBox) );
 
 					/*
 					EvaluationResult<Number> errorNonlinearEvaluated;
@@ -975,14 +975,15 @@ namespace hypro {
 		bool Reach<Number,SupportFunction<Number>>::intersectBadStates( const State<Number>& _state, const SupportFunction<Number>& _segment ) const {
 			assert(!_state.timestamp.isUnbounded());
 			// check local bad states TODO: Note, we currently allow only one bad state per location -> allow multiple bad states!
-			auto badStateIterator = mAutomaton.localBadStates().find(_state.location);
-			if(badStateIterator != mAutomaton.localBadStates().end()){
+			const auto& localBadStates = mAutomaton.localBadStates(_state.location);
+			if(!localBadStates.empty()){
+				const RawState<Number>* badState = localBadStates.front();
 				// check discrete variables first -> faster.
 				for(const auto& assignmentPair : _state.discreteAssignment) {
 					// check if there is a constraint on the variable
-					if(badStateIterator->second.discreteAssignment.find(assignmentPair.first) != badStateIterator->second.discreteAssignment.end() ){
-						//std::cout << "Discrete guard: " << assignmentPair.first << " in " << badStateIterator->second.discreteAssignment.at(assignmentPair.first) << " Current assignment: " << assignmentPair.second << std::endl;
-						if(!badStateIterator->second.discreteAssignment.at(assignmentPair.first).intersectsWith(assignmentPair.second)){
+					if(badState->discreteAssignment.find(assignmentPair.first) != badState->discreteAssignment.end() ){
+						//std::cout << "Discrete guard: " << assignmentPair.first << " in " << badState->discreteAssignment.at(assignmentPair.first) << " Current assignment: " << assignmentPair.second << std::endl;
+						if(!badState->discreteAssignment.at(assignmentPair.first).intersectsWith(assignmentPair.second)){
 							// If one intersection is empty, the whole set does not intersect -> return false.
 							return false;
 						}
@@ -993,7 +994,7 @@ namespace hypro {
 				std::cout << "Intersection with local, discrete bad states" << std::endl;
 #endif
 				// at this point all discrete bad states were already satisfied -> check continuous bad states.
-				if(_segment.satisfiesHalfspaces(badStateIterator->second.set.first, badStateIterator->second.set.second).first == true){
+				if(_segment.satisfiesHalfspaces(badState->set.first, badState->set.second).first == true){
 #ifdef REACH_DEBUG
 					std::cout << "Intersection with all local bad states" << std::endl;
 #endif
@@ -0,0 +1,204 @@
+/**
+ * Accumulation of visited states as orthogonal polyhedra, which allows to prune subsumed initial sets.
+ * @file VisitedStates.h
+ */
+
+#pragma once
+#include "../../config.h"
+#include "../../datastructures/hybridAutomata/State.h"
+#include "../../representations/GeometricObject.h"
+#include <carl/util/SFINAE.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+
+namespace hypro {
+namespace reachability {
+
+/**
+ * @brief      Class collecting the boxes visited per location in orthogonal polyhedra.
+ * @details    Orthogonal polyhedra are defined in the positive orthant, thus all boxes of a location are shifted by a
+ * common offset. The offset is enlarged, if a box reaches below the current offset. Boxes without interior do not
+ * contribute. The Boolean operations work on the grid induced by the coordinates of all boxes, whose number of cells
+ * grows with the product of the coordinates per dimension. Boxes which would lead to a grid with more than
+ * VISITED_STATES_MAX_CELLS cells or with more than VISITED_STATES_MAX_CELLS vertices are not added, such that the stored
+ * set always is a subset of the visited states, and queries beyond these limits are answered negatively.
+ * @tparam     Number  The used number type.
+ */
+template<typename Number>
+class VisitedStates {
+  private:
+	struct Entry {
+		OrthogonalPolyhedron<Number> set;
+		vector_t<Number> offset;
+	};
+
+	std::map<const Location<Number>*, Entry> mEntries;
+
+  public:
+	/**
+	 * @brief      Adds a box to the visited states of the passed location.
+	 */
+	void add( const Location<Number>* _location, const Box<Number>& _box ) {
+		if ( _box.empty() || !fullDimensional( _box ) || cornersExceedLimit( _box.dimension() ) ) {
+			return;
+		}
+		auto lower = _box.limits().first.rawCoordinates();
+		auto upper = _box.limits().second.rawCoordinates();
+		auto entryIt = mEntries.find( _location );
+		if ( entryIt == mEntries.end() ) {
+			entryIt = mEntries.emplace( _location, Entry{OrthogonalPolyhedron<Number>(), vector_t<Number>( vector_t<Number>::Ones( lower.rows() ) - lower )} ).first;
+		}
+		Entry& entry = entryIt->second;
+		assert( entry.offset.rows() == lower.rows() );
+		if ( !entry.set.empty() &&
+			 cellCount( entry, vector_t<Number>( lower + entry.offset ), vector_t<Number>( upper + entry.offset ) ) > VISITED_STATES_MAX_CELLS ) {
+			return;
+		}
+
+		// enlarge the offset by the width of the box, if the box reaches below the positive orthant.
+		vector_t<Number> offset = entry.offset;
+		for ( unsigned d = 0; d < lower.rows(); ++d ) {
+			if ( lower( d ) + offset( d ) < Number( 1 ) ) {
+				offset( d ) = Number( 1 ) - lower( d ) + ( upper( d ) - lower( d ) );
+			}
+		}
+		if ( offset != entry.offset ) {
+			std::vector<Vertex<Number>> shifted;
+			for ( const auto& vertex : entry.set.vertices() ) {
+				shifted.emplace_back( Point<Number>( vector_t<Number>( vertex.point().rawCoordinates() + offset - entry.offset ) ), vertex.color() );
+			}
+			entry.set = shifted.empty() ? OrthogonalPolyhedron<Number>() : OrthogonalPolyhedron<Number>( shifted );
+			entry.offset = offset;
+		}
+
+		entry.set = entry.set.unite( toPolyhedron( vector_t<Number>( lower + offset ), vector_t<Number>( upper + offset ) ) );
+	}
+
+	/**
+	 * @brief      Checks whether the passed box is contained in the visited states of the passed location.
+	 * @details    Dimensions in which the box is flat are checked against the closure of the visited states, i.e. a facet
+	 * is contained, if one of its adjacent cells is visited.
+	 */
+	bool contains( const Location<Number>* _location, const Box<Number>& _box ) const {
+		if ( _box.empty() ) {
+			return true;
+		}
+		auto entryIt = mEntries.find( _location );
+		if ( entryIt == mEntries.end() || entryIt->second.set.empty() ) {
+			return false;
+		}
+		const Entry& entry = entryIt->second;
+		assert( entry.offset.rows() == _box.limits().first.rawCoordinates().rows() );
+		if ( cornersExceedLimit( _box.dimension() ) ) {
+			return false;
+		}
+		vector_t<Number> lower = _box.limits().first.rawCoordinates() + entry.offset;
+		vector_t<Number> upper = _box.limits().second.rawCoordinates() + entry.offset;
+		std::vector<std::size_t> flat;
+		for ( unsigned d = 0; d < lower.rows(); ++d ) {
+			if ( lower( d ) < Number( 1 ) ) {
+				return false;
+			}
+			if ( lower( d ) == upper( d ) ) {
+				// widen up to the next coordinate of the visited states, such that exactly one cell is selected.
+				std::vector<Number> coordinates = entry.set.grid().inducedDimensionAt( d );
+				auto next = std::upper_bound( coordinates.begin(), coordinates.end(), lower( d ) );
+				upper( d ) = next == coordinates.end() ? Number( lower( d ) + 1 ) : *next;
+				flat.push_back( d );
+			}
+		}
+
+		if ( cellCount( entry, lower, upper ) > VISITED_STATES_MAX_CELLS ) {
+			return false;
+		}
+
+		OrthogonalPolyhedron<Number> query = toPolyhedron( lower, upper );
+		GridSweep<Number> sweep( entry.set.grid(), query.grid() );
+		typename GridSweep<Number>::bits visited = sweep.colors( entry.set.grid() );
+		for ( std::size_t d : flat ) {
+			sweep.dilate( visited, d );
+		}
+		sweep.complement( visited );
+		return GridSweep<Number>::disjoint( visited, sweep.colors( query.grid() ) );
+	}
+
+	void clear() { mEntries.clear(); }
+
+  private:
+	static bool fullDimensional( const Box<Number>& _box ) {
+		for ( unsigned d = 0; d < _box.dimension(); ++d ) {
+			if ( _box.limits().first.at( d ) == _box.limits().second.at( d ) ) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// a box has 2^d vertices, which are enumerated when it is converted to an orthogonal polyhedron.
+	static bool cornersExceedLimit( std::size_t dimension ) {
+		return dimension >= std::size_t( std::numeric_limits<std::size_t>::digits ) ||
+			   ( std::size_t( 1 ) << dimension ) > VISITED_STATES_MAX_CELLS;
+	}
+
+	// the number of cells of the grid induced by the visited states and the passed shifted box, saturated beyond the limit.
+	static std::uint64_t cellCount( const Entry& entry, const vector_t<Number>& lower, const vector_t<Number>& upper ) {
+		std::uint64_t count = 1;
+		for ( unsigned d = 0; d < lower.rows(); ++d ) {
+			std::vector<Number> coordinates = entry.set.grid().inducedDimensionAt( d );
+			std::uint64_t extent = coordinates.size();
+			extent += std::binary_search( coordinates.begin(), coordinates.end(), lower( d ) ) ? 0 : 1;
+			extent += std::binary_search( coordinates.begin(), coordinates.end(), upper( d ) ) ? 0 : 1;
+			if ( extent > VISITED_STATES_MAX_CELLS / count ) {
+				return VISITED_STATES_MAX_CELLS + 1;
+			}
+			count *= extent;
+		}
+		return count;
+	}
+
+	// the lower corner is the only black vertex of a box.
+	static OrthogonalPolyhedron<Number> toPolyhedron( const vector_t<Number>& lower, const vector_t<Number>& upper ) {
+		std::vector<Vertex<Number>> corners;
+		std::size_t cornerCount = std::size_t( 1 ) << lower.rows();
+		for ( std::size_t corner = 0; corner < cornerCount; ++corner ) {
+			vector_t<Number> coordinates = lower;
+			for ( unsigned d = 0; d < lower.rows(); ++d ) {
+				if ( ( corner >> d ) & 1 ) {
+					coordinates( d ) = upper( d );
+				}
+			}
+			corners.emplace_back( Point<Number>( coordinates ), corner == 0 );
+		}
+		return OrthogonalPolyhedron<Number>( corners );
+	}
+};
+
+/**
+ * @brief      Adds the set of the passed state to the visited states. Only boxes are accumulated.
+ */
+template<typename Number, typename Representation, carl::DisableIf< std::is_same<Representation, Box<Number>> > = carl::dummy>
+void addVisited( VisitedStates<Number>&, const State<Number>& ) {
+}
+
+template<typename Number, typename Representation, carl::EnableIf< std::is_same<Representation, Box<Number>> > = carl::dummy>
+void addVisited( VisitedStates<Number>& _visited, const State<Number>& _state ) {
+	_visited.add( _state.location, boost::get<Box<Number>>( _state.set ) );
+}
+
+/**
+ * @brief      Returns true, if the set of the passed state is known to be visited. Only boxes are accumulated.
+ */
+template<typename Number, typename Representation, carl::DisableIf< std::is_same<Representation, Box<Number>> > = carl::dummy>
+bool isVisited( const VisitedStates<Number>&, const State<Number>& ) {
+	return false;
+}
+
+template<typename Number, typename Representation, carl::EnableIf< std::is_same<Representation, Box<Number>> > = carl::dummy>
+bool isVisited( const VisitedStates<Number>& _visited, const State<Number>& _state ) {
+	return _visited.contains( _state.location, boost::get<Box<Number>>( _state.set ) );
+}
+
+}  // namespace reachability
+}  // namespace hypro
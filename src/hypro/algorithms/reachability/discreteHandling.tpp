@@ -41,6 +41,9 @@ namespace reachability {
 				State<Number> s = boost::get<1>(tuple);
 				assert(!s.timestamp.isUnbounded());
 				s.location = boost::get<0>(tuple)->target();
+				if(isVisited<Number,Representation>(mVisitedStates, s)){
+					continue;
+				}
 				bool duplicate = false;
 				for(const auto stateTuple : mWorkingQueue) {
 					if(boost::get<1>(stateTuple) == s){
@@ -122,6 +125,11 @@ namespace reachability {
 				continue;
 			}
 
+			// skip sets which are subsumed by already processed initial sets.
+			if(isVisited<Number,Representation>(mVisitedStates, s)){
+				continue;
+			}
+
 			// find duplicate entries in work queue.
 			bool duplicate = false;
 			for(const auto stateTuple : mWorkingQueue) {
@@ -140,10 +148,14 @@ namespace reachability {
 	}
 
 	template<typename Number, typename Representation>
-	bool Reach<Number,Representation>::checkTransitions(const State<Number>& state, const carl::Interval<Number>& , std::vector<boost::tuple<Transition<Number>*, State<Number>>>& nextInitialSets) const {
+	bool Reach<Number,Representation>::checkTransitions(const State<Number>& state, const carl::Interval<Number>& , std::vector<boost::tuple<Transition<Number>*, State<Number>>>& nextInitialSets, IntervalHull<Number>* _hull) const {
 		State<Number> guardSatisfyingState;
 		bool transitionEnabled = false;
-		for( auto transition : state.location->transitions() ){
+		for( auto transition : state.location->outgoing() ){
+			// skip guards which are obviously not satisfied.
+			if(_hull != nullptr && rejectedByHull(boost::get<Representation>(state.set), *_hull, transition->guard().mat, transition->guard().vec)){
+				continue;
+			}
 			// handle time-triggered transitions
 			if(intersectGuard(transition, state, guardSatisfyingState)){
 				//std::cout << "hybrid transition enabled" << std::endl;
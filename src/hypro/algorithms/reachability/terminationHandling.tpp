@@ -4,12 +4,14 @@ namespace hypro {
 namespace reachability {
 
 	template<typename Number, typename Representation>
-	bool Reach<Number,Representation>::intersectBadStates( const State<Number>& _state, const Representation& _segment ) const {
+	bool Reach<Number,Representation>::intersectBadStates( const State<Number>& _state, const Representation& _segment, IntervalHull<Number>& _hull ) const {
 		assert(!_state.timestamp.isUnbounded());
 		// check local bad states TODO: Note, we currently allow only one bad state per location -> allow multiple bad states!
-		auto badStateIterator = mAutomaton.localBadStates().find(_state.location);
-		if(badStateIterator != mAutomaton.localBadStates().end()){
-			if(_segment.satisfiesHalfspaces(badStateIterator->second.set.first, badStateIterator->second.set.second).first == true){
+		const auto& localBadStates = mAutomaton.localBadStates(_state.location);
+		if(!localBadStates.empty()){
+			const RawState<Number>* badState = localBadStates.front();
+			if(!rejectedByHull(_segment, _hull, badState->set.first, badState->set.second) &&
+			   _segment.satisfiesHalfspaces(badState->set.first, badState->set.second).first == true){
 				#ifdef REACH_DEBUG
 				std::cout << "Intersection with all local bad states" << std::endl;
 				#endif
@@ -25,7 +27,7 @@ namespace reachability {
 		if(!mAutomaton.globalBadStates().empty()){
 			for(const auto& set : mAutomaton.globalBadStates() ) {
 				// bad state intersection
-				if(_segment.satisfiesHalfspaces(set.first, set.second).first){
+				if(!rejectedByHull(_segment, _hull, set.first, set.second) && _segment.satisfiesHalfspaces(set.first, set.second).first){
 					#ifdef REACH_DEBUG
 					std::cout << "Intersection with global bad states" << std::endl;
 					#endif
@@ -37,5 +39,25 @@ namespace reachability {
 		return false;
 	}
 
+	template<typename Number, typename Representation>
+	bool Reach<Number,Representation>::rejectedByHull( const Representation& _segment, IntervalHull<Number>& _hull, const matrix_t<Number>& _mat, const vector_t<Number>& _vec ) const {
+		// a trivially satisfied set of constraints cannot be rejected and other representations would require a full conversion.
+		if(_mat.rows() == 0 || !providesIntervalHull<Number,Representation>::value) {
+			return false;
+		}
+		if(!_hull.valid()) {
+			_hull = computeIntervalHull<Number>(_segment);
+		}
+		if(_hull.separatedFrom(_mat, _vec)) {
+			return true;
+		}
+		// a propagated hull may be too coarse due to wrapping, refine it once per segment.
+		if(_hull.valid() && !_hull.exact()) {
+			_hull = computeIntervalHull<Number>(_segment);
+			return _hull.separatedFrom(_mat, _vec);
+		}
+		return false;
+	}
+
 } // namespace reachability
 } // namespace hypro
@@ -58,6 +58,32 @@ static const long POS_CONSTANT = 100; //!< @brief Some required positive constan
 
 static const unsigned SF_CACHE_SIZE = 200; //!< @brief
 
+static const unsigned SF_PARALLEL_MIN_CHUNK_SIZE = 16; //!< @brief The minimal number of directions evaluated per thread in parallel support function evaluation.
+
+static const unsigned SF_LINTRAFO_FOLD_MAX_DIMENSION = 64; //!< @brief The maximal dimension up to which successive linear transformations of support functions are composed into a single node.
+
+static const double SF_LINTRAFO_FOLD_MAX_COEFFICIENT = 1e8; //!< @brief The maximal absolute coefficient of a composed linear transformation, larger values keep the transformations separate.
+
+static const double VERTEX_ENUMERATION_TOLERANCE = 1e-10; //!< @brief The tolerance for sign tests on normalized values in floating point vertex enumeration.
+
+static const double CONVEX_HULL_FILTER_TOLERANCE = 1e-9; //!< @brief The relative width of the band around a hyperplane in which floating point visibility tests of the convex hull computation are decided in exact arithmetic.
+
+static const unsigned CONVEX_HULL_PARALLEL_MIN_POINTS = 1024; //!< @brief The minimal number of conflict points partitioned per thread in the parallel convex hull computation.
+
+static const unsigned VPOLYTOPE_REDUNDANCY_MIN_CHUNK_SIZE = 16; //!< @brief The minimal number of candidate vertices checked per thread in parallel redundancy removal of V-polytopes.
+
+static const unsigned TAYLOR_MODEL_PARALLEL_MIN_COMPONENTS = 4; //!< @brief The minimal number of ODE components for which the components of a dense Picard operation are computed in parallel.
+
+static const std::size_t LOCATION_POOL_CHUNK_SIZE = 64; //!< @brief The number of locations allocated at once by the LocationManager if no storage has been reserved.
+
+static const std::size_t TRANSITION_POOL_CHUNK_SIZE = 64; //!< @brief The number of transitions allocated at once by the TransitionManager if no storage has been reserved.
+
+static const unsigned long VISITED_STATES_MAX_CELLS = 1ul << 20; //!< @brief The maximal number of cells of the grid induced by the visited boxes of a location, beyond which no boxes are added and no containment is checked.
+
+static const unsigned long GRID_DENSE_COLOR_LIMIT = 1ul << 26; //!< @brief The maximal number of points of an induced grid for which vertex colors are stored densely, larger grids use a hash map.
+
+static const unsigned POINT_INLINE_DIMENSION = 8; //!< @brief The maximal dimension of points whose coordinates are stored inside the point object instead of on the heap.
+
 /** Enables debug output for Fukudas Minkowski-Sum algorithm. */
 //#define fukuda_DEBUG
 
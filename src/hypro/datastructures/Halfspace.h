@@ -235,7 +235,7 @@ class Halfspace {
 	 * @param[in]  _vector  The point.
 	 * @return     True, if it is contained, false otherwise.
 	 */
-	bool contains( const Point<Number> _vector ) const;
+	bool contains( const Point<Number>& _vector ) const;
 
 	/**
 	 * @brief      Determines, whether the given set of points is contained inside the halfspace.
@@ -133,7 +133,9 @@ bool Halfspace<Number>::intersection( Number &_result, const vector_t<Number> &_
 
 template <typename Number>
 bool Halfspace<Number>::intersection( Number &_result, const Point<Number> &_vector ) const {
-	return intersection( _result, _vector.rawCoordinates() );
+	Number dotProduct = mNormal.dot( _vector.rawCoordinates() );
+	_result = dotProduct != 0 ? Number( mScalar / dotProduct ) : Number( 0 );
+	return dotProduct != 0;
 }
 
 template<typename Number>
@@ -299,8 +301,8 @@ bool Halfspace<Number>::contains( const vector_t<Number> _vector ) const {
 }
 
 template <typename Number>
-bool Halfspace<Number>::contains( const Point<Number> _vector ) const {
-	return this->contains(_vector.rawCoordinates());
+bool Halfspace<Number>::contains( const Point<Number>& _vector ) const {
+	return ( _vector.rawCoordinates().dot( mNormal ) <= mScalar );
 }
 
 template<typename Number>
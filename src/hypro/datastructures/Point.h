@@ -10,7 +10,10 @@
 #include "../types.h"
 #include "../config.h"
 #include "../util/VariablePool.h"
+#include <algorithm>
+#include <new>
 #include <set>
+#include <type_traits>
 #include <vector>
 
 namespace hypro {
@@ -18,7 +21,10 @@ namespace hypro {
 /**
  * @brief      Class for a point.
  * @details    The point class is the basis for all implementation. It consists of a vector
- * of coordinates which forms a point in a n-dimensional space.
+ * of coordinates which forms a point in a n-dimensional space. As vertex-based representations create many points, a
+ * point only holds its coordinates and a cached hash value and has no virtual functions. The coordinates of points of
+ * dimension up to POINT_INLINE_DIMENSION are stored inside the object, larger points allocate them on the heap. In both
+ * cases they are accessed as an Eigen map, i.e. without copying.
  * @tparam     Number  The used number type.
  */
 template <class Number>
@@ -26,15 +32,15 @@ class Point {
   public:
 	using pointSet = std::set<Point<Number>>;
 	using coordinateMap = std::map<carl::Variable, Number>;
+	using coordinateView = Eigen::Map<const vector_t<Number>>;
 
   private:
-	vector_t<Number> mCoordinates;
-	mutable std::size_t mHash;
+	using Storage = typename std::aligned_storage<sizeof( Number ), alignof( Number )>::type;
 
-	// Adjacency List of this Point (if applicable)
-	// std::vector<Point<Number>> mNeighbors;
-	// Minkowsi Decompositon of this point (if applicable)
-	std::vector<Point<Number>> mComposedOf;
+	Number* mData;  // points to mInline for up to POINT_INLINE_DIMENSION coordinates
+	unsigned mDimension;
+	mutable std::size_t mHash;  // 0 marks a hash which is not yet computed
+	Storage mInline[POINT_INLINE_DIMENSION];
 
   public:
 	static const int POINT_RAND_MAX = 100;
@@ -63,16 +69,14 @@ class Point {
 	explicit Point( std::vector<Number> _coordinates );
 
 	/**
-	 * @brief      Constructor from the internal vector type.
+	 * @brief      Constructor from a vector or a vector-valued Eigen expression.
 	 * @param[in]  _vector  The vector.
 	 */
-	explicit Point( const vector_t<Number>& _vector );
-
-	/**
-	 * @brief      Move constructor from the internal vector type.
-	 * @param[in]  _vector  The vector.
-	 */
-	explicit Point( vector_t<Number>&& _vector );
+	template <typename Derived>
+	explicit Point( const Eigen::MatrixBase<Derived>& _vector ) : mData( inlineData() ), mDimension( 0 ), mHash( 0 ) {
+		allocate( unsigned( _vector.size() ) );
+		Eigen::Map<vector_t<Number>>( mData, mDimension ) = _vector;
+	}
 
 	/**
 	 * @brief      Copy constructor.
@@ -90,26 +94,30 @@ class Point {
 	 * @brief 	Copy constructor with number type conversion.
 	 */
 	template <typename F, carl::DisableIf<std::is_same<F, Number>> = carl::dummy>
-	explicit Point( const Point<F>& _p ) {
-		mCoordinates = vector_t<Number>( _p.coordinates().size() );
+	explicit Point( const Point<F>& _p ) : mData( inlineData() ), mDimension( 0 ), mHash( 0 ) {
+		allocate( _p.dimension() );
 		for ( unsigned pos = 0; pos < _p.dimension(); ++pos ) {
-			mCoordinates( pos ) = Number( _p.at( pos ) );
+			mData[pos] = Number( _p.at( pos ) );
 		}
-		mHash = 0;
 	}
 
 	/**
 	 * @brief      Destroys the object.
 	 */
-	virtual ~Point() {}
+	~Point() { release(); }
 
 	/**
 	 * @brief      Hash function.
+	 * @details    The hash equals the hash of the coordinates as vector_t, which e.g. PointHashSet relies on.
 	 * @return     The hash.
 	 */
 	std::size_t hash() const {
 		if(mHash == 0) {
-			mHash = std::hash<vector_t<Number>>()(mCoordinates);
+			std::size_t seed = 0;
+			for ( unsigned i = 0; i < mDimension; ++i ) {
+				carl::hash_add( seed, std::hash<Number>()( mData[i] ) );
+			}
+			mHash = seed;
 		}
 		return mHash;
 	}
@@ -119,29 +127,11 @@ class Point {
 	 * @param[in]  val   The new coordinate.
 	 */
 	void extend(const Number& val) {
-		mCoordinates.conservativeResize(mCoordinates.rows() +1);
-		mCoordinates(mCoordinates.rows()-1) = val;
-        mHash = 0;
+		resize( mDimension + 1 );
+		mData[mDimension - 1] = val;
+		mHash = 0;
 	}
 
-	/**
-	 * @brief      Returns the composing points of this point (required for Fukuda's Minkowski sum algorithm).
-	 * @return     A vector of points.
-	 */
-	std::vector<Point<Number>> composedOf() const;
-
-	/**
-	 * @brief      Sets the composition.
-	 * @param[in]  _elements  The elements which compose this point.
-	 */
-	void setComposition( const std::vector<Point<Number>>& _elements );
-
-	/**
-	 * @brief      Adds a point to the composition.
-	 * @param[in]  _element  The point.
-	 */
-	void addToComposition( const Point<Number>& _element );
-
 	/**
 	 * @brief      Creates the origin point of the given space dimension.
 	 * @param[in]  _dim  The dimension.
@@ -177,9 +167,12 @@ class Point {
 
 	/**
 	 * @brief      Returns the coordinates as a vector representation.
+	 * @details    The returned map refers to the storage of the point and is invalidated, if the dimension of the
+	 * point changes. Passing it to a parameter of type const vector_t<Number>& copies the coordinates into a temporary,
+	 * frequently called code should keep the map (auto) or work on an Eigen expression instead.
 	 * @return     The coordinate vector.
 	 */
-	const vector_t<Number>& rawCoordinates() const;
+	coordinateView rawCoordinates() const { return coordinateView( mData, mDimension ); }
 
 	/**
 	 * @brief      Sets the coordinate mapped to the given variable to the given value.
@@ -324,11 +317,11 @@ class Point {
 	 * @param[in]  _p    The point.
 	 * @return     The infinity norm.
 	 */
-	static Number inftyNorm( const Point<Number> _p ) {
+	static Number inftyNorm( const Point<Number>& _p ) {
 		Number res = 0;
-		vector_t<Number> coord = _p.rawCoordinates();
 		for ( unsigned i = 0; i < _p.dimension(); ++i ) {
-			Number absolute = coord(i) < 0 ? Number(-1)*coord(i) : coord(i); // workaround for abs
+			const Number& coord = _p.at( i );
+			Number absolute = coord < 0 ? Number(-1)*coord : coord; // workaround for abs
 			res = res > absolute ? res : absolute;
 		}
 		return res;
@@ -449,14 +442,38 @@ class Point {
 	 * @param[in]  _p2   The second point.
 	 * @return     True, if for all coordinates the comparison holds.
 	 */
-	bool operator<( const Point<Number>& _p2 ) const { return ( mCoordinates < _p2.rawCoordinates() ); }
+	bool operator<( const Point<Number>& _p2 ) const {
+		if ( mDimension != _p2.dimension() ) {
+			return false;
+		}
+		for ( unsigned dim = 0; dim < mDimension; ++dim ) {
+			if ( mData[dim] > _p2.at( dim ) ) {
+				return false;
+			} else if ( mData[dim] < _p2.at( dim ) ) {
+				return true;
+			}
+		}
+		return false;
+	}
 
 	/**
 	 * @brief      Coordinate-wise comparison of two points.
 	 * @param[in]  _p2   The second point.
 	 * @return     True, if for all coordinates the comparison holds.
 	 */
-	bool operator<=( const Point<Number>& _p2 ) const { return ( mCoordinates <= _p2.rawCoordinates() ); }
+	bool operator<=( const Point<Number>& _p2 ) const {
+		if ( mDimension != _p2.dimension() ) {
+			return false;
+		}
+		for ( unsigned dim = 0; dim < mDimension; ++dim ) {
+			if ( mData[dim] > _p2.at( dim ) ) {
+				return false;
+			} else if ( mData[dim] <= _p2.at( dim ) ) {
+				return true;
+			}
+		}
+		return false;
+	}
 
 	/**
 	 * @brief      Coordinate-wise comparison of two points.
@@ -482,8 +499,12 @@ class Point {
 		if (this->hash() != _p2.hash()) {
 			return false;
 		}
-
-		return ( this->rawCoordinates() == _p2.rawCoordinates() );
+		for ( unsigned d = 0; d < mDimension; ++d ) {
+			if ( mData[d] != _p2.at( d ) ) {
+				return false;
+			}
+		}
+		return true;
 	}
 
 	/**
@@ -527,8 +548,20 @@ class Point {
 	Point<Number>& operator*=( const Number _factor );
 	Point<Number>& operator=( const Point<Number>& _in );
 	Point<Number>& operator=( Point<Number>&& _in );
-	Point<Number>& operator=( const vector_t<Number>& _in );
-	Point<Number>& operator=( vector_t<Number>&& _in );
+	template <typename Derived>
+	Point<Number>& operator=( const Eigen::MatrixBase<Derived>& _in ) {
+		if ( unsigned( _in.size() ) == mDimension ) {
+			Eigen::Map<vector_t<Number>>( mData, mDimension ) = _in;
+		} else {
+			// the expression may refer to the current coordinates, which are released before the new ones are written.
+			vector_t<Number> coordinates = _in;
+			release();
+			allocate( unsigned( coordinates.rows() ) );
+			Eigen::Map<vector_t<Number>>( mData, mDimension ) = coordinates;
+		}
+		mHash = 0;
+		return *this;
+	}
 	//@}
 
 	//@{
@@ -563,7 +596,27 @@ class Point {
 	/**
 	 * @brief      Conversion operator to the internal vector type.
 	 */
-	explicit operator vector_t<Number>() const { return mCoordinates; }
+	explicit operator vector_t<Number>() const { return rawCoordinates(); }
+
+  private:
+	Number* inlineData() { return reinterpret_cast<Number*>( mInline ); }
+	bool isInline() const { return mData == reinterpret_cast<const Number*>( mInline ); }
+
+	/**
+	 * @brief      Provides storage for the passed number of coordinates, which are initialized to zero.
+	 * @details    Requires the point to hold no coordinates.
+	 */
+	void allocate( unsigned _dimension );
+
+	/**
+	 * @brief      Destroys the coordinates and frees heap storage, afterwards the point has dimension zero.
+	 */
+	void release();
+
+	/**
+	 * @brief      Changes the dimension, retained coordinates keep their values and new ones are zero.
+	 */
+	void resize( unsigned _dimension );
 };
 
 /**
@@ -588,54 +641,36 @@ void swap( Point<Number>& _lhs, Point<Number>& _rhs ) {
 template <typename Number>
 const Point<Number> operator+( const Point<Number>& _lhs, const Point<Number>& _rhs ) {
 	assert( _lhs.dimension() == _rhs.dimension() );
-	vector_t<Number> resCoord = vector_t<Number>( _lhs.dimension() );
-	vector_t<Number> p1Coord = _lhs.rawCoordinates();
-	vector_t<Number> p2Coord = _rhs.rawCoordinates();
-	resCoord = p1Coord + p2Coord;
-	return Point<Number>( resCoord );
+	return Point<Number>( _lhs.rawCoordinates() + _rhs.rawCoordinates() );
 }
 
 template <typename Number>
 const Point<Number> operator+( const Point<Number>& _lhs, const vector_t<Number>& _rhs ) {
 	assert( _lhs.dimension() == _rhs.rows() );
-	vector_t<Number> resCoord = vector_t<Number>( _lhs.dimension() );
-	vector_t<Number> p1Coord = _lhs.rawCoordinates();
-	resCoord = p1Coord + _rhs;
-	return Point<Number>( resCoord );
+	return Point<Number>( _lhs.rawCoordinates() + _rhs );
 }
 
 template <typename Number>
 const Point<Number> operator-( const Point<Number>& _lhs, const Point<Number>& _rhs ) {
 	assert( _lhs.dimension() == _rhs.dimension() );
-	vector_t<Number> resCoord = vector_t<Number>( _lhs.dimension() );
-	vector_t<Number> p1Coord = _lhs.rawCoordinates();
-	vector_t<Number> p2Coord = _rhs.rawCoordinates();
-	resCoord = p1Coord - p2Coord;
-	return Point<Number>( resCoord );
+	return Point<Number>( _lhs.rawCoordinates() - _rhs.rawCoordinates() );
 }
 
 template <typename Number>
 const Point<Number> operator/( const Point<Number>& _lhs, unsigned _quotient ) {
-	vector_t<Number> resCoord = vector_t<Number>( _lhs.dimension() );
-	vector_t<Number> p1Coord = _lhs.rawCoordinates();
-	resCoord = p1Coord / _quotient;
-	return Point<Number>( resCoord );
+	Point<Number> result = _lhs;
+	result /= _quotient;
+	return result;
 }
 
 template <typename Number>
 Number operator*( const Point<Number>& _lhs, const Point<Number>& _rhs ) {
-	vector_t<Number> p1Coord = _lhs.rawCoordinates();
-	vector_t<Number> p2Coord = _rhs.rawCoordinates();
-	;
-	return p1Coord.dot( p2Coord );
+	return _lhs.rawCoordinates().dot( _rhs.rawCoordinates() );
 }
 
 template <typename Number>
 const Point<Number> operator*( const Point<Number>& _lhs, const Number& _factor ) {
-	vector_t<Number> resCoord = vector_t<Number>( _lhs.dimension() );
-	vector_t<Number> p1Coord = _lhs.rawCoordinates();
-	resCoord = p1Coord * _factor;
-	return Point<Number>( resCoord );
+	return Point<Number>( _lhs.rawCoordinates() * _factor );
 }
 
 template <typename Number>
@@ -716,7 +751,7 @@ namespace std{
     struct hash<hypro::Point<Number>> {
         std::size_t operator()(hypro::Point<Number> const& point) const
         {
-            return std::hash<hypro::vector_t<Number>>()(point.rawCoordinates());
+            return point.hash();
         }
     };
 } //namespace std
@@ -4,162 +4,72 @@ namespace hypro {
 
 template <typename Number>
 Point<Number>::Point()
-	: mCoordinates( vector_t<Number>::Zero( 0 ) ),
-	mHash(0),
-	// mNeighbors(),
-	mComposedOf() {
+	: mData( inlineData() ),
+	mDimension( 0 ),
+	mHash(0) {
 	assert(this->dimension() == 0);
 }
 
 template <typename Number>
 Point<Number>::Point( const Number &_value )
-	:  // mNeighbors(),
-	mHash(0),
-	mComposedOf() {
-	mCoordinates = vector_t<Number>( 1 );
-	mCoordinates( 0 ) = _value;
-	assert(this->dimension() >= 0);
+	: mData( inlineData() ),
+	mDimension( 0 ),
+	mHash(0) {
+	allocate( 1 );
+	mData[0] = _value;
 }
 
 template <typename Number>
 Point<Number>::Point( std::initializer_list<Number> _coordinates )
-	:  // mNeighbors(),
-	mHash(0),
-	mComposedOf()
-	{
+	: mData( inlineData() ),
+	mDimension( 0 ),
+	mHash(0) {
+	allocate( unsigned( _coordinates.size() ) );
 	unsigned count = 0;
-	mCoordinates = vector_t<Number>( _coordinates.size() );
 	for ( auto &coordinate : _coordinates ) {
-		mCoordinates( count ) = Number( coordinate );
+		mData[count] = Number( coordinate );
 		++count;
 	}
-	assert(this->dimension() >= 0);
 }
 
 template <typename Number>
 Point<Number>::Point( std::vector<Number> _coordinates )
-	:  // mNeighbors(),
-	mHash(0),
-	mComposedOf() {
-	unsigned count = 0;
-	mCoordinates = vector_t<Number>( _coordinates.size() );
-	for ( unsigned j = 0; j < _coordinates.size(); ++j ) {
-		mCoordinates( count ) = _coordinates.at( count );
-		++count;
+	: mData( inlineData() ),
+	mDimension( 0 ),
+	mHash(0) {
+	allocate( unsigned( _coordinates.size() ) );
+	for ( unsigned pos = 0; pos < _coordinates.size(); ++pos ) {
+		mData[pos] = std::move( _coordinates[pos] );
 	}
-	assert(this->dimension() >= 0);
-}
-
-template <typename Number>
-Point<Number>::Point( const vector_t<Number> &_vector )
-	: mCoordinates( _vector ),
-	mHash(0),
-	// mNeighbors(),
-	mComposedOf() {
-	assert(this->dimension() >= 0);
-}
-
-template <typename Number>
-Point<Number>::Point( vector_t<Number>&& _vector )
-	: mCoordinates( _vector ),
-	mHash(0),
-	mComposedOf() {
-	assert(this->dimension() >= 0);
 }
 
 template <typename Number>
 Point<Number>::Point( const Point<Number> &_p )
-	: mCoordinates( _p.rawCoordinates() ),
-	mHash(0),
-	// mNeighbors(_p.neighbors()),
-	mComposedOf( _p.composedOf() ) {
-	//std::cout << "This coordinates " << mCoordinates << " vs. " << _p.rawCoordinates() << std::endl;
-  	//std::cout << "This hash " << this->hash() << " vs. " << std::endl;
-  	//std::cout << _p.hash() << std::endl;
-  	assert(_p.hash() == this->hash());
-  	assert(this->dimension() >= 0);
+	: mData( inlineData() ),
+	mDimension( 0 ),
+	mHash( _p.mHash ) {
+	allocate( _p.mDimension );
+	std::copy( _p.mData, _p.mData + _p.mDimension, mData );
+	assert(_p.hash() == this->hash());
 }
 
 template <typename Number>
 Point<Number>::Point( Point<Number> &&_p )
-	: mCoordinates( _p.rawCoordinates() ),
-	mHash(0),
-	// mNeighbors(std::move(_p.neighbors())),
-	mComposedOf( std::move( _p.composedOf() ) ) {
-	assert(this->dimension() >= 0);
-}
-
-/*
-template<typename Number>
-std::vector<Point<Number>> Point<Number>::neighbors() const {
-		return mNeighbors;
-}
-
-template<typename Number>
-void Point<Number>::setNeighbors(const std::vector<Point<Number> >& _neighbors)
-{
-		mNeighbors = _neighbors;
-}
-
-template<typename Number>
-void Point<Number>::joinNeighbors(const std::vector<Point<Number> >& _neighbors)
-{
-		for(unsigned i = 0; i<_neighbors.size(); i++){
-				if(!isNeighbor(_neighbors.at(i))){
-						addNeighbor(_neighbors.at(i));
-				}
-		}
-}
-
-template<typename Number>
-void Point<Number>::addNeighbor(const Point<Number>& _neighbor) {
-		bool alreadyNeighbor = false;
-		for(unsigned i = 0; i< mNeighbors.size(); i++) {
-				if(mNeighbors.at(i) == _neighbor){
-						alreadyNeighbor = true;
-				}
-		}
-		if(!alreadyNeighbor) {
-				mNeighbors.push_back(_neighbor);
-		}
-}
-
-template<typename Number>
-bool Point<Number>::isNeighbor(const Point<Number>& _neighbor) {
-		for(unsigned i = 0; i< mNeighbors.size(); i++) {
-				if(mNeighbors.at(i) == _neighbor){
-						return true;
-				}
-		}
-		return false;
-}
-
-template<typename Number>
-void Point<Number>::removeNeighbor(const Point<Number>& _neighbor) {
-		for(unsigned i = 0; i < mNeighbors.size(); i++){
-				if((mNeighbors.at(i)) == (_neighbor)) {
-						mNeighbors.erase(mNeighbors.begin() + i);
-						break;
-				}
-		}
-}
-*/
-
-template <typename Number>
-std::vector<Point<Number>> Point<Number>::composedOf() const {
-	return mComposedOf;
-}
-
-template <typename Number>
-void Point<Number>::setComposition( const std::vector<Point<Number>> &_elements ) {
-	mComposedOf = _elements;
-	mHash = 0;
-}
-
-template <typename Number>
-void Point<Number>::addToComposition( const Point<Number> &_element ) {
-	mComposedOf.push_back( _element );
-	mHash = 0;
+	: mData( inlineData() ),
+	mDimension( 0 ),
+	mHash( _p.mHash ) {
+	if ( _p.isInline() ) {
+		allocate( _p.mDimension );
+		std::move( _p.mData, _p.mData + _p.mDimension, mData );
+		_p.release();
+	} else {
+		// heap storage is handed over.
+		mData = _p.mData;
+		mDimension = _p.mDimension;
+		_p.mData = _p.inlineData();
+		_p.mDimension = 0;
+	}
+	_p.mHash = 0;
 }
 
 template <typename Number>
@@ -171,73 +81,63 @@ Point<Number> Point<Number>::origin() const {
 
 template <typename Number>
 Number Point<Number>::coordinate( const carl::Variable &_var ) const {
-	return mCoordinates( hypro::VariablePool::getInstance().id( _var ) );
+	return at( _var );
 }
 
 template <typename Number>
 Number Point<Number>::coordinate( unsigned _dimension ) const {
-	assert( mCoordinates.size() > _dimension );
-	return mCoordinates( _dimension );
+	return at( _dimension );
 }
 
 template <typename Number>
 typename Point<Number>::coordinateMap Point<Number>::coordinates() const {
 	coordinateMap res;
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		res.insert( std::make_pair( hypro::VariablePool::getInstance().carlVarByIndex( i ), mCoordinates( i ) ) );
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		res.insert( std::make_pair( hypro::VariablePool::getInstance().carlVarByIndex( i ), mData[i] ) );
 	}
 	return res;
 }
 
-template <typename Number>
-const vector_t<Number> &Point<Number>::rawCoordinates() const {
-	return mCoordinates;
-}
-
 template <typename Number>
 void Point<Number>::setCoordinate( const carl::Variable &_dim, const Number &_value ) {
 	unsigned dim = hypro::VariablePool::getInstance().id( _dim );
-	assert( dim >= 0 );
-	if ( dim >= mCoordinates.rows() ) {
-		vector_t<Number> old = mCoordinates;
-		mCoordinates.resize( dim + 1 );
-		mCoordinates.topLeftCorner( old.rows(), 1 ) = old;
+	if ( dim >= mDimension ) {
+		resize( dim + 1 );
 	}
-	mCoordinates( dim ) = _value;
+	mData[dim] = _value;
 	mHash = 0;
 }
 
 template <typename Number>
 void Point<Number>::swap( Point<Number> &_rhs ) {
-	this->mCoordinates = _rhs.mCoordinates;  // we cannot swap FLOAT_T yet, at
-											 // least not with mpfr_t instantiation
-	// std::swap(this->mNeighbors, _rhs.mNeighbors);
-	std::swap( this->mComposedOf, _rhs.mComposedOf );
-	_rhs.mHash = 0;
-	mHash = 0;
+	if ( !this->isInline() && !_rhs.isInline() ) {
+		// swaps the heap storage, the coefficients themselves are not touched.
+		std::swap( this->mData, _rhs.mData );
+		std::swap( this->mDimension, _rhs.mDimension );
+		std::swap( this->mHash, _rhs.mHash );
+		return;
+	}
+	Point<Number> tmp( std::move( _rhs ) );
+	_rhs = std::move( *this );
+	*this = std::move( tmp );
 }
 
 template <typename Number>
 void Point<Number>::setCoordinates( const vector_t<Number> &vector ) {
-	mCoordinates = vector;
-	mHash = 0;
+	*this = vector;
 }
 
 template <typename Number>
 unsigned Point<Number>::dimension() const {
-	return mCoordinates.rows();
+	return mDimension;
 }
 
 template <typename Number>
 void Point<Number>::reduceDimension( unsigned _dimension ) {
-	if ( _dimension < mCoordinates.rows() ) {
-		vector_t<Number> newCoordinates = vector_t<Number>( _dimension );
-		for ( unsigned pos = 0; pos < _dimension; ++pos ) {
-			newCoordinates( pos ) = mCoordinates( pos );
-		}
-		mCoordinates = newCoordinates;
+	if ( _dimension < mDimension ) {
+		resize( _dimension );
 	}
-	assert( mCoordinates.rows() <= _dimension );
+	assert( mDimension <= _dimension );
 	mHash = 0;
 }
 
@@ -251,9 +151,8 @@ Point<Number> Point<Number>::reduceToDimensions( std::vector<unsigned> _dimensio
 	unsigned tPos = 0;
 	for ( const auto sPos : _dimensions ) {
 		TRACE("hypro.datastructures.point","consider dimension " << sPos);
-		assert(sPos < mCoordinates.rows());
-		assert(sPos >= 0);
-		newCoordinates( tPos ) = mCoordinates( sPos );
+		assert(sPos < mDimension);
+		newCoordinates( tPos ) = mData[sPos];
 		++tPos;
 	}
 	return Point<Number>(newCoordinates);
@@ -262,7 +161,7 @@ Point<Number> Point<Number>::reduceToDimensions( std::vector<unsigned> _dimensio
 template <typename Number>
 std::vector<carl::Variable> Point<Number>::variables() const {
 	std::vector<carl::Variable> variables;
-	for ( unsigned i = 0; i != mCoordinates.rows(); ++i ) {
+	for ( unsigned i = 0; i != mDimension; ++i ) {
 		variables.push_back( hypro::VariablePool::getInstance().carlVarByIndex( i ) );
 	}
 	return variables;
@@ -270,15 +169,15 @@ std::vector<carl::Variable> Point<Number>::variables() const {
 
 template <typename Number>
 Point<Number> Point<Number>::extAdd( const Point<Number> &_rhs ) const {
-	assert( mCoordinates.rows() == _rhs.rawCoordinates().rows() );
+	assert( mDimension == _rhs.dimension() );
 
-	Point<Number> result = Point<Number>( mCoordinates + _rhs.rawCoordinates() );
+	Point<Number> result = Point<Number>( rawCoordinates() + _rhs.rawCoordinates() );
 	return result;
 }
 
 template <typename Number>
 Number Point<Number>::distance( const Point<Number> &_rhs ) const {
-	return ( norm( vector_t<Number>(mCoordinates - _rhs.rawCoordinates()) ) );
+	return ( norm( vector_t<Number>(rawCoordinates() - _rhs.rawCoordinates()) ) );
 }
 
 template <typename Number>
@@ -318,7 +217,7 @@ std::vector<Number> Point<Number>::polarCoordinates( const Point<Number> &_origi
 		}
 		result.emplace_back( std::move( carl::convert<double,Number>(angle) ) );
 	}
-	if ( ( base.mCoordinates( base.dimension() - 1 ) ) < Number( 0 ) ) {
+	if ( ( base.at( base.dimension() - 1 ) ) < Number( 0 ) ) {
 		Number tmp = result.back();
 		result.pop_back();
 		if ( !_radians ) {
@@ -348,7 +247,7 @@ Point<Number> Point<Number>::project( const std::vector<unsigned>& dimensions )
 
 	for(unsigned i = 0; i < dimensions.size(); ++i) {
 		if(dimensions.at(i) < this->dimension() && dimensions.at(i) >= 0) {
-			projectedCoordinates(i) = mCoordinates(dimensions.at(i));
+			projectedCoordinates(i) = mData[dimensions.at(i)];
 		}
 	}
 	return Point<Number>(projectedCoordinates);
@@ -357,53 +256,56 @@ Point<Number> Point<Number>::project( const std::vector<unsigned>& dimensions )
 template <typename Number>
 Point<Number> Point<Number>::linearTransformation( const matrix_t<Number> &A ) const {
 	//std::cout << "Linear trafo of " << mCoordinates << " with " << A << " and " << b << std::endl;
-	assert(A.cols() == mCoordinates.rows());
-	return Point<Number>( A * mCoordinates );
+	assert(A.cols() == mDimension);
+	return Point<Number>( A * rawCoordinates() );
 }
 
 template <typename Number>
 Point<Number> Point<Number>::affineTransformation( const matrix_t<Number> &A, const vector_t<Number> &b ) const {
 	//std::cout << "Linear trafo of " << mCoordinates << " with " << A << " and " << b << std::endl;
-	assert(A.cols() == mCoordinates.rows());
-	assert(b.rows() == mCoordinates.rows());
-	return Point<Number>( A * mCoordinates + b );
+	assert(A.cols() == mDimension);
+	assert(b.rows() == mDimension);
+	return Point<Number>( A * rawCoordinates() + b );
 }
 
 template <typename Number>
 Number Point<Number>::sum() const {
-	Number sum = mCoordinates.dot( vector_t<Number>::Ones( mCoordinates.rows() ) );
+	Number sum = 0;
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		sum += mData[i];
+	}
 	return sum;
 }
 
 template <typename Number>
 void Point<Number>::incrementInFixedDim( const carl::Variable &_d ) {
-	mCoordinates( hypro::VariablePool::getInstance().id( _d ) ) += 1;
+	mData[hypro::VariablePool::getInstance().id( _d )] += 1;
 	mHash = 0;
 }
 
 template <typename Number>
 void Point<Number>::incrementInFixedDim( unsigned _d ) {
-	mCoordinates( _d ) += Number(1);
+	mData[_d] += Number(1);
 	mHash = 0;
 }
 
 template <typename Number>
 void Point<Number>::incrementInAllDim( const Number &_val ) {
-	vector_t<Number> one = vector_t<Number>::Ones( mCoordinates.rows() );
-	one *= _val;
-	mCoordinates += one;
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] += _val;
+	}
 	mHash = 0;
 }
 
 template <typename Number>
 void Point<Number>::decrementInFixedDim( const carl::Variable &_d ) {
-	mCoordinates( hypro::VariablePool::getInstance().id( _d ) ) -= 1;
+	mData[hypro::VariablePool::getInstance().id( _d )] -= 1;
 	mHash = 0;
 }
 
 template <typename Number>
 void Point<Number>::decrementInFixedDim( unsigned _d ) {
-	mCoordinates( _d ) -= Number(1);
+	mData[_d] -= Number(1);
 	mHash = 0;
 }
 
@@ -423,12 +325,12 @@ Point<Number> Point<Number>::getPredecessorInDimension( unsigned _d ) const {
 
 template <typename Number>
 bool Point<Number>::isInBoundary( const Point<Number> &_boundary ) const {
-	return ( mCoordinates < _boundary.rawCoordinates() );
+	return ( *this < _boundary );
 }
 
 template <typename Number>
 bool Point<Number>::hasDimension( const carl::Variable &_i ) const {
-	return ( mCoordinates.rows() > hypro::VariablePool::getInstance().id( _i ) );
+	return ( mDimension > hypro::VariablePool::getInstance().id( _i ) );
 }
 
 template <typename Number>
@@ -455,8 +357,8 @@ std::vector<bool> Point<Number>::lesserDimensionPattern( const Point<Number> &_p
 template <typename Number>
 bool Point<Number>::haveEqualCoordinate( const Point<Number> &_p2 ) const {
 	if ( dimension() == _p2.dimension() ) {
-		for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-			if ( mCoordinates( i ) == _p2.rawCoordinates()( i ) ) {
+		for ( unsigned i = 0; i < mDimension; ++i ) {
+			if ( mData[i] == _p2.at( i ) ) {
 				return true;
 			}
 		}
@@ -472,8 +374,8 @@ bool Point<Number>::haveSameDimensions( const Point<Number> &_p ) const {
 template <typename Number>
 Point<Number> &Point<Number>::operator+=( const Point<Number> &_rhs ) {
 	assert( this->dimension() == _rhs.dimension() );
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		mCoordinates( i ) += _rhs.at( i );
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] += _rhs.at( i );
 	}
 	mHash = 0;
 	return *this;
@@ -482,8 +384,8 @@ Point<Number> &Point<Number>::operator+=( const Point<Number> &_rhs ) {
 template <typename Number>
 Point<Number> &Point<Number>::operator+=( const vector_t<Number> &_rhs ) {
 	assert( this->dimension() == _rhs.rows() );
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		mCoordinates( i ) += _rhs( i );
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] += _rhs( i );
 	}
 	mHash = 0;
 	return *this;
@@ -492,8 +394,8 @@ Point<Number> &Point<Number>::operator+=( const vector_t<Number> &_rhs ) {
 template <typename Number>
 Point<Number> &Point<Number>::operator-=( const Point<Number> &_rhs ) {
 	assert( this->dimension() == _rhs.dimension() );
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		mCoordinates( i ) -= _rhs.at( i );
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] -= _rhs.at( i );
 	}
 	mHash = 0;
 	return *this;
@@ -502,8 +404,8 @@ Point<Number> &Point<Number>::operator-=( const Point<Number> &_rhs ) {
 template <typename Number>
 Point<Number> &Point<Number>::operator-=( const vector_t<Number> &_rhs ) {
 	assert( this->dimension() == _rhs.rows() );
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		mCoordinates( i ) -= _rhs( i );
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] -= _rhs( i );
 	}
 	mHash = 0;
 	return *this;
@@ -511,13 +413,13 @@ Point<Number> &Point<Number>::operator-=( const vector_t<Number> &_rhs ) {
 
 template<typename Number>
 Point<Number> Point<Number>::operator-() const {
-    return Point<Number>(-mCoordinates);
+    return Point<Number>(-rawCoordinates());
 }
 
 template <typename Number>
 Point<Number> &Point<Number>::operator/=( unsigned _quotient ) {
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		mCoordinates( i ) = mCoordinates( i ) / _quotient;
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] = mData[i] / _quotient;
 	}
 	mHash = 0;
 	return *this;
@@ -525,8 +427,8 @@ Point<Number> &Point<Number>::operator/=( unsigned _quotient ) {
 
 template <typename Number>
 Point<Number> &Point<Number>::operator*=( const Number _factor ) {
-	for ( unsigned i = 0; i < mCoordinates.rows(); ++i ) {
-		mCoordinates( i ) = mCoordinates( i ) * _factor;
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i] = mData[i] * _factor;
 	}
 	mHash = 0;
 	return *this;
@@ -534,33 +436,38 @@ Point<Number> &Point<Number>::operator*=( const Number _factor ) {
 
 template <typename Number>
 Point<Number> &Point<Number>::operator=( const Point<Number> &_in ) {
-	mCoordinates = _in.rawCoordinates();
-	// this->mNeighbors = _in.neighbors();
-	mComposedOf = _in.composedOf();
-	mHash = 0;
+	if ( this != &_in ) {
+		// storage of the same size is reused.
+		if ( mDimension != _in.mDimension ) {
+			release();
+			allocate( _in.mDimension );
+		}
+		std::copy( _in.mData, _in.mData + _in.mDimension, mData );
+		mHash = _in.mHash;
+	}
 	return *this;
 }
 
 template <typename Number>
 Point<Number> &Point<Number>::operator=( Point<Number> &&_in ) {
-	mCoordinates = _in.rawCoordinates();
-	// this->mNeighbors = _in.neighbors();
-	mComposedOf = _in.composedOf();
-	mHash = 0;
-	return *this;
-}
-
-template <typename Number>
-Point<Number>& Point<Number>::operator=( const vector_t<Number>& _in ) {
-	mCoordinates = _in;
-	mHash = 0;
-	return *this;
-}
-
-template <typename Number>
-Point<Number>& Point<Number>::operator=( vector_t<Number>&& _in ) {
-	mCoordinates = std::move(_in);
-	mHash = 0;
+	if ( this != &_in ) {
+		if ( !_in.isInline() ) {
+			release();
+			mData = _in.mData;
+			mDimension = _in.mDimension;
+			_in.mData = _in.inlineData();
+			_in.mDimension = 0;
+		} else {
+			if ( mDimension != _in.mDimension ) {
+				release();
+				allocate( _in.mDimension );
+			}
+			std::move( _in.mData, _in.mData + _in.mDimension, mData );
+			_in.release();
+		}
+		mHash = _in.mHash;
+		_in.mHash = 0;
+	}
 	return *this;
 }
 
@@ -568,35 +475,66 @@ Point<Number>& Point<Number>::operator=( vector_t<Number>&& _in ) {
 template <typename Number>
 Number &Point<Number>::operator[]( const carl::Variable &_i ) {
 	unsigned dim = hypro::VariablePool::getInstance().id( _i );
-	if ( dim >= mCoordinates.rows() ) {
-		vector_t<Number> old = mCoordinates;
-		mCoordinates.resize( dim + 1 );
-		mCoordinates.topLeftCorner( old.rows(), 1 ) = old;
+	if ( dim >= mDimension ) {
+		resize( dim + 1 );
 	}
 	mHash = 0;
-	return mCoordinates( dim );
+	return mData[dim];
 }
 
 template <typename Number>
 Number &Point<Number>::operator[]( std::size_t _i ) {
-	if ( _i >= std::size_t(mCoordinates.rows()) ) {
-		vector_t<Number> old = mCoordinates;
-		mCoordinates = vector_t<Number>::Zero( _i + 1 );
-		mCoordinates.topLeftCorner( old.rows(), 1 ) = old;
+	if ( _i >= std::size_t( mDimension ) ) {
+		resize( unsigned( _i + 1 ) );
 	}
 	mHash = 0;
-	return mCoordinates( _i );
+	return mData[_i];
 }
 
 template <typename Number>
 const Number& Point<Number>::at( const carl::Variable &_i ) const {
-	assert( hypro::VariablePool::getInstance().id( _i ) < mCoordinates.rows() );
-	return mCoordinates( hypro::VariablePool::getInstance().id( _i ) );
+	assert( hypro::VariablePool::getInstance().id( _i ) < mDimension );
+	return mData[hypro::VariablePool::getInstance().id( _i )];
 }
 
 template <typename Number>
 const Number& Point<Number>::at( unsigned _index ) const {
-	assert( _index < mCoordinates.rows() );
-	return mCoordinates( _index );
+	assert( _index < mDimension );
+	return mData[_index];
+}
+
+template <typename Number>
+void Point<Number>::allocate( unsigned _dimension ) {
+	assert( mDimension == 0 && isInline() );
+	if ( _dimension > POINT_INLINE_DIMENSION ) {
+		mData = static_cast<Number*>( ::operator new( _dimension * sizeof( Number ) ) );
+	}
+	for ( unsigned i = 0; i < _dimension; ++i ) {
+		new ( mData + i ) Number( 0 );
+	}
+	mDimension = _dimension;
+}
+
+template <typename Number>
+void Point<Number>::release() {
+	for ( unsigned i = 0; i < mDimension; ++i ) {
+		mData[i].~Number();
+	}
+	if ( !isInline() ) {
+		::operator delete( mData );
+		mData = inlineData();
+	}
+	mDimension = 0;
+}
+
+template <typename Number>
+void Point<Number>::resize( unsigned _dimension ) {
+	if ( _dimension == mDimension ) {
+		return;
+	}
+	Point<Number> old( std::move( *this ) );
+	allocate( _dimension );
+	std::move( old.mData, old.mData + std::min( _dimension, old.mDimension ), mData );
+	mHash = 0;
 }
 }  // namespace hypro
@@ -0,0 +1,194 @@
+/**
+ * An open addressing hash set for points.
+ * @file   PointHashSet.h
+ */
+
+#pragma once
+
+#include "Point.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for a set of points of equal dimension, which preserves insertion order.
+ * @details    The coordinates of all points are stored contiguously in insertion order, such that each point is
+ * identified by its index. Lookup uses linear probing in a power-of-two table of indices, the hash values are stored
+ * alongside the coordinates to allow rehashing without recomputation. The used hash is the hash of the coordinate vector,
+ * thus cached hashes of points are reused.
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class PointHashSet {
+  public:
+	static const std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  private:
+	std::size_t mDimension;
+	std::vector<Number> mCoordinates;
+	std::vector<std::size_t> mHashes;
+	std::vector<std::size_t> mTable;  // index + 1 of the stored point, 0 marks empty slots
+	unsigned mShift;
+
+  public:
+	PointHashSet( std::size_t dimension = 0 ) : mDimension( dimension ), mCoordinates(), mHashes(), mTable(), mShift( 64 ) {}
+	PointHashSet( const PointHashSet<Number>& orig ) = default;
+	PointHashSet( PointHashSet<Number>&& orig ) = default;
+	~PointHashSet() {}
+
+	PointHashSet<Number>& operator=( const PointHashSet<Number>& orig ) = default;
+	PointHashSet<Number>& operator=( PointHashSet<Number>&& orig ) = default;
+
+	std::size_t dimension() const { return mDimension; }
+	std::size_t size() const { return mHashes.size(); }
+	bool empty() const { return mHashes.empty(); }
+
+	void clear() {
+		mCoordinates.clear();
+		mHashes.clear();
+		mTable.clear();
+	}
+
+	/**
+	 * @brief      Reserves space for the passed number of points.
+	 * @param[in]  count  The number of points.
+	 */
+	void reserve( std::size_t count ) {
+		mCoordinates.reserve( count * mDimension );
+		mHashes.reserve( count );
+		if ( 2 * count > mTable.size() ) {
+			rehash( 2 * count );
+		}
+	}
+
+	/**
+	 * @brief      Inserts a point, if it is not yet contained.
+	 * @param[in]  point  The point.
+	 * @return     The index of the point and true, if the point was inserted.
+	 */
+	std::pair<std::size_t, bool> insert( const Point<Number>& point ) { return insert( point.rawCoordinates(), point.hash() ); }
+
+	std::pair<std::size_t, bool> insert( const vector_t<Number>& coordinates ) {
+		return insert( coordinates, std::hash<vector_t<Number>>()( coordinates ) );
+	}
+
+	/**
+	 * @brief      Returns the index of the passed point or npos, if it is not contained.
+	 */
+	std::size_t find( const Point<Number>& point ) const { return find( point.rawCoordinates(), point.hash() ); }
+
+	std::size_t find( const vector_t<Number>& coordinates ) const {
+		return find( coordinates, std::hash<vector_t<Number>>()( coordinates ) );
+	}
+
+	bool contains( const Point<Number>& point ) const { return find( point ) != npos; }
+	bool contains( const vector_t<Number>& coordinates ) const { return find( coordinates ) != npos; }
+
+	/**
+	 * @brief      Returns the coordinates of the point with the passed index.
+	 */
+	vector_t<Number> at( std::size_t index ) const {
+		assert( index < size() );
+		vector_t<Number> result = vector_t<Number>( mDimension );
+		for ( std::size_t d = 0; d < mDimension; ++d ) {
+			result( d ) = mCoordinates[index * mDimension + d];
+		}
+		return result;
+	}
+
+	/**
+	 * @brief      Returns all points in insertion order.
+	 */
+	std::vector<Point<Number>> points() const {
+		std::vector<Point<Number>> result;
+		result.reserve( size() );
+		for ( std::size_t index = 0; index < size(); ++index ) {
+			result.emplace_back( at( index ) );
+		}
+		return result;
+	}
+
+  private:
+	// the coordinates of points are passed as map, so they are not copied.
+	template <typename Derived>
+	std::pair<std::size_t, bool> insert( const Eigen::MatrixBase<Derived>& coordinates, std::size_t hash ) {
+		if ( empty() && mDimension == 0 ) {
+			mDimension = coordinates.rows();
+		}
+		assert( std::size_t( coordinates.rows() ) == mDimension );
+		if ( 2 * ( size() + 1 ) > mTable.size() ) {
+			rehash( 2 * ( size() + 1 ) );
+		}
+		std::size_t mask = mTable.size() - 1;
+		for ( std::size_t slot = home( hash );; slot = ( slot + 1 ) & mask ) {
+			if ( mTable[slot] == 0 ) {
+				mTable[slot] = size() + 1;
+				mHashes.push_back( hash );
+				for ( std::size_t d = 0; d < mDimension; ++d ) {
+					mCoordinates.push_back( coordinates( d ) );
+				}
+				return std::make_pair( size() - 1, true );
+			}
+			if ( equals( mTable[slot] - 1, coordinates, hash ) ) {
+				return std::make_pair( mTable[slot] - 1, false );
+			}
+		}
+	}
+
+	template <typename Derived>
+	std::size_t find( const Eigen::MatrixBase<Derived>& coordinates, std::size_t hash ) const {
+		if ( mTable.empty() ) {
+			return npos;
+		}
+		std::size_t mask = mTable.size() - 1;
+		for ( std::size_t slot = home( hash ); mTable[slot] != 0; slot = ( slot + 1 ) & mask ) {
+			if ( equals( mTable[slot] - 1, coordinates, hash ) ) {
+				return mTable[slot] - 1;
+			}
+		}
+		return npos;
+	}
+
+	template <typename Derived>
+	bool equals( std::size_t index, const Eigen::MatrixBase<Derived>& coordinates, std::size_t hash ) const {
+		if ( mHashes[index] != hash || std::size_t( coordinates.rows() ) != mDimension ) {
+			return false;
+		}
+		for ( std::size_t d = 0; d < mDimension; ++d ) {
+			if ( mCoordinates[index * mDimension + d] != coordinates( d ) ) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Fibonacci hashing, such that all bits of the hash value determine the slot.
+	std::size_t home( std::size_t hash ) const {
+		return std::size_t( ( std::uint64_t( hash ) * 0x9E3779B97F4A7C15ull ) >> mShift );
+	}
+
+	void rehash( std::size_t minimalSize ) {
+		std::size_t tableSize = 16;
+		mShift = 60;
+		while ( tableSize < minimalSize ) {
+			tableSize *= 2;
+			--mShift;
+		}
+		mTable = std::vector<std::size_t>( tableSize, 0 );
+		std::size_t mask = tableSize - 1;
+		for ( std::size_t index = 0; index < mHashes.size(); ++index ) {
+			std::size_t slot = home( mHashes[index] );
+			while ( mTable[slot] != 0 ) {
+				slot = ( slot + 1 ) & mask;
+			}
+			mTable[slot] = index + 1;
+		}
+	}
+};
+
+template <typename Number>
+const std::size_t PointHashSet<Number>::npos;
+
+}  // namespace hypro
@@ -113,7 +113,7 @@ class Vertex {
 
 	Number coordinate( unsigned _dim ) const { return mPoint.coordinate( _dim ); }
 
-	vector_t<Number> rawCoordinates() const { return mPoint.rawCoordinates(); }
+	typename Point<Number>::coordinateView rawCoordinates() const { return mPoint.rawCoordinates(); }
 
 	/**
 	 * @see Point::dimension
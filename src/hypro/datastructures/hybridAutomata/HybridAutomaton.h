@@ -8,13 +8,19 @@
 #include "RawState.h"
 #include "Transition.h"
 #include "algorithms/reachability/Settings.h"
+#include <algorithm>
 #include <map>
+#include <set>
+#include <vector>
 
 namespace hypro {
 
 
 /**
  * @brief      Class for hybrid automata.
+ * @details    Locations and transitions are owned by the LocationManager and TransitionManager, which place them in
+ * contiguous storage addressed by their dense ids. The automaton keeps them as arrays ordered by id, states are keyed
+ * by the id of their location.
  *
  * @tparam     Number  The used number type.
  */
@@ -24,16 +30,19 @@ class HybridAutomaton {
 
   	using locationSet = std::set<Location<Number>*>;
 	using transitionSet = std::set<Transition<Number>*>;
-	using locationStateMap = std::multimap<Location<Number>*, RawState<Number>, locPtrComp<Number>>;
+	using locationVector = std::vector<Location<Number>*>;
+	using transitionVector = std::vector<Transition<Number>*>;
+	using locationStateMap = std::multimap<unsigned, RawState<Number>>;
 	using setVector = std::vector<std::pair<matrix_t<Number>, vector_t<Number>>>;
   private:
 
-	locationSet mLocations;
-	transitionSet mTransitions;
+	locationVector mLocations;  // ordered by id
+	transitionVector mTransitions;  // ordered by id
 	locationStateMap mInitialStates;
 	locationStateMap mLocalBadStates;
 	setVector mGlobalBadStates;
 	reachability::ReachabilitySettings<Number> mReachabilitySettings;
+	std::vector<std::vector<const RawState<Number>*>> mLocalBadStateIndex;  // local bad states by location id
 
   public:
 
@@ -60,20 +69,32 @@ class HybridAutomaton {
 					 const locationStateMap& _initialStates );
 
 	/**
-	 * @brief      Destroys the object.
+	 * @brief      Destroys the object, the locations and transitions are owned by their managers.
 	 */
-	virtual ~HybridAutomaton() {
-		while(!mTransitions.empty()) {
-			//Transition<Number>* toDelete = *mTransitions.begin();
-			mTransitions.erase(mTransitions.begin());
-			//delete toDelete;
-		}
-	}
+	virtual ~HybridAutomaton() {}
 
-	const locationSet& locations() const;
-	const transitionSet& transitions() const;
+	/**
+	 * @brief      Returns the locations as contiguous array ordered by location id.
+	 */
+	const locationVector& locations() const;
+	/**
+	 * @brief      Returns the transitions as contiguous array ordered by transition id.
+	 */
+	const transitionVector& transitions() const;
+	/**
+	 * @brief      Returns the location with the passed id, nullptr if it is not part of the automaton.
+	 */
+	Location<Number>* location( unsigned _id ) const;
 	const locationStateMap& initialStates() const;
 	const locationStateMap& localBadStates() const;
+
+	/**
+	 * @brief      Returns the local bad states of a location in insertion order, the lookup is indexed by the id of the
+	 * location.
+	 *
+	 * @param[in]  _loc  The location.
+	 */
+	const std::vector<const RawState<Number>*>& localBadStates( const Location<Number>* _loc ) const;
 	const setVector& globalBadStates() const;
 	const reachability::ReachabilitySettings<Number>& reachabilitySettings() const;
 	unsigned dimension() const;
@@ -170,6 +191,7 @@ class HybridAutomaton {
 		mLocalBadStates = _rhs.localBadStates();
 		mGlobalBadStates = _rhs.globalBadStates();
 		mReachabilitySettings = _rhs.reachabilitySettings();
+		indexLocalBadStates();
 		return *this;
 	}
 
@@ -193,7 +215,7 @@ class HybridAutomaton {
 	friend std::ostream& operator<<( std::ostream& _ostr, const HybridAutomaton<Number>& _a ) {
 		_ostr << "initial states: " << std::endl;
 		for ( auto initialIT = _a.initialStates().begin(); initialIT != _a.initialStates().end(); ++initialIT ) {
-			_ostr << (*initialIT).first->id() << ": " << (*initialIT).second.set.first << " <= " << (*initialIT).second.set.second << std::endl;
+			_ostr << (*initialIT).first << ": " << (*initialIT).second.set.first << " <= " << (*initialIT).second.set.second << std::endl;
 		}
 		_ostr << "locations: " << std::endl;
 		for ( auto locationIT = _a.locations().begin(); locationIT != _a.locations().end(); ++locationIT ) {
@@ -205,6 +227,9 @@ class HybridAutomaton {
 		}
 		return _ostr;
 	}
+
+  private:
+	void indexLocalBadStates();
 };
 }
 
@@ -10,26 +10,38 @@ HybridAutomaton<Number>::HybridAutomaton( const HybridAutomaton &_hybrid )
 	, mLocalBadStates( _hybrid.localBadStates() )
 	, mGlobalBadStates( _hybrid.globalBadStates() )
 	, mReachabilitySettings( _hybrid.reachabilitySettings() )
-{}
+{
+	indexLocalBadStates();
+}
 
 template <typename Number>
 HybridAutomaton<Number>::HybridAutomaton( const locationSet& _locs,
 														  const transitionSet& _trans, const locationStateMap& _initialStates )
-	: mLocations( _locs )
-	, mTransitions( _trans )
-	, mInitialStates( _initialStates )
-{}
+	: mInitialStates( _initialStates )
+{
+	setLocations( _locs );
+	setTransitions( _trans );
+}
 
 template <typename Number>
-const std::set<Location<Number> *> &HybridAutomaton<Number>::locations() const {
+const typename HybridAutomaton<Number>::locationVector& HybridAutomaton<Number>::locations() const {
 	return mLocations;
 }
 
 template <typename Number>
-const std::set<Transition<Number> *> &HybridAutomaton<Number>::transitions() const {
+const typename HybridAutomaton<Number>::transitionVector& HybridAutomaton<Number>::transitions() const {
 	return mTransitions;
 }
 
+template <typename Number>
+Location<Number>* HybridAutomaton<Number>::location( unsigned _id ) const {
+	auto pos = std::lower_bound( mLocations.begin(), mLocations.end(), _id, []( const Location<Number>* lhs, unsigned id ) { return lhs->id() < id; } );
+	if ( pos != mLocations.end() && (*pos)->id() == _id ) {
+		return *pos;
+	}
+	return nullptr;
+}
+
 template <typename Number>
 const typename HybridAutomaton<Number>::locationStateMap& HybridAutomaton<Number>::initialStates() const {
 	return mInitialStates;
@@ -40,6 +52,15 @@ const typename HybridAutomaton<Number>::locationStateMap& HybridAutomaton<Number
 	return mLocalBadStates;
 }
 
+template <typename Number>
+const std::vector<const RawState<Number>*>& HybridAutomaton<Number>::localBadStates( const Location<Number>* _loc ) const {
+	static const std::vector<const RawState<Number>*> noStates;
+	if ( _loc->id() < mLocalBadStateIndex.size() ) {
+		return mLocalBadStateIndex[_loc->id()];
+	}
+	return noStates;
+}
+
 template <typename Number>
 const typename HybridAutomaton<Number>::setVector& HybridAutomaton<Number>::globalBadStates() const {
 	return mGlobalBadStates;
@@ -54,7 +75,7 @@ template <typename Number>
 unsigned HybridAutomaton<Number>::dimension() const {
 	if(mInitialStates.empty()) return 0;
 
-	return ( mInitialStates.begin()->first->flow().cols() );
+	return ( mInitialStates.begin()->second.location->flow().cols() );
 }
 
 template <typename Number>
@@ -69,6 +90,7 @@ void HybridAutomaton<Number>::addArtificialDimension() {
 	for(auto badState : mLocalBadStates) {
 		badState.second.addArtificialDimension();
 	}
+	indexLocalBadStates();
 	for(auto badState : mGlobalBadStates) {
 		matrix_t<Number> newConstraints = matrix_t<Number>::Zero(badState.first.rows(), badState.first.cols()+1);
 		newConstraints.block(0,0,badState.first.rows(), badState.first.cols()) = badState.first;
@@ -78,12 +100,14 @@ void HybridAutomaton<Number>::addArtificialDimension() {
 
 template <typename Number>
 void HybridAutomaton<Number>::setLocations( const locationSet &_locs ) {
-	mLocations = _locs;
+	mLocations.assign( _locs.begin(), _locs.end() );
+	std::sort( mLocations.begin(), mLocations.end(), []( const Location<Number>* lhs, const Location<Number>* rhs ) { return lhs->id() < rhs->id(); } );
 }
 
 template <typename Number>
 void HybridAutomaton<Number>::setTransitions( const transitionSet &_trans ) {
-	mTransitions = _trans;
+	mTransitions.assign( _trans.begin(), _trans.end() );
+	std::sort( mTransitions.begin(), mTransitions.end(), []( const Transition<Number>* lhs, const Transition<Number>* rhs ) { return lhs->id() < rhs->id(); } );
 }
 
 template <typename Number>
@@ -94,6 +118,7 @@ void HybridAutomaton<Number>::setInitialStates( const locationStateMap& _states
 template <typename Number>
 void HybridAutomaton<Number>::setLocalBadStates( const locationStateMap& _states ) {
 	mLocalBadStates = _states;
+	indexLocalBadStates();
 }
 
 template <typename Number>
@@ -108,22 +133,33 @@ void HybridAutomaton<Number>::setReachabilitySettings( const reachability::Reach
 
 template <typename Number>
 void HybridAutomaton<Number>::addLocation( Location<Number> *_location ) {
-	mLocations.insert( _location );
+	auto pos = std::lower_bound( mLocations.begin(), mLocations.end(), _location, []( const Location<Number>* lhs, const Location<Number>* rhs ) { return lhs->id() < rhs->id(); } );
+	if ( pos == mLocations.end() || *pos != _location ) {
+		mLocations.insert( pos, _location );
+	}
 }
 
 template <typename Number>
 void HybridAutomaton<Number>::addTransition( Transition<Number> *_transition ) {
-	mTransitions.insert( _transition );
+	auto pos = std::lower_bound( mTransitions.begin(), mTransitions.end(), _transition, []( const Transition<Number>* lhs, const Transition<Number>* rhs ) { return lhs->id() < rhs->id(); } );
+	if ( pos == mTransitions.end() || *pos != _transition ) {
+		mTransitions.insert( pos, _transition );
+	}
 }
 
 template <typename Number>
 void HybridAutomaton<Number>::addInitialState( const RawState<Number>& _state ) {
-	mInitialStates.insert( std::make_pair(_state.location, _state));
+	mInitialStates.insert( std::make_pair(_state.location->id(), _state));
 }
 
 template <typename Number>
 void HybridAutomaton<Number>::addLocalBadState( const RawState<Number>& _state ) {
-	mLocalBadStates.insert(std::make_pair(_state.location, _state));
+	auto stateIt = mLocalBadStates.insert(std::make_pair(_state.location->id(), _state));
+	unsigned id = _state.location->id();
+	if(id >= mLocalBadStateIndex.size()) {
+		mLocalBadStateIndex.resize(id+1);
+	}
+	mLocalBadStateIndex[id].push_back(&stateIt->second);
 }
 
 template <typename Number>
@@ -131,4 +167,17 @@ void HybridAutomaton<Number>::addGlobalBadState( const std::pair<matrix_t<Number
 	mGlobalBadStates.push_back(_valuation);
 }
 
+// the index points into mLocalBadStates, whose nodes are stable, and has to be rebuilt whenever the map is replaced.
+template <typename Number>
+void HybridAutomaton<Number>::indexLocalBadStates() {
+	mLocalBadStateIndex.clear();
+	for(const auto& statePair : mLocalBadStates) {
+		unsigned id = statePair.first;
+		if(id >= mLocalBadStateIndex.size()) {
+			mLocalBadStateIndex.resize(id+1);
+		}
+		mLocalBadStateIndex[id].push_back(&statePair.second);
+	}
+}
+
 } // namespace hypro
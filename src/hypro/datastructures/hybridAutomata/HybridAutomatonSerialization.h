@@ -0,0 +1,119 @@
+/**
+ * @file HybridAutomatonSerialization.h
+ * @brief Binary serialization of hybrid automata, e.g. to cache parsed models.
+ */
+
+#pragma once
+
+#include "HybridAutomaton.h"
+#include "LocationManager.h"
+#include "TransitionManager.h"
+#include "../../util/VariablePool.h"
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace hypro {
+namespace serialization {
+
+	static const char MAGIC[8] = {'H','Y','P','R','O','H','A','\0'};
+	static const std::uint32_t VERSION = 2;
+
+	/**
+	 * @brief      Tag identifying the number type of a serialized automaton.
+	 */
+	template<typename Number>
+	struct NumberTag;
+
+	template<>
+	struct NumberTag<double> { static const std::uint32_t value = 1; };
+
+	template<>
+	struct NumberTag<mpq_class> { static const std::uint32_t value = 2; };
+
+	#ifdef USE_CLN_NUMBERS
+	template<>
+	struct NumberTag<cln::cl_RA> { static const std::uint32_t value = 3; };
+	#endif
+
+	template<typename T>
+	void writeValue( std::ostream& _out, const T& _value ) {
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly.");
+		_out.write( reinterpret_cast<const char*>( &_value ), sizeof( T ) );
+	}
+
+	template<typename T>
+	bool readValue( std::istream& _in, T& _value ) {
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read directly.");
+		return bool( _in.read( reinterpret_cast<char*>( &_value ), sizeof( T ) ) );
+	}
+
+	inline void writeString( std::ostream& _out, const std::string& _string ) {
+		writeValue( _out, std::uint64_t( _string.size() ) );
+		_out.write( _string.data(), _string.size() );
+	}
+
+	inline bool readString( std::istream& _in, std::string& _string ) {
+		std::uint64_t size;
+		if ( !readValue( _in, size ) ) {
+			return false;
+		}
+		_string.resize( size );
+		return size == 0 || bool( _in.read( &_string[0], size ) );
+	}
+
+	// Numbers are stored losslessly: doubles by their bit pattern, rationals by their exact string representation.
+	inline void writeNumber( std::ostream& _out, double _number ) { writeValue( _out, _number ); }
+	inline bool readNumber( std::istream& _in, double& _number ) { return readValue( _in, _number ); }
+
+	inline void writeNumber( std::ostream& _out, const mpq_class& _number ) { writeString( _out, _number.get_str( 16 ) ); }
+	inline bool readNumber( std::istream& _in, mpq_class& _number ) {
+		std::string representation;
+		if ( !readString( _in, representation ) ) {
+			return false;
+		}
+		_number = mpq_class( representation, 16 );
+		return true;
+	}
+
+	#ifdef USE_CLN_NUMBERS
+	inline void writeNumber( std::ostream& _out, const cln::cl_RA& _number ) {
+		std::stringstream representation;
+		representation << _number;
+		writeString( _out, representation.str() );
+	}
+	inline bool readNumber( std::istream& _in, cln::cl_RA& _number ) {
+		std::string representation;
+		if ( !readString( _in, representation ) ) {
+			return false;
+		}
+		_number = cln::cl_RA( representation.c_str() );
+		return true;
+	}
+	#endif
+
+	/**
+	 * @brief      Writes the automaton, the locations are referred to by their position in the id-ordered location array.
+	 * @param      _out        The binary output stream.
+	 * @param[in]  _automaton  The automaton.
+	 */
+	template<typename Number>
+	void write( std::ostream& _out, const HybridAutomaton<Number>& _automaton );
+
+	/**
+	 * @brief      Reads an automaton written by write(). Locations and transitions are created anew.
+	 * @param      _in         The binary input stream.
+	 * @param      _automaton  The resulting automaton.
+	 * @return     False, if the stream is not a serialized automaton over the same number type or is truncated.
+	 */
+	template<typename Number>
+	bool read( std::istream& _in, HybridAutomaton<Number>& _automaton );
+
+} // namespace serialization
+} // namespace hypro
+
+#include "HybridAutomatonSerialization.tpp"
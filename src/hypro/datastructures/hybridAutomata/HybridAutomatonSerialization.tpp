@@ -0,0 +1,394 @@
+#include "HybridAutomatonSerialization.h"
+
+namespace hypro {
+namespace serialization {
+
+	template<typename Number>
+	void writeMatrix( std::ostream& _out, const matrix_t<Number>& _mat ) {
+		writeValue( _out, std::uint64_t( _mat.rows() ) );
+		writeValue( _out, std::uint64_t( _mat.cols() ) );
+		for ( unsigned row = 0; row < _mat.rows(); ++row ) {
+			for ( unsigned col = 0; col < _mat.cols(); ++col ) {
+				writeNumber( _out, _mat( row, col ) );
+			}
+		}
+	}
+
+	template<typename Number>
+	bool readMatrix( std::istream& _in, matrix_t<Number>& _mat ) {
+		std::uint64_t rows, cols;
+		if ( !readValue( _in, rows ) || !readValue( _in, cols ) ) {
+			return false;
+		}
+		_mat = matrix_t<Number>( rows, cols );
+		for ( unsigned row = 0; row < rows; ++row ) {
+			for ( unsigned col = 0; col < cols; ++col ) {
+				if ( !readNumber( _in, _mat( row, col ) ) ) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	template<typename Number>
+	void writeVector( std::ostream& _out, const vector_t<Number>& _vec ) {
+		writeValue( _out, std::uint64_t( _vec.rows() ) );
+		for ( unsigned row = 0; row < _vec.rows(); ++row ) {
+			writeNumber( _out, _vec( row ) );
+		}
+	}
+
+	template<typename Number>
+	bool readVector( std::istream& _in, vector_t<Number>& _vec ) {
+		std::uint64_t rows;
+		if ( !readValue( _in, rows ) ) {
+			return false;
+		}
+		_vec = vector_t<Number>( rows );
+		for ( unsigned row = 0; row < rows; ++row ) {
+			if ( !readNumber( _in, _vec( row ) ) ) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename Number>
+	void writeInterval( std::ostream& _out, const carl::Interval<Number>& _interval ) {
+		writeValue( _out, std::uint32_t( _interval.lowerBoundType() ) );
+		writeValue( _out, std::uint32_t( _interval.upperBoundType() ) );
+		writeNumber( _out, _interval.lower() );
+		writeNumber( _out, _interval.upper() );
+	}
+
+	template<typename Number>
+	bool readInterval( std::istream& _in, carl::Interval<Number>& _interval ) {
+		std::uint32_t lowerType, upperType;
+		Number lower, upper;
+		if ( !readValue( _in, lowerType ) || !readValue( _in, upperType ) || !readNumber( _in, lower ) || !readNumber( _in, upper ) ) {
+			return false;
+		}
+		_interval = carl::Interval<Number>( lower, carl::BoundType( lowerType ), upper, carl::BoundType( upperType ) );
+		return true;
+	}
+
+	// variables are identified by their index in the VariablePool.
+	template<typename Number>
+	void writeDiscreteConstraints( std::ostream& _out, const std::vector<std::pair<carl::Variable, matrix_t<Number>>>& _constraints ) {
+		writeValue( _out, std::uint64_t( _constraints.size() ) );
+		for ( const auto& constraintPair : _constraints ) {
+			writeValue( _out, std::int32_t( VariablePool::getInstance().id( constraintPair.first ) ) );
+			writeMatrix( _out, constraintPair.second );
+		}
+	}
+
+	template<typename Number>
+	bool readDiscreteConstraints( std::istream& _in, std::vector<std::pair<carl::Variable, matrix_t<Number>>>& _constraints ) {
+		std::uint64_t size;
+		if ( !readValue( _in, size ) ) {
+			return false;
+		}
+		_constraints.clear();
+		for ( std::uint64_t i = 0; i < size; ++i ) {
+			std::int32_t index;
+			matrix_t<Number> mat;
+			if ( !readValue( _in, index ) || index < 0 || !readMatrix( _in, mat ) ) {
+				return false;
+			}
+			_constraints.emplace_back( VariablePool::getInstance().carlVarByIndex( unsigned( index ) ), mat );
+		}
+		return true;
+	}
+
+	// monomials are stored by the indices of their variables.
+	template<typename Number>
+	void writePolynomialFlow( std::ostream& _out, const std::vector<typename Location<Number>::polynomial>& _flow ) {
+		writeValue( _out, std::uint64_t( _flow.size() ) );
+		for ( const auto& polynomial : _flow ) {
+			writeValue( _out, std::uint64_t( polynomial.size() ) );
+			for ( const auto& term : polynomial ) {
+				writeValue( _out, std::uint64_t( term.first.size() ) );
+				for ( unsigned index : term.first ) {
+					writeValue( _out, std::uint32_t( index ) );
+				}
+				writeNumber( _out, term.second );
+			}
+		}
+	}
+
+	template<typename Number>
+	bool readPolynomialFlow( std::istream& _in, std::vector<typename Location<Number>::polynomial>& _flow ) {
+		std::uint64_t size;
+		if ( !readValue( _in, size ) ) {
+			return false;
+		}
+		_flow.clear();
+		for ( std::uint64_t i = 0; i < size; ++i ) {
+			std::uint64_t terms;
+			if ( !readValue( _in, terms ) ) {
+				return false;
+			}
+			typename Location<Number>::polynomial polynomial;
+			for ( std::uint64_t j = 0; j < terms; ++j ) {
+				std::uint64_t degree;
+				if ( !readValue( _in, degree ) ) {
+					return false;
+				}
+				std::vector<unsigned> monomial;
+				for ( std::uint64_t k = 0; k < degree; ++k ) {
+					std::uint32_t index;
+					if ( !readValue( _in, index ) ) {
+						return false;
+					}
+					monomial.push_back( index );
+				}
+				if ( !readNumber( _in, polynomial[monomial] ) ) {
+					return false;
+				}
+			}
+			_flow.emplace_back( polynomial );
+		}
+		return true;
+	}
+
+	template<typename Number>
+	void writeStates( std::ostream& _out, const typename HybridAutomaton<Number>::locationStateMap& _states, const std::map<unsigned, std::uint64_t>& _locationIndices ) {
+		writeValue( _out, std::uint64_t( _states.size() ) );
+		for ( const auto& statePair : _states ) {
+			const RawState<Number>& state = statePair.second;
+			writeValue( _out, _locationIndices.at( statePair.first ) );
+			writeMatrix( _out, state.set.first );
+			writeVector( _out, state.set.second );
+			writeValue( _out, std::uint64_t( state.discreteAssignment.size() ) );
+			for ( const auto& assignment : state.discreteAssignment ) {
+				writeValue( _out, std::int32_t( VariablePool::getInstance().id( assignment.first ) ) );
+				writeInterval( _out, assignment.second );
+			}
+			writeInterval( _out, state.timestamp );
+		}
+	}
+
+	template<typename Number>
+	bool readStates( std::istream& _in, std::vector<RawState<Number>>& _states, const std::vector<Location<Number>*>& _locations ) {
+		std::uint64_t size;
+		if ( !readValue( _in, size ) ) {
+			return false;
+		}
+		for ( std::uint64_t i = 0; i < size; ++i ) {
+			std::uint64_t locationIndex, assignments;
+			if ( !readValue( _in, locationIndex ) || locationIndex >= _locations.size() ) {
+				return false;
+			}
+			RawState<Number> state( _locations[locationIndex] );
+			if ( !readMatrix( _in, state.set.first ) || !readVector( _in, state.set.second ) || !readValue( _in, assignments ) ) {
+				return false;
+			}
+			for ( std::uint64_t j = 0; j < assignments; ++j ) {
+				std::int32_t index;
+				carl::Interval<Number> interval;
+				if ( !readValue( _in, index ) || index < 0 || !readInterval( _in, interval ) ) {
+					return false;
+				}
+				state.discreteAssignment[VariablePool::getInstance().carlVarByIndex( unsigned( index ) )] = interval;
+			}
+			if ( !readInterval( _in, state.timestamp ) ) {
+				return false;
+			}
+			_states.emplace_back( state );
+		}
+		return true;
+	}
+
+	template<typename Number>
+	void write( std::ostream& _out, const HybridAutomaton<Number>& _automaton ) {
+		_out.write( MAGIC, sizeof( MAGIC ) );
+		writeValue( _out, VERSION );
+		writeValue( _out, std::uint32_t( NumberTag<Number>::value ) );
+
+		// settings
+		const reachability::ReachabilitySettings<Number>& settings = _automaton.reachabilitySettings();
+		writeNumber( _out, settings.timeBound );
+		writeValue( _out, std::uint64_t( settings.jumpDepth ) );
+		writeNumber( _out, settings.timeStep );
+		writeString( _out, settings.fileName );
+		writeValue( _out, std::uint64_t( settings.pplDenomimator ) );
+		writeValue( _out, std::uint64_t( settings.plotDimensions.size() ) );
+		for ( unsigned dimension : settings.plotDimensions ) {
+			writeValue( _out, std::uint32_t( dimension ) );
+		}
+		writeValue( _out, settings.uniformBloating );
+
+		// locations
+		std::map<unsigned, std::uint64_t> locationIndices;  // by location id
+		writeValue( _out, std::uint64_t( _automaton.locations().size() ) );
+		for ( const Location<Number>* location : _automaton.locations() ) {
+			locationIndices.emplace( location->id(), locationIndices.size() );
+			writeMatrix( _out, location->flow() );
+			writePolynomialFlow<Number>( _out, location->polynomialFlow() );
+			writeMatrix( _out, location->externalInput() );
+			writeMatrix( _out, location->invariant().mat );
+			writeVector( _out, location->invariant().vec );
+			writeValue( _out, std::uint32_t( location->invariant().discreteOffset ) );
+			writeDiscreteConstraints( _out, location->invariant().discreteInvariant );
+		}
+
+		// transitions
+		writeValue( _out, std::uint64_t( _automaton.transitions().size() ) );
+		for ( const Transition<Number>* transition : _automaton.transitions() ) {
+			writeValue( _out, locationIndices.at( transition->source()->id() ) );
+			writeValue( _out, locationIndices.at( transition->target()->id() ) );
+			const typename Transition<Number>::Guard& guard = transition->guard();
+			writeMatrix( _out, guard.mat );
+			writeVector( _out, guard.vec );
+			writeValue( _out, std::uint32_t( guard.discreteOffset ) );
+			writeDiscreteConstraints( _out, guard.discreteGuard );
+			const typename Transition<Number>::Reset& reset = transition->reset();
+			writeMatrix( _out, reset.mat );
+			writeVector( _out, reset.vec );
+			writeValue( _out, std::uint32_t( reset.discreteOffset ) );
+			writeMatrix( _out, reset.discreteMat );
+			writeVector( _out, reset.discreteVec );
+			writeValue( _out, std::uint32_t( transition->aggregation() ) );
+			writeNumber( _out, transition->triggerTime() );
+		}
+
+		// initial and bad states
+		writeStates( _out, _automaton.initialStates(), locationIndices );
+		writeStates( _out, _automaton.localBadStates(), locationIndices );
+		writeValue( _out, std::uint64_t( _automaton.globalBadStates().size() ) );
+		for ( const auto& valuation : _automaton.globalBadStates() ) {
+			writeMatrix( _out, valuation.first );
+			writeVector( _out, valuation.second );
+		}
+	}
+
+	template<typename Number>
+	bool read( std::istream& _in, HybridAutomaton<Number>& _automaton ) {
+		char magic[sizeof( MAGIC )];
+		std::uint32_t version, tag;
+		if ( !_in.read( magic, sizeof( MAGIC ) ) || !std::equal( magic, magic + sizeof( MAGIC ), MAGIC ) ||
+			 !readValue( _in, version ) || version != VERSION || !readValue( _in, tag ) || tag != NumberTag<Number>::value ) {
+			return false;
+		}
+
+		LocationManager<Number>& locationManager = LocationManager<Number>::getInstance();
+		TransitionManager<Number>& transitionManager = TransitionManager<Number>::getInstance();
+		std::vector<Location<Number>*> locations;
+		std::vector<Transition<Number>*> transitions;
+		// created objects are released again if the input turns out to be invalid.
+		auto fail = [&]() {
+			// the storage of locations and transitions is owned by the managers.
+			for ( Transition<Number>* transition : transitions ) {
+				transitionManager.erase( transition->id() );
+			}
+			for ( Location<Number>* location : locations ) {
+				locationManager.erase( location->id() );
+			}
+			return false;
+		};
+
+		// settings
+		reachability::ReachabilitySettings<Number> settings;
+		std::uint64_t jumpDepth, pplDenominator, plotDimensions;
+		if ( !readNumber( _in, settings.timeBound ) || !readValue( _in, jumpDepth ) || !readNumber( _in, settings.timeStep ) ||
+			 !readString( _in, settings.fileName ) || !readValue( _in, pplDenominator ) || !readValue( _in, plotDimensions ) ) {
+			return false;
+		}
+		settings.jumpDepth = std::size_t( jumpDepth );
+		settings.pplDenomimator = (unsigned long)( pplDenominator );
+		for ( std::uint64_t i = 0; i < plotDimensions; ++i ) {
+			std::uint32_t dimension;
+			if ( !readValue( _in, dimension ) ) {
+				return false;
+			}
+			settings.plotDimensions.push_back( dimension );
+		}
+		if ( !readValue( _in, settings.uniformBloating ) ) {
+			return false;
+		}
+
+		// locations
+		std::uint64_t size;
+		if ( !readValue( _in, size ) ) {
+			return false;
+		}
+		for ( std::uint64_t i = 0; i < size; ++i ) {
+			matrix_t<Number> flow, externalInput;
+			std::vector<typename Location<Number>::polynomial> polynomialFlow;
+			typename Location<Number>::Invariant invariant;
+			std::uint32_t discreteOffset;
+			if ( !readMatrix( _in, flow ) || !readPolynomialFlow<Number>( _in, polynomialFlow ) || !readMatrix( _in, externalInput ) || !readMatrix( _in, invariant.mat ) ||
+				 !readVector( _in, invariant.vec ) || !readValue( _in, discreteOffset ) ||
+				 !readDiscreteConstraints( _in, invariant.discreteInvariant ) ) {
+				return fail();
+			}
+			invariant.discreteOffset = discreteOffset;
+			Location<Number>* location = locationManager.create( flow );
+			location->setPolynomialFlow( polynomialFlow );
+			location->setInvariant( invariant );
+			location->setExtInputMat( externalInput );
+			locations.push_back( location );
+		}
+
+		// transitions
+		if ( !readValue( _in, size ) ) {
+			return fail();
+		}
+		for ( std::uint64_t i = 0; i < size; ++i ) {
+			std::uint64_t source, target;
+			typename Transition<Number>::Guard guard;
+			typename Transition<Number>::Reset reset;
+			std::uint32_t guardOffset, resetOffset, aggregation;
+			Number triggerTime;
+			if ( !readValue( _in, source ) || source >= locations.size() || !readValue( _in, target ) || target >= locations.size() ||
+				 !readMatrix( _in, guard.mat ) || !readVector( _in, guard.vec ) || !readValue( _in, guardOffset ) ||
+				 !readDiscreteConstraints( _in, guard.discreteGuard ) || !readMatrix( _in, reset.mat ) || !readVector( _in, reset.vec ) ||
+				 !readValue( _in, resetOffset ) || !readMatrix( _in, reset.discreteMat ) || !readVector( _in, reset.discreteVec ) ||
+				 !readValue( _in, aggregation ) || aggregation > Aggregation::parallelotopeAgg || !readNumber( _in, triggerTime ) ) {
+				return fail();
+			}
+			guard.discreteOffset = guardOffset;
+			reset.discreteOffset = resetOffset;
+			Transition<Number>* transition = transitionManager.create( locations[source], locations[target], guard, reset );
+			transition->setAggregation( Aggregation( aggregation ) );
+			transition->setTriggerTime( triggerTime );
+			transitions.push_back( transition );
+		}
+
+		// initial and bad states
+		std::vector<RawState<Number>> initialStates, localBadStates;
+		typename HybridAutomaton<Number>::setVector globalBadStates;
+		if ( !readStates( _in, initialStates, locations ) || !readStates( _in, localBadStates, locations ) || !readValue( _in, size ) ) {
+			return fail();
+		}
+		for ( std::uint64_t i = 0; i < size; ++i ) {
+			std::pair<matrix_t<Number>, vector_t<Number>> valuation;
+			if ( !readMatrix( _in, valuation.first ) || !readVector( _in, valuation.second ) ) {
+				return fail();
+			}
+			globalBadStates.emplace_back( valuation );
+		}
+
+		HybridAutomaton<Number> result;
+		for ( Location<Number>* location : locations ) {
+			result.addLocation( location );
+		}
+		for ( Transition<Number>* transition : transitions ) {
+			transition->source()->addTransition( transition );
+			result.addTransition( transition );
+		}
+		for ( const auto& state : initialStates ) {
+			result.addInitialState( state );
+		}
+		for ( const auto& state : localBadStates ) {
+			result.addLocalBadState( state );
+		}
+		result.setGlobalBadStates( globalBadStates );
+		result.setReachabilitySettings( settings );
+		_automaton = result;
+		return true;
+	}
+
+} // namespace serialization
+} // namespace hypro
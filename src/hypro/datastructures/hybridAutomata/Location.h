@@ -5,7 +5,11 @@
 #pragma once
 #include "../../types.h"
 #include <carl/interval/Interval.h>
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <set>
+#include <vector>
 
 namespace hypro {
 
@@ -56,6 +60,12 @@ class Location {
 
 	using transitionSet = std::set<Transition<Number>*>;
 
+	/**
+	 * @brief      A polynomial as a map from monomials to coefficients. A monomial is given by the sorted indices of its
+	 * variables (with multiplicity), the empty monomial denotes the constant part.
+	 */
+	using polynomial = std::map<std::vector<unsigned>, Number>;
+
   protected:
 
   	Location();
@@ -73,8 +83,10 @@ class Location {
 	 * Member
 	 */
 	mutable matrix_t<Number> mFlow;
+	std::vector<polynomial> mPolynomialFlow;  // right-hand sides of non-linear dynamics, one per continuous dimension
 	matrix_t<Number> mExternalInput;
 	transitionSet mTransitions;
+	std::vector<Transition<Number>*> mOutgoing;  // the transitions ordered by id, for iteration
 	Invariant mInvariant;
 	unsigned mId;
 
@@ -89,12 +101,22 @@ class Location {
 	 * Getter & Setter
 	 */
 	const matrix_t<Number>& flow() const;
+	/**
+	 * @brief      Returns the polynomial dynamics of the location, if set. Then, the flow matrix only holds their affine part.
+	 */
+	const std::vector<polynomial>& polynomialFlow() const { return mPolynomialFlow; }
+	bool hasPolynomialFlow() const { return !mPolynomialFlow.empty(); }
 	const Invariant& invariant() const;
 	const transitionSet& transitions() const;
+	/**
+	 * @brief      Returns the outgoing transitions as contiguous array ordered by transition id.
+	 */
+	const std::vector<Transition<Number>*>& outgoing() const { return mOutgoing; }
 	const matrix_t<Number>& externalInput() const;
 	unsigned id() const { return mId; }
 
 	void setFlow( const matrix_t<Number>& _mat );
+	void setPolynomialFlow( const std::vector<polynomial>& _flow );
 	void setInvariant( const struct Location<Number>::Invariant& _inv );
 	void setInvariant( const matrix_t<Number>& _mat, const vector_t<Number>& _vec );
 	void setLocation( const struct locationContent& _loc );
@@ -103,6 +125,10 @@ class Location {
 	void setExtInputMat( const matrix_t<Number>& _mat );
 	void addArtificialDimension();
 
+  private:
+	void updateOutgoing();
+
+  public:
 	inline bool operator<( const Location<Number>& _rhs ) const { return ( mId < _rhs.id() ); }
 	inline bool operator==( const Location<Number>& _rhs ) const { return ( mId == _rhs.id() ); }
 	inline bool operator!=( const Location<Number>& _rhs ) const { return ( mId != _rhs.id() ); }
@@ -10,8 +10,10 @@ Location<Number>::Location( unsigned _id )
 template <typename Number>
 Location<Number>::Location( unsigned _id, const Location &_loc )
 	: mFlow( _loc.activityMat() )
+	, mPolynomialFlow( _loc.polynomialFlow() )
 	, mExternalInput( _loc.externalInput() )
 	, mTransitions( _loc.transitions() )
+	, mOutgoing( _loc.outgoing() )
 	, mInvariant( _loc.invariant() )
 	, mId( _id ) {
 }
@@ -30,6 +32,7 @@ Location<Number>::Location( unsigned _id, const matrix_t<Number>& _mat,
 	, mTransitions( _trans )
 	, mInvariant( _inv )
 	, mId( _id ) {
+	updateOutgoing();
 }
 
 template <typename Number>
@@ -41,6 +44,7 @@ Location<Number>::Location( unsigned _id, const matrix_t<Number>& _mat,
 	, mTransitions( _trans )
 	, mInvariant( _inv )
 	, mId( _id ) {
+	updateOutgoing();
 }
 
 template <typename Number>
@@ -68,6 +72,11 @@ void Location<Number>::setFlow( const matrix_t<Number>& _mat ) {
 	mFlow = _mat;
 }
 
+template <typename Number>
+void Location<Number>::setPolynomialFlow( const std::vector<polynomial>& _flow ) {
+	mPolynomialFlow = _flow;
+}
+
 template <typename Number>
 void Location<Number>::setExtInputMat( const matrix_t<Number>& _mat ) {
 	mExternalInput = _mat;
@@ -87,11 +96,15 @@ void Location<Number>::setInvariant( const matrix_t<Number>& _mat, const vector_
 template <typename Number>
 void Location<Number>::setTransitions( const transitionSet& _trans ) {
 	mTransitions = _trans;
+	updateOutgoing();
 }
 
 template<typename Number>
 void Location<Number>::addTransition( Transition<Number>* _trans ) {
-	mTransitions.insert(_trans);
+	if(mTransitions.insert(_trans).second) {
+		auto pos = std::lower_bound(mOutgoing.begin(), mOutgoing.end(), _trans, []( const Transition<Number>* lhs, const Transition<Number>* rhs ) { return lhs->id() < rhs->id(); });
+		mOutgoing.insert(pos, _trans);
+	}
 }
 
 template<typename Number>
@@ -104,4 +117,10 @@ void Location<Number>::addArtificialDimension() {
 	mInvariant.addArtificialDimension();
 }
 
+template<typename Number>
+void Location<Number>::updateOutgoing() {
+	mOutgoing.assign(mTransitions.begin(), mTransitions.end());
+	std::sort(mOutgoing.begin(), mOutgoing.end(), []( const Transition<Number>* lhs, const Transition<Number>* rhs ) { return lhs->id() < rhs->id(); });
+}
+
 } // namespace hypro
@@ -5,12 +5,18 @@
 #pragma once
 
 #include "Location.h"
+#include "../../config.h"
 #include <carl/util/Singleton.h>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace hypro {
 
 /**
  * @brief      Class for a location manager which holds all created locations.
+ * @details    Locations are constructed in chunks of contiguous storage, which are owned by the manager, and are
+ * addressed by their id, which is dense.
  *
  * @tparam     Number  The used number type.
  */
@@ -19,8 +25,16 @@ class LocationManager : public carl::Singleton<LocationManager<Number>> {
 	friend carl::Singleton<LocationManager>;
 
   private:
-	std::map<unsigned, Location<Number>*> mLocations;
-	std::map<Location<Number>*, unsigned> mIds;
+	using Storage = typename std::aligned_storage<sizeof( Location<Number> ), alignof( Location<Number> )>::type;
+
+	struct Chunk {
+		std::unique_ptr<Storage[]> storage;
+		std::size_t capacity;
+		std::size_t size;
+	};
+
+	std::vector<Chunk> mChunks;
+	std::vector<Location<Number>*> mLocations;  // indexed by id, erased locations are nullptr
 	unsigned mId;
 
   protected:
@@ -31,13 +45,20 @@ class LocationManager : public carl::Singleton<LocationManager<Number>> {
 
   public:
 	~LocationManager() {
-		mIds.clear();
-		for(auto mapIt = mLocations.begin(); mapIt != mLocations.end(); ++mapIt) {
-			delete mapIt->second;
-		}
 		mLocations.clear();
+		for(auto& chunk : mChunks) {
+			for(std::size_t i = 0; i < chunk.size; ++i) {
+				reinterpret_cast<Location<Number>*>( &chunk.storage[i] )->~Location();
+			}
+		}
+		mChunks.clear();
 	}
 
+	/**
+	 * @brief      Reserves storage such that the next _count locations are placed contiguously.
+	 */
+	void reserve( std::size_t _count );
+
 	Location<Number>* create();
 	Location<Number>* create( const Location<Number>* _loc );
 	Location<Number>* create( const matrix_t<Number> _mat );
@@ -52,6 +73,10 @@ class LocationManager : public carl::Singleton<LocationManager<Number>> {
 	unsigned id(Location<Number>* _loc) const;
 	Location<Number>* location(unsigned _id) const;
 	void erase(unsigned _id);
+
+  private:
+	void* allocate();
+	Location<Number>* insert( Location<Number>* _loc );
 };
 
 }  // namespace hypro
@@ -3,37 +3,25 @@
 namespace hypro {
 template <typename Number>
 Location<Number> *LocationManager<Number>::create() {
-	Location<Number> *loc = new Location<Number>( mId++ );
-	mLocations[mId - 1] = loc;
-	mIds[loc] = mId - 1;
-	return loc;
+	return insert( new ( allocate() ) Location<Number>( mId++ ) );
 }
 
 template <typename Number>
 Location<Number> *LocationManager<Number>::create( const Location<Number> *_loc ) {
-	Location<Number> *loc = new Location<Number>( mId++, _loc );
-	mLocations[mId - 1] = loc;
-	mIds[loc] = mId - 1;
-	return loc;
+	return insert( new ( allocate() ) Location<Number>( mId++, _loc ) );
 }
 
 template<typename Number>
 Location<Number>* LocationManager<Number>::create( const matrix_t<Number> _mat )
 {
-	Location<Number> *loc = new Location<Number>( mId++, _mat );
-	mLocations[mId - 1] = loc;
-	mIds[loc] = mId - 1;
-	return loc;
+	return insert( new ( allocate() ) Location<Number>( mId++, _mat ) );
 }
 
 template <typename Number>
 Location<Number> *LocationManager<Number>::create( const matrix_t<Number> _mat,
 												   const typename Location<Number>::transitionSet _trans,
 												   const struct Location<Number>::Invariant _inv ) {
-	Location<Number> *loc = new Location<Number>( mId++, _mat, _trans, _inv );
-	mLocations[mId - 1] = loc;
-	mIds[loc] = mId - 1;
-	return loc;
+	return insert( new ( allocate() ) Location<Number>( mId++, _mat, _trans, _inv ) );
 }
 
 template <typename Number>
@@ -41,31 +29,55 @@ Location<Number> *LocationManager<Number>::create( const matrix_t<Number> _mat,
 												   const typename Location<Number>::transitionSet _trans,
 												   const struct Location<Number>::Invariant _inv,
 												   const matrix_t<Number> _extInputMat ) {
-	Location<Number> *loc = new Location<Number>( mId++, _mat, _trans, _inv, _extInputMat );
-	mLocations[mId - 1] = loc;
-	mIds[loc] = mId - 1;
-	return loc;
+	return insert( new ( allocate() ) Location<Number>( mId++, _mat, _trans, _inv, _extInputMat ) );
+}
+
+template <typename Number>
+void LocationManager<Number>::reserve( std::size_t _count ) {
+	mLocations.reserve( mLocations.size() + _count );
+	if ( mChunks.empty() || mChunks.back().capacity - mChunks.back().size < _count ) {
+		mChunks.push_back( Chunk{std::unique_ptr<Storage[]>( new Storage[_count] ), _count, 0} );
+	}
 }
 
 template <typename Number>
 unsigned LocationManager<Number>::id(Location<Number>* _loc) const {
-	assert(mIds.find(_loc) != mIds.end());
-	return mIds.at(_loc);
+	assert(_loc->id() < mLocations.size() && mLocations[_loc->id()] == _loc);
+	return _loc->id();
 }
 
 template<typename Number>
 Location<Number>* LocationManager<Number>::location(unsigned _id) const {
-	assert(mLocations.find(_id) != mLocations.end());
-	return mLocations.at(_id);
+	assert(_id < mLocations.size() && mLocations[_id] != nullptr);
+	return mLocations[_id];
 }
 
 template<typename Number>
 void LocationManager<Number>::erase(unsigned _id) {
-	auto locationMapPtr = mLocations.find(_id);
-	if(locationMapPtr != mLocations.end()) {
+	// the storage of erased locations is released together with the manager.
+	if(_id < mLocations.size() && mLocations[_id] != nullptr) {
 		TRACE("hypro.locationManager", "Erase location " << _id);
-		mLocations.erase(locationMapPtr);
+		mLocations[_id] = nullptr;
 	}
 }
 
+// returns the next free slot, which is only occupied by insert() once the location has been constructed.
+template <typename Number>
+void* LocationManager<Number>::allocate() {
+	if ( mChunks.empty() || mChunks.back().size == mChunks.back().capacity ) {
+		mChunks.push_back( Chunk{std::unique_ptr<Storage[]>( new Storage[LOCATION_POOL_CHUNK_SIZE] ), LOCATION_POOL_CHUNK_SIZE, 0} );
+	}
+	Chunk& chunk = mChunks.back();
+	return &chunk.storage[chunk.size];
+}
+
+template <typename Number>
+Location<Number>* LocationManager<Number>::insert( Location<Number>* _loc ) {
+	assert( _loc->id() == mLocations.size() );
+	assert( static_cast<void*>( _loc ) == &mChunks.back().storage[mChunks.back().size] );
+	++mChunks.back().size;
+	mLocations.push_back( _loc );
+	return _loc;
+}
+
 } // namespace hypro
@@ -14,6 +14,9 @@ namespace hypro {
  */
 enum Aggregation {none,boxAgg,parallelotopeAgg};
 
+template <typename Number>
+class TransitionManager;
+
 /**
  * @brief      Class for a transition of a hybrid automaton.
  *
@@ -21,6 +24,8 @@ enum Aggregation {none,boxAgg,parallelotopeAgg};
  */
 template <typename Number>
 class Transition {
+	friend TransitionManager<Number>;
+
   public:
 	struct Guard {
 		vector_t<Number> vec;
@@ -86,12 +91,13 @@ class Transition {
 	Aggregation mAggregationSetting;
 	bool mTimeTriggered;
 	Number mTriggerTime;
+	unsigned mId;
 
-  public:
+  protected:
 	/**
-	 * Constructors & Destructor
+	 * Constructors, transitions are created by the TransitionManager.
 	 */
-	Transition()
+	Transition( unsigned _id )
 		: mSource( nullptr )
 		, mTarget( nullptr )
 		, mGuard()
@@ -99,9 +105,10 @@ class Transition {
 		, mAggregationSetting(Aggregation::boxAgg)
 		, mTimeTriggered( false )
 		, mTriggerTime( -1 )
+		, mId( _id )
 	{}
 
-	Transition( const Transition& _trans )
+	Transition( unsigned _id, const Transition& _trans )
 		: mSource( _trans.source() )
 		, mTarget( _trans.target() )
 		, mGuard( _trans.guard() )
@@ -109,9 +116,10 @@ class Transition {
 		, mAggregationSetting( _trans.aggregation() )
 		, mTimeTriggered( _trans.triggerTime() >= 0 )
 		, mTriggerTime( _trans.triggerTime() )
+		, mId( _id )
 	{}
 
-	Transition( Location<Number>* _source, Location<Number>* _target )
+	Transition( unsigned _id, Location<Number>* _source, Location<Number>* _target )
 		: mSource( _source )
 		, mTarget( _target )
 		, mGuard()
@@ -119,9 +127,10 @@ class Transition {
 		, mAggregationSetting(Aggregation::boxAgg)
 		, mTimeTriggered( false )
 		, mTriggerTime( -1 )
+		, mId( _id )
 	{}
 
-	Transition( Location<Number>* _source, Location<Number>* _target, const struct Guard& _guard,
+	Transition( unsigned _id, Location<Number>* _source, Location<Number>* _target, const struct Guard& _guard,
 				const Reset& _reset )
 		: mSource( _source )
 		, mTarget( _target )
@@ -130,8 +139,10 @@ class Transition {
 		, mAggregationSetting(Aggregation::boxAgg)
 		, mTimeTriggered( false )
 		, mTriggerTime( -1 )
+		, mId( _id )
 	{}
 
+  public:
 	~Transition() {}
 
 	/**
@@ -144,6 +155,7 @@ class Transition {
 	const Aggregation& aggregation() const { return mAggregationSetting; }
 	bool isTimeTriggered() const { return mTimeTriggered; }
 	Number triggerTime() const { return mTriggerTime; }
+	unsigned id() const { return mId; }
 
 	void setSource( Location<Number>* _source ) { mSource = _source; }
 	void setTarget( Location<Number>* _target ) { mTarget = _target; }
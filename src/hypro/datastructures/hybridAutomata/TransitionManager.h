@@ -0,0 +1,80 @@
+/**
+ * @file TransitionManager.h
+ */
+
+#pragma once
+
+#include "Transition.h"
+#include "../../config.h"
+#include <carl/util/Singleton.h>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for a transition manager which holds all created transitions.
+ * @details    Transitions are constructed in chunks of contiguous storage, which are owned by the manager, and are
+ * addressed by their id, which is dense.
+ *
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class TransitionManager : public carl::Singleton<TransitionManager<Number>> {
+	friend carl::Singleton<TransitionManager>;
+
+  private:
+	using Storage = typename std::aligned_storage<sizeof( Transition<Number> ), alignof( Transition<Number> )>::type;
+
+	struct Chunk {
+		std::unique_ptr<Storage[]> storage;
+		std::size_t capacity;
+		std::size_t size;
+	};
+
+	std::vector<Chunk> mChunks;
+	std::vector<Transition<Number>*> mTransitions;  // indexed by id, erased transitions are nullptr
+	unsigned mId;
+
+  protected:
+	/**
+	 * Default constructor and destructor
+	 */
+	TransitionManager() : mId( 0 ) {}
+
+  public:
+	~TransitionManager() {
+		mTransitions.clear();
+		for(auto& chunk : mChunks) {
+			for(std::size_t i = 0; i < chunk.size; ++i) {
+				reinterpret_cast<Transition<Number>*>( &chunk.storage[i] )->~Transition();
+			}
+		}
+		mChunks.clear();
+	}
+
+	/**
+	 * @brief      Reserves storage such that the next _count transitions are placed contiguously.
+	 */
+	void reserve( std::size_t _count );
+
+	Transition<Number>* create();
+	Transition<Number>* create( const Transition<Number>* _trans );
+	Transition<Number>* create( Location<Number>* _source, Location<Number>* _target );
+	Transition<Number>* create( Location<Number>* _source, Location<Number>* _target,
+								const struct Transition<Number>::Guard& _guard,
+								const struct Transition<Number>::Reset& _reset );
+
+	unsigned id(Transition<Number>* _trans) const;
+	Transition<Number>* transition(unsigned _id) const;
+	void erase(unsigned _id);
+
+  private:
+	void* allocate();
+	Transition<Number>* insert( Transition<Number>* _trans );
+};
+
+}  // namespace hypro
+
+#include "TransitionManager.tpp"
@@ -0,0 +1,74 @@
+#include "TransitionManager.h"
+
+namespace hypro {
+template <typename Number>
+Transition<Number> *TransitionManager<Number>::create() {
+	return insert( new ( allocate() ) Transition<Number>( mId++ ) );
+}
+
+template <typename Number>
+Transition<Number> *TransitionManager<Number>::create( const Transition<Number> *_trans ) {
+	return insert( new ( allocate() ) Transition<Number>( mId++, *_trans ) );
+}
+
+template <typename Number>
+Transition<Number> *TransitionManager<Number>::create( Location<Number> *_source, Location<Number> *_target ) {
+	return insert( new ( allocate() ) Transition<Number>( mId++, _source, _target ) );
+}
+
+template <typename Number>
+Transition<Number> *TransitionManager<Number>::create( Location<Number> *_source, Location<Number> *_target,
+													   const struct Transition<Number>::Guard &_guard,
+													   const struct Transition<Number>::Reset &_reset ) {
+	return insert( new ( allocate() ) Transition<Number>( mId++, _source, _target, _guard, _reset ) );
+}
+
+template <typename Number>
+void TransitionManager<Number>::reserve( std::size_t _count ) {
+	mTransitions.reserve( mTransitions.size() + _count );
+	if ( mChunks.empty() || mChunks.back().capacity - mChunks.back().size < _count ) {
+		mChunks.push_back( Chunk{std::unique_ptr<Storage[]>( new Storage[_count] ), _count, 0} );
+	}
+}
+
+template <typename Number>
+unsigned TransitionManager<Number>::id(Transition<Number>* _trans) const {
+	assert(_trans->id() < mTransitions.size() && mTransitions[_trans->id()] == _trans);
+	return _trans->id();
+}
+
+template<typename Number>
+Transition<Number>* TransitionManager<Number>::transition(unsigned _id) const {
+	assert(_id < mTransitions.size() && mTransitions[_id] != nullptr);
+	return mTransitions[_id];
+}
+
+template<typename Number>
+void TransitionManager<Number>::erase(unsigned _id) {
+	// the storage of erased transitions is released together with the manager.
+	if(_id < mTransitions.size() && mTransitions[_id] != nullptr) {
+		TRACE("hypro.transitionManager", "Erase transition " << _id);
+		mTransitions[_id] = nullptr;
+	}
+}
+
+// returns the next free slot, which is only occupied by insert() once the transition has been constructed.
+template <typename Number>
+void* TransitionManager<Number>::allocate() {
+	if ( mChunks.empty() || mChunks.back().size == mChunks.back().capacity ) {
+		mChunks.push_back( Chunk{std::unique_ptr<Storage[]>( new Storage[TRANSITION_POOL_CHUNK_SIZE] ), TRANSITION_POOL_CHUNK_SIZE, 0} );
+	}
+	Chunk& chunk = mChunks.back();
+	return &chunk.storage[chunk.size];
+}
+
+template <typename Number>
+Transition<Number>* TransitionManager<Number>::insert( Transition<Number>* _trans ) {
+	assert( _trans->id() == mTransitions.size() );
+	assert( static_cast<void*>( _trans ) == &mChunks.back().storage[mChunks.back().size] );
+	++mChunks.back().size;
+	mTransitions.push_back( _trans );
+	return _trans;
+}
+
+} // namespace hypro
@@ -1,15 +1,82 @@
 #include "ParserWrapper.h"
 
 #include "flowstarParser.h"
+#include "datastructures/hybridAutomata/HybridAutomatonSerialization.h"
+#include <cstdint>
+#include <cstdio>
+#include <unistd.h>
 
 namespace hypro {
 
+	namespace {
+		// FNV-1a hash of the content of a model file, used as key of the automaton cache.
+		std::uint64_t hashFile(const parser::MappedFile& file) {
+			std::uint64_t hash = 14695981039346656037ull;
+			for(const char* pos = file.begin(); pos != file.end(); ++pos) {
+				hash ^= std::uint64_t(static_cast<unsigned char>(*pos));
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		template<typename Number>
+		boost::tuple<HybridAutomaton<Number>, reachability::ReachabilitySettings<Number>> parseCached(const std::string& filename, const std::string& cacheFilename) {
+			std::string cachePath = cacheFilename.empty() ? filename + ".cache" : cacheFilename;
+			std::uint64_t key;
+			{
+				parser::MappedFile model(filename);
+				if(!model.good()) {
+					std::cerr << "Could not open file: " << filename << std::endl;
+					exit(1);
+				}
+				key = hashFile(model);
+			}
+
+			HybridAutomaton<Number> automaton;
+			std::ifstream cacheIn(cachePath, std::ios::in | std::ios::binary);
+			std::uint64_t cachedKey;
+			if(cacheIn.good() && serialization::readValue(cacheIn, cachedKey) && cachedKey == key && serialization::read(cacheIn, automaton)) {
+				TRACE("hypro.parser", "Loaded automaton from cache " << cachePath);
+				return boost::tuple<HybridAutomaton<Number>, reachability::ReachabilitySettings<Number>>(automaton, automaton.reachabilitySettings());
+			}
+			cacheIn.close();
+
+			parser::flowstarParser<Number> parser;
+			automaton = parser.parseInput(filename);
+
+			// a cache which cannot be written is not an error, the model is parsed again next time. The cache is written to a
+			// temporary file in the same directory and renamed, such that readers never see a partially written cache.
+			std::string tmpPath = cachePath + ".tmp" + std::to_string(getpid());
+			bool written = false;
+			{
+				std::ofstream cacheOut(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+				if(cacheOut.good()) {
+					serialization::writeValue(cacheOut, key);
+					serialization::write(cacheOut, automaton);
+					cacheOut.close();
+					written = cacheOut.good();
+				}
+			}
+			if(written && std::rename(tmpPath.c_str(), cachePath.c_str()) == 0) {
+				TRACE("hypro.parser", "Wrote automaton cache " << cachePath);
+			} else {
+				std::remove(tmpPath.c_str());
+			}
+			return boost::tuple<HybridAutomaton<Number>, reachability::ReachabilitySettings<Number>>(automaton, parser.mSettings);
+		}
+	} // namespace
+
 	#ifdef USE_CLN_NUMBERS
 	template<>
 	boost::tuple<HybridAutomaton<cln::cl_RA>, reachability::ReachabilitySettings<cln::cl_RA>> parseFlowstarFile<cln::cl_RA>(const std::string& filename) {
 		parser::flowstarParser<cln::cl_RA> parser;
 		return boost::tuple<HybridAutomaton<cln::cl_RA>, reachability::ReachabilitySettings<cln::cl_RA>>(parser.parseInput(filename), parser.mSettings);
 	}
+
+	template<>
+	boost::tuple<HybridAutomaton<cln::cl_RA>, reachability::ReachabilitySettings<cln::cl_RA>> parseFlowstarFileCached<cln::cl_RA>(const std::string& filename, const std::string& cacheFilename) {
+		return parseCached<cln::cl_RA>(filename, cacheFilename);
+	}
 	#endif
 
 	template<>
@@ -18,9 +85,19 @@ namespace hypro {
 		return boost::tuple<HybridAutomaton<mpq_class>, reachability::ReachabilitySettings<mpq_class>>(parser.parseInput(filename), parser.mSettings);
 	}
 
+	template<>
+	boost::tuple<HybridAutomaton<mpq_class>, reachability::ReachabilitySettings<mpq_class>> parseFlowstarFileCached<mpq_class>(const std::string& filename, const std::string& cacheFilename) {
+		return parseCached<mpq_class>(filename, cacheFilename);
+	}
+
 	template<>
 	boost::tuple<HybridAutomaton<double>, reachability::ReachabilitySettings<double>> parseFlowstarFile<double>(const std::string& filename) {
 		parser::flowstarParser<double> parser;
 		return boost::tuple<HybridAutomaton<double>, reachability::ReachabilitySettings<double>>(parser.parseInput(filename), parser.mSettings);
 	}
+
+	template<>
+	boost::tuple<HybridAutomaton<double>, reachability::ReachabilitySettings<double>> parseFlowstarFileCached<double>(const std::string& filename, const std::string& cacheFilename) {
+		return parseCached<double>(filename, cacheFilename);
+	}
 } // namespace hypro
@@ -15,4 +15,14 @@ namespace hypro {
 
 	template<typename Number>
 	boost::tuple<HybridAutomaton<Number>, reachability::ReachabilitySettings<Number>> parseFlowstarFile(const std::string& filename);
+
+	/**
+	 * @brief Parses a model file like parseFlowstarFile and stores the result in a binary cache file.
+	 * @details The cache is keyed by a hash of the content of the model file. If the cache is valid, the automaton is
+	 * loaded from the cache instead of parsing the model.
+	 * @param filename The model file.
+	 * @param cacheFilename The cache file, defaults to the model file with the suffix ".cache".
+	 */
+	template<typename Number>
+	boost::tuple<HybridAutomaton<Number>, reachability::ReachabilitySettings<Number>> parseFlowstarFileCached(const std::string& filename, const std::string& cacheFilename = "");
 } // namespace hypro
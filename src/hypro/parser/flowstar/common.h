@@ -10,7 +10,8 @@ namespace parser{
 	namespace fs = boost::fusion;
 
 	using symbol_table = qi::symbols<char, unsigned>;
-	using BaseIteratorType = spirit::istream_iterator;
+	// input is parsed from contiguous memory, see MappedFile
+	using BaseIteratorType = const char*;
 	using PositionIteratorType = spirit::line_pos_iterator<BaseIteratorType>;
 	using Iterator = PositionIteratorType;
 
@@ -11,6 +11,7 @@ namespace parser {
 	struct transitionParser : qi::grammar<Iterator, std::set<Transition<Number>*>(symbol_table const&, symbol_table const&, symbol_table const&, unsigned const&, unsigned const&), Skipper>
 	{
 		LocationManager<Number>& mLocationManager = LocationManager<Number>::getInstance();
+		TransitionManager<Number>& mTransitionManager = TransitionManager<Number>::getInstance();
 		constraintParser<Iterator, Number> constraint;
 		singleVariableConstraintParser<Iterator, Number> singleVariableConstraint;
 		resetParser<Iterator> variableReset;
@@ -103,7 +104,7 @@ namespace parser {
 		}
 
 		Transition<Number>* createTransition(const std::pair<unsigned, unsigned>& _transition, const boost::optional<Aggregation>& _aggregation, const boost::optional<double>& _triggerTime, unsigned _dim, unsigned _discreteDim) {
-			Transition<Number>* res = new Transition<Number>(
+			Transition<Number>* res = mTransitionManager.create(
 									mLocationManager.location(_transition.first),
 									mLocationManager.location(_transition.second));
 
@@ -200,6 +201,7 @@ namespace parser {
 		px::function<ErrorHandler> errorHandler;
 		std::vector<matrix_t<Number>> mContinuousInvariants;
 		std::vector<std::pair<unsigned, matrix_t<Number>>> mDiscreteInvariants;
+		std::vector<typename Location<Number>::polynomial> mPolynomialFlow;
 
 		modeParser() : modeParser::base_type( start ) {
 			using qi::on_error;
@@ -208,7 +210,7 @@ namespace parser {
 	        start = (name > qi::lit('{') > flow(qi::_r1, qi::_r3) > -invariant(qi::_r1, qi::_r2, qi::_r3, qi::_r4) > qi::lit('}'))[ qi::_val = px::bind( &modeParser<Iterator,Number>::createLocation, px::ref(*this), qi::_1, qi::_2, qi::_r4)];
 
 			name = qi::lexeme[ (qi::alpha | qi::char_("~!@$%^&*_+=<>.?/-")) > *(qi::alnum | qi::char_("~!@$%^&*_+=<>.?/-"))];
-			flow = *qi::space > qi::lexeme["poly ode 1"] > *qi::space > qi::lit('{') > *qi::space > qi::skip(qi::blank)[(mOdeParser(qi::_r1, qi::_r2) % qi::eol)][qi::_val = px::bind( &modeParser<Iterator, Number>::createFlow, px::ref(*this), qi::_1 )] > *qi::space > qi::lit('}');
+			flow = *qi::space > (qi::lexeme["poly ode 1"] | qi::lexeme["poly ode 2"] | qi::lexeme["poly ode 3"]) > *qi::space > qi::lit('{') > *qi::space > qi::skip(qi::blank)[(mOdeParser(qi::_r1, qi::_r2) % qi::eol)][qi::_val = px::bind( &modeParser<Iterator, Number>::createFlow, px::ref(*this), qi::_1, qi::_r2 )] > *qi::space > qi::lit('}');
 			invariant = *qi::space >> qi::lexeme["inv"] > *qi::space > qi::lit('{') > *qi::space > -((continuousInvariant(qi::_r1, qi::_r3) | discreteInvariant(qi::_r2, qi::_r4)) % qi::eol) > *qi::space > qi::lit('}');
 			continuousInvariant = constraint(qi::_r1, qi::_r2)[px::bind( &modeParser<Iterator,Number>::addContinuousInvariant, px::ref(*this), qi::_1)];
 			discreteInvariant = singleVariableConstraint(qi::_r1, qi::_r2)[px::bind( &modeParser<Iterator,Number>::addDiscreteInvariant, px::ref(*this), qi::_1)];
@@ -231,6 +233,7 @@ namespace parser {
 		void cleanup() {
 			mContinuousInvariants.clear();
 			mDiscreteInvariants.clear();
+			mPolynomialFlow.clear();
 		}
 
 		void addContinuousInvariant(const std::vector<matrix_t<Number>>& _constraints) {
@@ -248,28 +251,47 @@ namespace parser {
 			}
 		}
 
-		matrix_t<Number> createFlow( const std::vector<std::pair<unsigned, vector_t<double>>>& _in ) {
+		matrix_t<Number> createFlow( const std::vector<std::pair<unsigned, std::map<std::vector<unsigned>, double>>>& _in, unsigned _dim ) {
 			assert(!_in.empty());
 			// matrix template with additional row of zeroes for constants, no need for rows for discrete variables, as their flow is 0
-			unsigned rowCnt = _in.begin()->second.rows();
-			//std::cout << "In-size: " << _in.size() << ", cols: " << _in.begin()->second.rows() << std::endl;
+			unsigned rowCnt = _dim+1;
+			//std::cout << "In-size: " << _in.size() << ", cols: " << rowCnt << std::endl;
 			assert(_in.size() == rowCnt-1);
-			matrix_t<double> res = matrix_t<double>::Zero(rowCnt, rowCnt);
+			matrix_t<Number> res = matrix_t<Number>::Zero(rowCnt, rowCnt);
+			std::vector<typename Location<Number>::polynomial> polynomialFlow(_dim);
+			bool linear = true;
 			//std::cout << "Flow is a " << res.rows() << " by " << res.cols() << " matrix." << std::endl;
  			for(const auto& pair : _in) {
- 				assert(pair.second.rows() == res.cols());
- 				assert(pair.first < res.rows());
- 				//std::cout << "Row " << pair.first << " = " << pair.second.transpose() << std::endl;
-				res.row(pair.first) << pair.second.transpose();
+ 				assert(pair.first < res.rows()-1);
+				for(const auto& term : pair.second) {
+					if(term.second == 0) {
+						continue;
+					}
+					Number coefficient = carl::convert<double,Number>(term.second);
+					polynomialFlow[pair.first][term.first] = coefficient;
+					// the flow matrix holds the affine part, the constant part is stored in the last column.
+					if(term.first.empty()) {
+						res(pair.first, _dim) = coefficient;
+					} else if(term.first.size() == 1) {
+						assert(term.first.front() < _dim);
+						res(pair.first, term.first.front()) = coefficient;
+					} else {
+						linear = false;
+					}
+				}
 			}
-			// Temporary, until Number template has been propagated fully.
-			return convert<double,Number>(res);
+			// the polynomial dynamics are only kept for the location, if they are not covered by the flow matrix.
+			if(!linear) {
+				mPolynomialFlow = polynomialFlow;
+			}
+			return res;
 		}
 
 		std::pair<std::string, Location<Number>*> createLocation(const std::string& _name, const matrix_t<Number>& _flow, unsigned _discreteDim) {
 			assert(_flow.rows() == _flow.cols());
 			if(mDiscreteInvariants.size() + mContinuousInvariants.size() > 0) {
 				Location<Number>* tmp = mLocationManager.create(_flow);
+				tmp->setPolynomialFlow(mPolynomialFlow);
 				//std::cout << "creating location " << tmp->id() << std::endl;
 				//std::cout << "flow: " << tmp->flow() << std::endl;
 				typename Location<Number>::Invariant inv;
@@ -301,7 +323,10 @@ namespace parser {
 				cleanup();
 				return std::make_pair(_name, tmp );
 			}
-			return std::make_pair(_name, mLocationManager.create(_flow));
+			Location<Number>* tmp = mLocationManager.create(_flow);
+			tmp->setPolynomialFlow(mPolynomialFlow);
+			cleanup();
+			return std::make_pair(_name, tmp);
 		}
 	};
 
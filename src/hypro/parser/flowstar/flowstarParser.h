@@ -10,8 +10,12 @@
 #pragma clang diagnostic ignored "-Woverloaded-shift-op-parentheses"
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
 #include <vector>
 
 #include <boost/spirit/include/support_line_pos_iterator.hpp>
@@ -34,9 +38,11 @@
 #include "algorithms/reachability/Settings.h"
 #include "datastructures/hybridAutomata/RawState.h"
 #include "datastructures/hybridAutomata/LocationManager.h"
+#include "datastructures/hybridAutomata/TransitionManager.h"
 #include "datastructures/hybridAutomata/HybridAutomaton.h"
 #include "util/logging/Logger.h"
 #include "util/VariablePool.h"
+#include "mappedFile.h"
 #include "symbols.h"
 #include "polynomialParser.h"
 #include "componentParser.h"
@@ -123,7 +129,8 @@ struct flowstarParser : qi::grammar<Iterator, Skipper>
 					unsigned constraintsNum = stateIt->set.first.rows();
 					unsigned dimension = constraintsNum > 0 ? stateIt->set.first.cols() : (_constraint.begin()->cols())-1;
 					//std::cout << "current constraints: " << boost::get<cPair<Number>>(stateIt->set).first << std::endl;
-					cPair<Number> set = stateIt->set;
+					// extend the constraints of the state in place
+					cPair<Number>& set = stateIt->set;
 					//std::cout << "Resize to " << constraintsNum+_constraint.size() << " x " << dimension << std::endl;
 					set.first.conservativeResize(constraintsNum+_constraint.size(), dimension);
 					set.second.conservativeResize(constraintsNum+_constraint.size());
@@ -140,7 +147,6 @@ struct flowstarParser : qi::grammar<Iterator, Skipper>
 						//std::cout << set.second(constraintsNum) << std::endl;
 						++constraintsNum;
 					}
-					stateIt->set = set;
 					//std::cout << "New constraints: " << boost::get<cPair<Number>>(stateIt->set).first << std::endl;
 					break;
 				}
@@ -251,7 +257,11 @@ struct flowstarParser : qi::grammar<Iterator, Skipper>
 
 	HybridAutomaton<Number> parseInput( const std::string& pathToInputFile );
 	bool parse( std::istream& in, HybridAutomaton<Number>& _result );
+	bool parse( const char* _begin, const char* _end, HybridAutomaton<Number>& _result );
 	HybridAutomaton<Number> createAutomaton();
+
+private:
+	void reserve( const char* _begin, const char* _end );
 };
 
 } // namespace parser
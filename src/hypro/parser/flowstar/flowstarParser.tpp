@@ -41,12 +41,12 @@ namespace parser {
 		  const std::string &pathToInputFile ) {
 		HybridAutomaton<Number> resultAutomaton;
 
-		std::fstream infile( pathToInputFile );
+		MappedFile infile( pathToInputFile );
 		if ( !infile.good() ) {
 			std::cerr << "Could not open file: " << pathToInputFile << std::endl;
 			exit( 1 );
 		}
-		bool parsingSuccessful = parse( infile, resultAutomaton );
+		bool parsingSuccessful = parse( infile.begin(), infile.end(), resultAutomaton );
 		if ( !parsingSuccessful ) {
 			std::cerr << "Parse error" << std::endl;
 			exit( 1 );
@@ -57,10 +57,16 @@ namespace parser {
 
 	template <typename Number>
 	bool flowstarParser<Number>::parse( std::istream &in, HybridAutomaton<Number> &_result ) {
-		in.unsetf( std::ios::skipws );
-		BaseIteratorType basebegin( in );
-		Iterator begin( basebegin );
-		Iterator end;
+		std::string buffer( (std::istreambuf_iterator<char>( in )), std::istreambuf_iterator<char>() );
+		return parse( buffer.data(), buffer.data() + buffer.size(), _result );
+	}
+
+	template <typename Number>
+	bool flowstarParser<Number>::parse( const char* _begin, const char* _end, HybridAutomaton<Number> &_result ) {
+		reserve( _begin, _end );
+
+		Iterator begin( _begin );
+		Iterator end( _end );
 		Skipper skipper;
 
 		//std::cout << "To parse: " << std::string( begin, end ) << std::endl;
@@ -78,6 +84,21 @@ namespace parser {
 		return result;
 	}
 
+	template <typename Number>
+	void flowstarParser<Number>::reserve( const char* _begin, const char* _end ) {
+		// each mode has exactly one flow, comments are counted as well, which only over-approximates.
+		const std::string flowKeyword( "poly ode" );
+		std::size_t modeCount = 0;
+		for ( const char* pos = std::search( _begin, _end, flowKeyword.begin(), flowKeyword.end() ); pos != _end;
+			  pos = std::search( pos + flowKeyword.size(), _end, flowKeyword.begin(), flowKeyword.end() ) ) {
+			++modeCount;
+		}
+		mModeIds.reserve( modeCount );
+		mInitialStates.reserve( modeCount );
+		mLocalBadStates.reserve( modeCount );
+		mLocationManager.reserve( modeCount );
+	}
+
 	template <typename Number>
 	HybridAutomaton<Number> flowstarParser<Number>::createAutomaton() {
 		HybridAutomaton<Number> result;
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HYPRO_PARSER_USE_MMAP
+#endif
+
+namespace hypro {
+namespace parser {
+
+	/**
+	 * @brief Read-only view on the content of a file as a contiguous range of characters.
+	 * @details The file is memory-mapped where available, otherwise (or if mapping fails, e.g. for empty files) it is
+	 * read into a buffer at once.
+	 */
+	class MappedFile {
+		const char* mData = nullptr;
+		std::size_t mSize = 0;
+		bool mGood = false;
+		bool mMapped = false;
+		std::string mBuffer;
+
+	public:
+		explicit MappedFile(const std::string& _path) {
+			#ifdef HYPRO_PARSER_USE_MMAP
+			int fd = open(_path.c_str(), O_RDONLY);
+			if(fd < 0) {
+				return;
+			}
+			struct stat fileStat;
+			if(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+				void* data = mmap(nullptr, std::size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+				if(data != MAP_FAILED) {
+					mData = static_cast<const char*>(data);
+					mSize = std::size_t(fileStat.st_size);
+					mMapped = true;
+					mGood = true;
+				}
+			}
+			close(fd);
+			if(mMapped) {
+				return;
+			}
+			#endif
+
+			std::ifstream in(_path, std::ios::in | std::ios::binary);
+			if(!in.good()) {
+				return;
+			}
+			mBuffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+			mData = mBuffer.data();
+			mSize = mBuffer.size();
+			mGood = true;
+		}
+
+		~MappedFile() {
+			#ifdef HYPRO_PARSER_USE_MMAP
+			if(mMapped) {
+				munmap(const_cast<char*>(mData), mSize);
+			}
+			#endif
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool good() const { return mGood; }
+		const char* begin() const { return mData; }
+		const char* end() const { return mData + mSize; }
+		std::size_t size() const { return mSize; }
+	};
+
+} // namespace parser
+} // namespace hypro
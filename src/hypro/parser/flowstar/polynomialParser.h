@@ -62,7 +62,7 @@ namespace parser {
 
 			term = (nonconstant(qi::_r1, qi::_r2) | constant(qi::_r1, qi::_r2));
 			constant = qi::skip(qi::blank)[ qi::double_ ][qi::_val = px::bind(&polynomialParser<Iterator>::createConstantTermMap, px::ref(*this), qi::_1, qi::_r2)];
-			nonconstant = qi::skip(qi::blank)[( -((qi::double_ >> qi::lit('*')) | qi::char_("-")) >> monomial(qi::_r1) )[qi::_val = px::bind(&polynomialParser<Iterator>::createTermMap, px::ref(*this), qi::_1, qi::_2)]];
+			nonconstant = qi::skip(qi::blank)[( -((qi::double_ >> qi::lit('*')) | qi::char_("-")) >> monomial(qi::_r1) )[qi::_pass = px::bind(&polynomialParser<Iterator>::isLinear, px::ref(*this), qi::_2), qi::_val = px::bind(&polynomialParser<Iterator>::createTermMap, px::ref(*this), qi::_1, qi::_2)]];
 			connector = qi::lit("+")[qi::_val = 1] | qi::lit("-") [qi::_val = -1];
 			start = qi::skip(qi::blank)[ term(qi::_r1, qi::_r2) >> *( connector > term(qi::_r1, qi::_r2))][qi::_val = px::bind(&polynomialParser<Iterator>::createLinearPolynomial, px::ref(*this), qi::_1, qi::_r2)];
 
@@ -85,9 +85,14 @@ namespace parser {
 			return std::make_pair(_dim, _in);
 		}
 
+		// constraints and resets are linear, non-linear terms let the parser fail instead of being truncated (flows use the nonlinearPolynomialParser).
+		bool isLinear( const std::vector<unsigned>& _in ) {
+			return _in.size() == 1;
+		}
+
 		std::pair<unsigned, double> createTermMap( boost::optional< boost::variant<double, char>>& _coeff, const std::vector<unsigned>& _in ) {
 			std::pair<unsigned,double> coefficentMap;
-			assert(_in.size() == 1 ); // currently we only support linear polynomials
+			assert(!_in.empty());
 
 			if(_coeff) {
 				if((*_coeff).which() == 0) // which returns the index of the used type: double = 0, char = 1
@@ -111,7 +116,7 @@ namespace parser {
 			std::pair<unsigned,double> tmp = fs::at_c<0>(_in);
 			res(tmp.first) += tmp.second;
 
-			std::vector<boost::fusion::vector2<int, std::pair<unsigned,double>>> tmpVec = fs::at_c<1>(_in);
+			const std::vector<boost::fusion::vector2<int, std::pair<unsigned,double>>>& tmpVec = fs::at_c<1>(_in);
 			for(const auto& tuple : tmpVec) {
 				assert((fs::at_c<1>(tuple)).first < res.size());
 				// std::cout << (fs::at_c<1>(tuple)).first << " -> " << (fs::at_c<1>(tuple)).second << std::endl;
@@ -127,26 +132,97 @@ namespace parser {
 		}
 	};
 
+	/**
+	 * @brief Parses a polynomial of arbitrary degree into a map from monomials, i.e. the sorted indices of their variables, to
+	 * coefficients. The empty monomial holds the constant part.
+	 */
 	template<typename Iterator>
-	struct odeParser : qi::grammar<Iterator, std::pair<unsigned, vector_t<double>>(symbol_table const&, unsigned const&)>
+	struct nonlinearPolynomialParser
+		: qi::grammar<Iterator, std::map<std::vector<unsigned>, double>(symbol_table const&)>
 	{
-		polynomialParser<Iterator> mPolynomial;
+		monomialParser<Iterator> monomial;
+		px::function<ErrorHandler> errorHandler;
+
+		nonlinearPolynomialParser() : nonlinearPolynomialParser::base_type( start, "nonlinearPolynomialParser" )
+		{
+			using qi::on_error;
+			using qi::fail;
+
+			term = (nonconstant(qi::_r1) | constant);
+			constant = qi::skip(qi::blank)[ qi::double_ ][qi::_val = px::bind(&nonlinearPolynomialParser<Iterator>::createConstantTerm, px::ref(*this), qi::_1)];
+			nonconstant = qi::skip(qi::blank)[( -((qi::double_ >> qi::lit('*')) | qi::char_("-")) >> monomial(qi::_r1) )[qi::_val = px::bind(&nonlinearPolynomialParser<Iterator>::createTerm, px::ref(*this), qi::_1, qi::_2)]];
+			connector = qi::lit("+")[qi::_val = 1] | qi::lit("-") [qi::_val = -1];
+			start = qi::skip(qi::blank)[ term(qi::_r1) >> *( connector > term(qi::_r1))][qi::_val = px::bind(&nonlinearPolynomialParser<Iterator>::createPolynomial, px::ref(*this), qi::_1)];
+
+			start.name("nonlinear polynomial");
+			constant.name("const term");
+			nonconstant.name("nonconstant term");
+			term.name("term");
+
+			qi::on_error<qi::fail>( start, errorHandler(qi::_1, qi::_2, qi::_3, qi::_4));
+		}
+
+		qi::rule<Iterator, std::pair<std::vector<unsigned>, double>()> constant;
+		qi::rule<Iterator, std::pair<std::vector<unsigned>, double>(symbol_table const&)> nonconstant;
+		qi::rule<Iterator, std::pair<std::vector<unsigned>, double>(symbol_table const&)> term;
+		qi::rule<Iterator, int()> connector;
+		qi::rule<Iterator, std::map<std::vector<unsigned>, double>(symbol_table const&)> start;
+
+		std::pair<std::vector<unsigned>, double> createConstantTerm( double _in ) {
+			return std::make_pair(std::vector<unsigned>(), _in);
+		}
+
+		std::pair<std::vector<unsigned>, double> createTerm( boost::optional< boost::variant<double, char>>& _coeff, const std::vector<unsigned>& _in ) {
+			assert(!_in.empty());
+			// the order of variables in a monomial does not matter, x*y and y*x are the same monomial.
+			std::vector<unsigned> monomial = _in;
+			std::sort(monomial.begin(), monomial.end());
+
+			if(_coeff) {
+				if((*_coeff).which() == 0) // which returns the index of the used type: double = 0, char = 1
+					return std::make_pair(monomial, boost::get<double>(*_coeff));
+				return std::make_pair(monomial, -1.0);
+			}
+			return std::make_pair(monomial, 1.0);
+		}
+
+		std::map<std::vector<unsigned>, double> createPolynomial(const boost::fusion::vector2< std::pair<std::vector<unsigned>,double>, const std::vector<boost::fusion::vector2<int, std::pair<std::vector<unsigned>,double>>>>& _in) {
+			std::map<std::vector<unsigned>, double> res;
+			const std::pair<std::vector<unsigned>,double>& tmp = fs::at_c<0>(_in);
+			res[tmp.first] += tmp.second;
+
+			const std::vector<boost::fusion::vector2<int, std::pair<std::vector<unsigned>,double>>>& tmpVec = fs::at_c<1>(_in);
+			for(const auto& tuple : tmpVec) {
+				if(fs::at_c<0>(tuple)) {
+					res[(fs::at_c<1>(tuple)).first] += (fs::at_c<1>(tuple)).second * (fs::at_c<0>(tuple));
+				} else {
+					res[(fs::at_c<1>(tuple)).first] += (fs::at_c<1>(tuple)).second;
+				}
+			}
+			return res;
+		}
+	};
+
+	template<typename Iterator>
+	struct odeParser : qi::grammar<Iterator, std::pair<unsigned, std::map<std::vector<unsigned>, double>>(symbol_table const&, unsigned const&)>
+	{
+		nonlinearPolynomialParser<Iterator> mPolynomial;
 		px::function<ErrorHandler> errorHandler;
 
 		odeParser() : odeParser::base_type( start, "odeParser" ) {
 			using qi::on_error;
 	        using qi::fail;
 
-			start = qi::skip(qi::blank)[(qi::lazy(qi::_r1) > qi::lit("'") > qi::lit("=") > mPolynomial(qi::_r1, qi::_r2))[qi::_val = px::bind( &odeParser<Iterator>::createRow, px::ref(*this), qi::_1, qi::_2 )]];
+			start = qi::skip(qi::blank)[(qi::lazy(qi::_r1) > qi::lit("'") > qi::lit("=") > mPolynomial(qi::_r1))[qi::_val = px::bind( &odeParser<Iterator>::createRow, px::ref(*this), qi::_1, qi::_2 )]];
 			start.name("flow ode");
 
 			qi::on_error<qi::fail>( start, errorHandler(qi::_1, qi::_2, qi::_3, qi::_4));
 		}
 
-		qi::rule<Iterator, std::pair<unsigned, vector_t<double>>(symbol_table const&, unsigned const&)> start;
+		qi::rule<Iterator, std::pair<unsigned, std::map<std::vector<unsigned>, double>>(symbol_table const&, unsigned const&)> start;
 
-		std::pair<unsigned, vector_t<double>> createRow( const unsigned& _d, const vector_t<double>& _row ) {
-			return std::make_pair(_d, _row);
+		std::pair<unsigned, std::map<std::vector<unsigned>, double>> createRow( const unsigned& _d, const std::map<std::vector<unsigned>, double>& _rhs ) {
+			return std::make_pair(_d, _rhs);
 		}
 	};
 
@@ -302,38 +378,27 @@ namespace parser {
 
 		std::vector<matrix_t<Number>> createRow(const vector_t<double>& _lhs, RELATION _rel, const vector_t<double>& _rhs) {
 			std::vector<matrix_t<Number>> res;
-			// convert to Number and transpose to create a row.
-			matrix_t<Number> newLhs = convert<double,Number>(_lhs.transpose());
-			matrix_t<Number> newRhs = convert<double,Number>(_rhs.transpose());
-			assert(newLhs.rows() == 1 && newLhs.cols() == _lhs.rows());
-			assert(newRhs.rows() == 1 && newRhs.cols() == _rhs.rows());
-			assert(newLhs.cols() == newRhs.cols());
+			res.reserve(_rel == RELATION::EQ ? 2 : 1);
+			assert(_lhs.rows() == _rhs.rows());
+			// convert to Number and transpose to create a row, all constraints are built from the difference.
+			matrix_t<Number> difference = convert<double,Number>(matrix_t<double>(_lhs.transpose())) - convert<double,Number>(matrix_t<double>(_rhs.transpose()));
+			assert(difference.rows() == 1 && difference.cols() == _lhs.rows());
 			switch(_rel){
 				case RELATION::EQ: {
-					matrix_t<Number> resLower = matrix_t<Number>(1, newLhs.cols());
-					matrix_t<Number> resUpper = matrix_t<Number>(1, newLhs.cols());
-					resLower.row(0) = (newLhs-newRhs);
-					resUpper.row(0) = -1*(newLhs)+newRhs;
-					res.emplace_back(resLower);
-					res.emplace_back(resUpper);
+					res.emplace_back(difference);
+					res.emplace_back(-difference);
 
-					//std::cout << "Created row from =: " << resLower << std::endl;
-					//std::cout << "Created row from =: " << resUpper << std::endl;
+					//std::cout << "Created rows from =: " << difference << std::endl;
 					return res;
 				}
 				case RELATION::GEQ: {
-					matrix_t<Number> resRow = matrix_t<Number>(1, newLhs.cols());
-					//std::cout << "GEQ: lhs:" << newLhs << " >= " << newRhs << std::endl;
-					resRow.row(0) = -1*(newLhs)+newRhs;
-					res.emplace_back(resRow);
-					//std::cout << "Created row from >=: " << resRow << std::endl;
+					res.emplace_back(-difference);
+					//std::cout << "Created row from >=: " << -difference << std::endl;
 					return res;
 				}
 				case RELATION::LEQ: {
-					matrix_t<Number> resRow= matrix_t<Number>(1, newLhs.cols());
-					resRow.row(0) = newLhs-newRhs;
-					res.emplace_back(resRow);
-					//std::cout << "Created row from <=: " << resRow << std::endl;
+					res.emplace_back(difference);
+					//std::cout << "Created row from <=: " << difference << std::endl;
 					return res;
 				}
 				default:{
@@ -12,6 +12,7 @@
 #include "../../datastructures/Halfspace.h"
 #include "../../datastructures/Point.h"
 #include "../../util/Permutator.h"
+#include "../../util/VertexRange.h"
 #include "../../util/linearOptimization/Optimizer.h"
 #include "../../util/logging/Logger.h"
 #include <carl/interval/Interval.h>
@@ -254,6 +255,23 @@ class BoxT : public GeometricObject<Number, BoxT<Number,Converter>> {
 	 */
 	std::vector<Point<Number>> vertices( const Location<Number>* = nullptr ) const;
 
+	/**
+	 * @brief Returns a range which enumerates the vertices of the box lazily.
+	 * @details The vertices are generated on the fly in Gray code order, degenerate dimensions are not enumerated, such that
+	 * each vertex occurs once.
+	 * @return A range of points.
+	 */
+	BoxVertexRange<Number> vertexRange() const { return BoxVertexRange<Number>( mLimits.first, mLimits.second ); }
+
+	/**
+	 * @brief Returns a range which enumerates the vertices of the projection of the box onto the passed dimensions lazily.
+	 * @param dimensions The dimensions to project on.
+	 * @return A range of points of dimension dimensions.size().
+	 */
+	BoxVertexRange<Number> vertexRange( const std::vector<unsigned>& dimensions ) const {
+		return BoxVertexRange<Number>( mLimits.first, mLimits.second, dimensions );
+	}
+
 	/**
 	 * @brief Checks if two boxes are equal.
 	 * @param b1 Contains the first box.
@@ -255,7 +255,7 @@ carl::Interval<Number> BoxT<Number,Converter>::interval( std::size_t d ) const {
 template<typename Number, typename Converter>
 Number BoxT<Number,Converter>::supremum() const {
 	Number max = 0;
-	for ( auto &point : this->vertices() ) {
+	for ( const auto &point : this->vertexRange() ) {
 		Number inftyNorm = Point<Number>::inftyNorm( point );
 		max = max > inftyNorm ? max : inftyNorm;
 	}
@@ -264,22 +264,7 @@ Number BoxT<Number,Converter>::supremum() const {
 
 template<typename Number, typename Converter>
 std::vector<Point<Number>> BoxT<Number,Converter>::vertices( const Location<Number>* ) const {
-	std::vector<Point<Number>> result;
-	std::size_t limit = pow( 2, mLimits.first.dimension() );
-
-	for ( std::size_t bitCount = 0; bitCount < limit; ++bitCount ) {
-		vector_t<Number> coord = vector_t<Number>( dimension() );
-		for ( std::size_t dimension = 0; dimension < this->dimension(); ++dimension ) {
-			std::size_t pos = ( 1 << dimension );
-			if ( bitCount & pos ) {
-				coord( dimension ) = mLimits.second.at(dimension);
-			} else {
-				coord( dimension ) = mLimits.first.at(dimension);
-			}
-		}
-		result.push_back( Point<Number>( coord ) );
-	}
-	return result;
+	return this->vertexRange().collect();
 }
 
 template<typename Number, typename Converter>
@@ -359,9 +344,9 @@ BoxT<Number,Converter> BoxT<Number,Converter>::makeSymmetric() const {
 
 template<typename Number, typename Converter>
 std::pair<bool, BoxT<Number,Converter>> BoxT<Number,Converter>::satisfiesHalfspace( const Halfspace<Number>& rhs ) const {
-	std::vector<Point<Number>> vertices = this->vertices();
+	BoxVertexRange<Number> vertices = this->vertexRange();
 	bool allVerticesContained = true;
-	unsigned outsideVertexCnt = 0;
+	std::uint64_t outsideVertexCnt = 0;
 	for(const auto& vertex : vertices) {
 		if(vertex.rawCoordinates().dot(rhs.normal()) > rhs.offset()){
 			allVerticesContained = false;
@@ -241,6 +241,23 @@ class BoxT<double,Converter> : public GeometricObject<double, BoxT<double,Conver
 	 */
 	std::vector<Point<double>> vertices( const Location<double>* = nullptr ) const;
 
+	/**
+	 * @brief Returns a range which enumerates the vertices of the box lazily.
+	 * @details The vertices are generated on the fly in Gray code order, degenerate dimensions are not enumerated, such that
+	 * each vertex occurs once.
+	 * @return A range of points.
+	 */
+	BoxVertexRange<double> vertexRange() const { return BoxVertexRange<double>( mLimits.first, mLimits.second ); }
+
+	/**
+	 * @brief Returns a range which enumerates the vertices of the projection of the box onto the passed dimensions lazily.
+	 * @param dimensions The dimensions to project on.
+	 * @return A range of points of dimension dimensions.size().
+	 */
+	BoxVertexRange<double> vertexRange( const std::vector<unsigned>& dimensions ) const {
+		return BoxVertexRange<double>( mLimits.first, mLimits.second, dimensions );
+	}
+
 	/**
 	 * @brief Checks if two boxes are equal.
 	 * @param b1 Contains the first box.
@@ -228,7 +228,7 @@ carl::Interval<double> BoxT<double,Converter>::interval( std::size_t d ) const {
 template<typename Converter>
 double BoxT<double,Converter>::supremum() const {
 	double max = 0;
-	for ( auto &point : this->vertices() ) {
+	for ( const auto &point : this->vertexRange() ) {
 		double inftyNorm = Point<double>::inftyNorm( point );
 		max = max > inftyNorm ? max : inftyNorm;
 	}
@@ -237,22 +237,7 @@ double BoxT<double,Converter>::supremum() const {
 
 template<typename Converter>
 std::vector<Point<double>> BoxT<double,Converter>::vertices( const Location<double>* ) const {
-	std::vector<Point<double>> result;
-	std::size_t limit = pow( 2, mLimits.first.dimension() );
-
-	for ( std::size_t bitCount = 0; bitCount < limit; ++bitCount ) {
-		vector_t<double> coord = vector_t<double>( dimension() );
-		for ( std::size_t dimension = 0; dimension < this->dimension(); ++dimension ) {
-			std::size_t pos = ( 1 << dimension );
-			if ( bitCount & pos ) {
-				coord( dimension ) = mLimits.second.at(dimension);
-			} else {
-				coord( dimension ) = mLimits.first.at(dimension);
-			}
-		}
-		result.push_back( Point<double>( coord ) );
-	}
-	return result;
+	return this->vertexRange().collect();
 }
 
 template<typename Converter>
@@ -275,9 +260,9 @@ BoxT<double,Converter> BoxT<double,Converter>::makeSymmetric() const {
 
 template<typename Converter>
 std::pair<bool, BoxT<double,Converter>> BoxT<double,Converter>::satisfiesHalfspace( const Halfspace<double>& rhs ) const {
-	std::vector<Point<double>> vertices = this->vertices();
+	BoxVertexRange<double> vertices = this->vertexRange();
 	bool allVerticesContained = true;
-	unsigned outsideVertexCnt = 0;
+	std::uint64_t outsideVertexCnt = 0;
 	for(const auto& vertex : vertices) {
 		if(!carl::AlmostEqual2sComplement(vertex.rawCoordinates().dot(rhs.normal()), rhs.offset(), 128) && vertex.rawCoordinates().dot(rhs.normal()) > rhs.offset()){
 			allVerticesContained = false;
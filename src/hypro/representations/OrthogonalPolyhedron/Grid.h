@@ -8,6 +8,7 @@
 
 #include "../../datastructures/Point.h"
 #include "../../datastructures/Vertex.h"
+#include "GridColors.h"
 #include <carl/core/Variable.h>
 #include <vector>
 #include <map>
@@ -69,15 +70,14 @@ struct pointIt {
 template <typename Number>
 class Grid {
   public:
-	using gridMap = std::map<Point<unsigned>, bool>;  // store calculated colors
 	using gridPoints = std::map<unsigned, std::vector<Number>>;
-	using gridMapIterator = gridMap::iterator;
 	using gridPointsIterator = typename gridPoints::iterator;
 
   private:
 	std::set<Vertex<unsigned>> mVertices;
-	mutable gridMap mGridMap;  // is mutable to allow storing of intermediate results
+	mutable GridColors mColors;  // is mutable to allow storing of intermediate results
 	mutable gridPoints mInducedGridPoints;
+	mutable bool mExtentsOutdated = false;  // coordinates were added since the color store was last adapted
 
   public:
 	/**
@@ -150,9 +150,14 @@ class Grid {
 
 	void clear();
 
-	typename gridMap::const_iterator find( const Point<Number>& point ) const;
-	typename gridMap::const_iterator findInduced( const Point<unsigned>& inducedPoint ) const;
-	typename gridMap::const_iterator end() const;
+	/**
+	 * Returns true, if the color of the point is already known, i.e. it has been inserted or calculated.
+	 *
+	 * @param point
+	 * @return
+	 */
+	bool hasColor( const Point<Number>& point ) const;
+	bool hasColorInduced( const Point<unsigned>& inducedPoint ) const;
 
 	/**
 	 * Clears the grid, induces it and sets up the vertices.
@@ -192,6 +197,24 @@ class Grid {
 	 */
 	vSet<Number> translateToOriginal( const vSet<unsigned>& inducedVertices ) const;
 
+  private:
+	/**
+	 * Adapts the color store to the current number of induced coordinates.
+	 */
+	void updateExtents() const;
+
+	/**
+	 * Returns the color store, which is adapted first if coordinates have been added since. This way a sequence of
+	 * added coordinates only reshapes the store once.
+	 */
+	GridColors& colors() const {
+		if ( mExtentsOutdated ) {
+			updateExtents();
+		}
+		return mColors;
+	}
+
+  public:
 	friend bool operator==( const Grid<Number>& op1, const Grid<Number>& op2 ) {
 		return op1.mInducedGridPoints == op2.mInducedGridPoints;
 	}
@@ -33,7 +33,7 @@ Grid<Number>::Grid( const std::vector<Vertex<Number>> &_vertices )
 
 template <typename Number>
 Grid<Number>::Grid( const Grid<Number> &copy )
-	: mVertices( copy.mVertices ), mGridMap( copy.mGridMap ), mInducedGridPoints( copy.mInducedGridPoints ) {
+	: mVertices( copy.mVertices ), mColors( copy.mColors ), mInducedGridPoints( copy.mInducedGridPoints ), mExtentsOutdated( copy.mExtentsOutdated ) {
 }
 
 /*
@@ -53,9 +53,9 @@ unsigned Grid<Number>::dimension() const {
 template <typename Number>
 std::vector<carl::Variable> Grid<Number>::variables() const {
 	std::vector<carl::Variable> res;
-	if ( mGridMap.empty() ) return res;
+	if ( colors().empty() ) return res;
 
-	res = mGridMap.begin()->first.variables();
+	res = Point<unsigned>::Zero( dimension() ).variables();
 	return ( res );
 }
 
@@ -81,21 +81,12 @@ std::vector<Number> Grid<Number>::inducedDimensionAt( unsigned dimension ) const
 
 template <typename Number>
 bool Grid<Number>::empty() const {
-	return mGridMap.empty();
+	return colors().empty();
 }
 
 template <typename Number>
 bool Grid<Number>::colorAt( const Point<Number> &point ) const {
-	Point<unsigned> inducedPoint = calculateInduced( point ).first;
-	// the point is not a vertex (vertices are inserted at the beginning) and not
-	// yet calculated.
-	if ( mGridMap.find( inducedPoint ) != mGridMap.end() ) {
-		// std::cout << "known: " << point << "(" << inducedPoint << ") " <<
-		// mGridMap.at(inducedPoint) << std::endl;
-		return mGridMap.at( inducedPoint );
-	}
-
-	return colorAtInduced( inducedPoint );
+	return colorAtInduced( calculateInduced( point ).first );
 }
 
 template <typename Number>
@@ -103,9 +94,9 @@ bool Grid<Number>::colorAtInduced( const Point<unsigned> &inducedPoint ) const {
 	// std::cout << __func__ << " " << inducedPoint << std::endl;
 	// the point is not a vertex (vertices are inserted at the beginning) and not
 	// yet calculated.
-	if ( mGridMap.find( inducedPoint ) != mGridMap.end() ) {
-		// std::cout << "known: " << mGridMap.at(inducedPoint) << std::endl;
-		return mGridMap.at( inducedPoint );
+	std::pair<bool, bool> known = colors().find( inducedPoint );
+	if ( known.first ) {
+		return known.second;
 	}
 
 	// if one coordinate is zero just go along the axes towards origin and count
@@ -126,7 +117,7 @@ bool Grid<Number>::colorAtInduced( const Point<unsigned> &inducedPoint ) const {
 		while ( !nonZero.empty() ) {
 			unsigned dir = nonZero.back();
 			// std::cout << "Chosen predecessor direction: " << dir << std::endl;
-			while ( mGridMap.find( predecessor ) == mGridMap.end() &&
+			while ( !colors().find( predecessor ).first &&
 					( iPredecessorInduced( predecessor, dir ) != predecessor ) ) {
 				// std::cout << "Added predecessor " << predecessor << std::endl;
 				predecessors.push_back( predecessor );
@@ -134,12 +125,12 @@ bool Grid<Number>::colorAtInduced( const Point<unsigned> &inducedPoint ) const {
 			}
 			nonZero.pop_back();
 		}
-		// std::cout << "Found vertex: " << predecessor << ", set color to " <<
-		// mGridMap.at(predecessor) <<  std::endl;
-		bool color = mGridMap.at( predecessor );
-		mGridMap[inducedPoint] = color;
+		// std::cout << "Found vertex: " << predecessor << std::endl;
+		assert( colors().find( predecessor ).first );
+		bool color = colors().find( predecessor ).second;
+		colors().set( inducedPoint, color );
 		while ( !predecessors.empty() ) {
-			mGridMap[predecessors.back()] = color;
+			colors().set( predecessors.back(), color );
 			predecessors.pop_back();
 		}
 		// std::cout << "Color " << inducedPoint << ": " << color << std::endl;
@@ -179,7 +170,7 @@ bool Grid<Number>::colorAtInduced( const Point<unsigned> &inducedPoint ) const {
 			}
 		}
 		if ( setColor ) {
-			mGridMap[inducedPoint] = color;
+			colors().set( inducedPoint, color );
 			break;
 		}
 	}
@@ -191,24 +182,32 @@ template <typename Number>
 std::vector<Point<Number>> Grid<Number>::allBlack() const {
 	colorAll();
 	std::vector<Point<Number>> res;
-	for ( const auto &pPair : mGridMap ) {
-		if ( pPair.second ) res.emplace_back( calculateOriginal( pPair.first ) );
-	}
+	for ( const auto &point : colors().points( true ) ) res.emplace_back( calculateOriginal( point ) );
+
 	return ( res );
 }
 
 template <typename Number>
 void Grid<Number>::colorAll() const {
-	std::vector<std::vector<unsigned>> points;
+	std::vector<unsigned> extents;
 	for ( const auto &vecPair : mInducedGridPoints ) {
-		std::vector<unsigned> positions;
-		for ( unsigned i = 0; i < vecPair.second.size(); ++i ) positions.emplace_back( i );
-		points.emplace_back( positions );
-	}
-
-	pointIt<unsigned> iter( points );
-	while ( !iter.end ) {
-		colorAtInduced( ++iter );
+		if ( vecPair.second.empty() ) return;
+		extents.push_back( vecPair.second.size() );
+	}
+	if ( extents.empty() ) return;
+
+	// traverse the induced grid in lexicographic order, such that the colors of all predecessors of a point are known
+	// when it is reached.
+	Point<unsigned> current = Point<unsigned>::Zero( extents.size() );
+	while ( true ) {
+		colorAtInduced( current );
+		unsigned d = extents.size();
+		while ( d > 0 && current.at( d - 1 ) + 1 == extents[d - 1] ) {
+			current[d - 1] = 0;
+			--d;
+		}
+		if ( d == 0 ) break;
+		current[d - 1] = current.at( d - 1 ) + 1;
 	}
 }
 
@@ -461,13 +460,14 @@ bool Grid<Number>::isOutside( const Point<Number> &_point ) const {
 
 template <typename Number>
 void Grid<Number>::insert( const Point<Number> &point, bool color ) {
-	mGridMap.insert( std::make_pair( calculateInduced( point ).first, color ) );
-	mVertices.emplace( calculateInduced( point ).first, color );
+	Point<unsigned> inducedPoint = calculateInduced( point ).first;
+	colors().insert( inducedPoint, color );
+	mVertices.emplace( inducedPoint, color );
 }
 
 template <typename Number>
 void Grid<Number>::insertInduced( const Point<unsigned> &inducedPoint, bool color ) {
-	mGridMap[inducedPoint] = color;
+	colors().set( inducedPoint, color );
 	mVertices.emplace( inducedPoint, color );
 }
 
@@ -486,8 +486,10 @@ void Grid<Number>::addCoordinate( Number value, unsigned dimension ) {
 		++pos;
 	}
 
-	if ( ( pos == mInducedGridPoints[dimension].end() ) || ( *pos > value ) )  // if equal, do nothing
+	if ( ( pos == mInducedGridPoints[dimension].end() ) || ( *pos > value ) ) {  // if equal, do nothing
 		mInducedGridPoints[dimension].insert( pos, value );
+		mExtentsOutdated = true;
+	}
 }
 
 template <typename Number>
@@ -516,24 +518,20 @@ Grid<Number> Grid<Number>::combine( const Grid<Number> &a, const Grid<Number> &b
 
 template <typename Number>
 void Grid<Number>::clear() {
-	mGridMap.clear();
+	mColors.clear();
+	mExtentsOutdated = false;
 	mVertices.clear();
 	mInducedGridPoints.clear();
 }
 
 template <typename Number>
-typename Grid<Number>::gridMap::const_iterator Grid<Number>::find( const Point<Number> &point ) const {
-	return mGridMap.find( calculateInduced( point ).first );
+bool Grid<Number>::hasColor( const Point<Number> &point ) const {
+	return colors().find( calculateInduced( point ).first ).first;
 }
 
 template <typename Number>
-typename Grid<Number>::gridMap::const_iterator Grid<Number>::findInduced( const Point<unsigned> &inducedPoint ) const {
-	return mGridMap.find( inducedPoint );
-}
-
-template <typename Number>
-typename Grid<Number>::gridMap::const_iterator Grid<Number>::end() const {
-	return mGridMap.end();
+bool Grid<Number>::hasColorInduced( const Point<unsigned> &inducedPoint ) const {
+	return colors().find( inducedPoint ).first;
 }
 
 template <typename Number>
@@ -558,12 +556,13 @@ void Grid<Number>::induceGrid( const vSet<Number> &vertices ) {
 
 		mInducedGridPoints[i] = v;
 	}
+	updateExtents();
 
 	// set color of origin manually (always white)
 	// this->insertInduced(Point<unsigned>::Zero(mInducedGridPoints.size()),
 	// false);
-	mGridMap.insert( std::make_pair( Point<unsigned>::Zero( mInducedGridPoints.size() ),
-									 false ) );  // insert only in gridmap to not affect the size
+	colors().insert( Point<unsigned>::Zero( mInducedGridPoints.size() ),
+					false );  // insert only in the color store to not affect the size
 
 	// set up datastructures for colors of vertices and vertices
 	for ( auto it : vertices ) {
@@ -638,4 +637,13 @@ vSet<Number> Grid<Number>::translateToOriginal( const vSet<unsigned> &inducedVer
 	}
 	return original;
 }
+
+template <typename Number>
+void Grid<Number>::updateExtents() const {
+	// induced coordinates range up to the number of grid coordinates, as successors of the last coordinate are kept.
+	std::vector<unsigned> extents;
+	for ( const auto &vecPair : mInducedGridPoints ) extents.push_back( vecPair.second.size() + 1 );
+	mColors.reshape( extents );
+	mExtentsOutdated = false;
+}
 }
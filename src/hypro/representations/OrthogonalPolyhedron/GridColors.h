@@ -0,0 +1,203 @@
+/**
+ * A bit-packed color store for induced grids.
+ * @file    GridColors.h
+ */
+
+#pragma once
+
+#include "../../config.h"
+#include "../../datastructures/Point.h"
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class storing the colors of the points of an induced grid.
+ * @details    Points are identified by the mixed-radix encoding of their induced coordinates, where the last dimension
+ * varies fastest. Two bits are stored per point, one marking that the color is known and one holding the color. Points
+ * outside of the extents of the grid, as well as all points of grids with more than GRID_DENSE_COLOR_LIMIT points, are
+ * stored in a hash map instead.
+ */
+class GridColors {
+  private:
+	static const unsigned pointsPerWord = 32;
+
+	std::vector<unsigned> mExtents;
+	std::vector<std::uint64_t> mStrides;
+	std::vector<std::uint64_t> mBits;
+	std::unordered_map<Point<unsigned>, bool> mSparse;
+	std::size_t mSize = 0;
+	bool mDense = false;
+
+  public:
+	GridColors() = default;
+	GridColors( const GridColors& orig ) = default;
+	GridColors( GridColors&& orig ) = default;
+	~GridColors() {}
+
+	GridColors& operator=( const GridColors& orig ) = default;
+	GridColors& operator=( GridColors&& orig ) = default;
+
+	/**
+	 * @brief      Returns the number of points with known color.
+	 */
+	std::size_t size() const { return mSize; }
+	bool empty() const { return mSize == 0; }
+	bool isDense() const { return mDense; }
+
+	/**
+	 * @brief      Removes all colors and extents.
+	 */
+	void clear() {
+		mExtents.clear();
+		mStrides.clear();
+		mBits.clear();
+		mSparse.clear();
+		mSize = 0;
+		mDense = false;
+	}
+
+	/**
+	 * @brief      Sets the number of induced coordinates per dimension, the known colors are kept.
+	 * @param[in]  extents  The number of induced coordinates for each dimension.
+	 */
+	void reshape( const std::vector<unsigned>& extents ) {
+		std::vector<std::pair<Point<unsigned>, bool>> entries = collect();
+		clear();
+		mExtents = extents;
+		mStrides = std::vector<std::uint64_t>( extents.size(), 1 );
+		std::uint64_t count = extents.empty() ? 0 : 1;
+		for ( std::size_t d = extents.size(); d > 0; --d ) {
+			mStrides[d - 1] = count;
+			if ( extents[d - 1] == 0 || count > GRID_DENSE_COLOR_LIMIT / extents[d - 1] ) {
+				count = GRID_DENSE_COLOR_LIMIT + 1;
+				break;
+			}
+			count *= extents[d - 1];
+		}
+		mDense = count > 0 && count <= GRID_DENSE_COLOR_LIMIT;
+		if ( mDense ) {
+			mBits = std::vector<std::uint64_t>( ( count + pointsPerWord - 1 ) / pointsPerWord, 0 );
+		}
+		for ( const auto& entry : entries ) {
+			set( entry.first, entry.second );
+		}
+	}
+
+	/**
+	 * @brief      Looks up the color of a point.
+	 * @param[in]  point  The induced point.
+	 * @return     True and the color, if the color is known. False otherwise.
+	 */
+	std::pair<bool, bool> find( const Point<unsigned>& point ) const {
+		std::uint64_t index;
+		if ( encode( point, index ) ) {
+			std::uint64_t slot = mBits[index / pointsPerWord] >> ( 2 * ( index % pointsPerWord ) );
+			return std::make_pair( ( slot & 1 ) == 1, ( slot & 2 ) == 2 );
+		}
+		auto entry = mSparse.find( point );
+		if ( entry == mSparse.end() ) {
+			return std::make_pair( false, false );
+		}
+		return std::make_pair( true, entry->second );
+	}
+
+	/**
+	 * @brief      Sets the color of a point, the previous color is overwritten.
+	 */
+	void set( const Point<unsigned>& point, bool color ) {
+		std::uint64_t index;
+		if ( encode( point, index ) ) {
+			std::uint64_t& word = mBits[index / pointsPerWord];
+			unsigned shift = 2 * ( index % pointsPerWord );
+			if ( ( ( word >> shift ) & 1 ) == 0 ) {
+				++mSize;
+			}
+			word = ( word & ~( std::uint64_t( 3 ) << shift ) ) | ( std::uint64_t( color ? 3 : 1 ) << shift );
+			return;
+		}
+		if ( mSparse.find( point ) == mSparse.end() ) {
+			++mSize;
+		}
+		mSparse[point] = color;
+	}
+
+	/**
+	 * @brief      Sets the color of a point, if it is not yet known.
+	 * @return     True, if the color has been set.
+	 */
+	bool insert( const Point<unsigned>& point, bool color ) {
+		if ( find( point ).first ) {
+			return false;
+		}
+		set( point, color );
+		return true;
+	}
+
+	/**
+	 * @brief      Returns all points whose known color equals the passed color in lexicographic order.
+	 */
+	std::vector<Point<unsigned>> points( bool color ) const {
+		std::vector<Point<unsigned>> result;
+		std::uint64_t pattern = color ? 3 : 1;
+		for ( std::size_t wordIndex = 0; wordIndex < mBits.size(); ++wordIndex ) {
+			std::uint64_t word = mBits[wordIndex];
+			for ( unsigned pos = 0; word != 0; ++pos, word >>= 2 ) {
+				if ( ( word & 3 ) == pattern ) {
+					result.emplace_back( decode( wordIndex * pointsPerWord + pos ) );
+				}
+			}
+		}
+		if ( !mSparse.empty() ) {
+			for ( const auto& entry : mSparse ) {
+				if ( entry.second == color ) {
+					result.push_back( entry.first );
+				}
+			}
+			std::sort( result.begin(), result.end() );
+		}
+		return result;
+	}
+
+  private:
+	bool encode( const Point<unsigned>& point, std::uint64_t& index ) const {
+		if ( !mDense || point.dimension() != mExtents.size() ) {
+			return false;
+		}
+		index = 0;
+		for ( std::size_t d = 0; d < mExtents.size(); ++d ) {
+			unsigned coordinate = point.at( unsigned( d ) );
+			if ( coordinate >= mExtents[d] ) {
+				return false;
+			}
+			index += coordinate * mStrides[d];
+		}
+		return true;
+	}
+
+	Point<unsigned> decode( std::uint64_t index ) const {
+		vector_t<unsigned> coordinates = vector_t<unsigned>( mExtents.size() );
+		for ( std::size_t d = 0; d < mExtents.size(); ++d ) {
+			coordinates( d ) = unsigned( index / mStrides[d] );
+			index %= mStrides[d];
+		}
+		return Point<unsigned>( coordinates );
+	}
+
+	std::vector<std::pair<Point<unsigned>, bool>> collect() const {
+		std::vector<std::pair<Point<unsigned>, bool>> entries;
+		entries.reserve( mSize );
+		for ( const auto& point : points( true ) ) {
+			entries.emplace_back( point, true );
+		}
+		for ( const auto& point : points( false ) ) {
+			entries.emplace_back( point, false );
+		}
+		return entries;
+	}
+};
+
+}  // namespace hypro
@@ -0,0 +1,279 @@
+/**
+ * Boolean operations on the cell colors of induced grids.
+ * @file    GridSweep.h
+ */
+
+#pragma once
+
+#include "Grid.h"
+#include "../../config.h"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for Boolean operations on orthogonal polyhedra, which are given by the colors of the cells of a common
+ * induced grid.
+ * @details    The color of a grid point is the color of the cell spanned by the point and its direct successor. The
+ * colors of all cells are stored as a bit array in lexicographic order, where the last dimension varies fastest, such that
+ * the i-predecessor of a cell is found at a fixed offset. Boolean operations are performed word-wise on these arrays.
+ * Vertices are extracted by one sweep per dimension i: cells differing from their i-predecessor are marked and the marks
+ * are spread to the i-neighborhoods, i.e. to the direct successors in all other dimensions. A point is a vertex, iff it
+ * is marked for all dimensions. The bit arrays are only allocated for grids with at most GRID_DENSE_COLOR_LIMIT cells,
+ * callers have to check dense() before computing colors.
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class GridSweep {
+  public:
+	using bits = std::vector<std::uint64_t>;
+
+  private:
+	std::vector<std::vector<Number>> mCoordinates;  // sorted coordinates for each dimension
+	std::vector<std::uint64_t> mStrides;
+	std::uint64_t mSize;
+
+  public:
+	/**
+	 * @brief      Constructor from the grids of two polyhedra of the same dimension, the coordinates are merged.
+	 */
+	GridSweep( const Grid<Number>& lhs, const Grid<Number>& rhs ) : mCoordinates(), mStrides(), mSize( 1 ) {
+		assert( lhs.dimension() == rhs.dimension() );
+		for ( unsigned d = 0; d < lhs.dimension(); ++d ) {
+			std::vector<Number> lhsCoordinates = lhs.inducedDimensionAt( d );
+			std::vector<Number> rhsCoordinates = rhs.inducedDimensionAt( d );
+			std::vector<Number> merged;
+			merged.reserve( lhsCoordinates.size() + rhsCoordinates.size() );
+			std::merge( lhsCoordinates.begin(), lhsCoordinates.end(), rhsCoordinates.begin(), rhsCoordinates.end(),
+						std::back_inserter( merged ) );
+			merged.erase( std::unique( merged.begin(), merged.end() ), merged.end() );
+			mCoordinates.emplace_back( std::move( merged ) );
+		}
+		// the strides are only needed for dense grids, the size saturates beyond the limit to avoid overflows.
+		mStrides = std::vector<std::uint64_t>( mCoordinates.size(), 1 );
+		for ( std::size_t d = mCoordinates.size(); d > 0; --d ) {
+			mStrides[d - 1] = mSize;
+			if ( mSize != 0 && mCoordinates[d - 1].size() > GRID_DENSE_COLOR_LIMIT / mSize ) {
+				mSize = GRID_DENSE_COLOR_LIMIT + 1;
+				break;
+			}
+			mSize *= mCoordinates[d - 1].size();
+		}
+	}
+
+	/**
+	 * @brief      Returns the number of cells.
+	 */
+	std::uint64_t size() const { return mSize; }
+
+	/**
+	 * @brief      Returns true, if the common grid has at most GRID_DENSE_COLOR_LIMIT cells, such that its colors can be
+	 * stored as bit arrays.
+	 */
+	bool dense() const { return mSize <= GRID_DENSE_COLOR_LIMIT; }
+
+	/**
+	 * @brief      Computes the colors of all cells of the common grid for the polyhedron given by the passed grid.
+	 */
+	bits colors( const Grid<Number>& grid ) const {
+		assert( dense() );
+		bits result = zeros();
+		std::size_t dim = mCoordinates.size();
+		if ( dim == 0 ) {
+			return result;
+		}
+		grid.colorAll();
+
+		// map each common coordinate to the induced coordinate of the grid, -1 marks coordinates below the grid.
+		std::vector<std::vector<int>> positions( dim );
+		for ( std::size_t d = 0; d < dim; ++d ) {
+			std::vector<Number> own = grid.inducedDimensionAt( unsigned( d ) );
+			int pos = -1;
+			for ( const auto& coordinate : mCoordinates[d] ) {
+				while ( pos + 1 < int( own.size() ) && own[pos + 1] <= coordinate ) {
+					++pos;
+				}
+				positions[d].push_back( pos );
+			}
+		}
+
+		// traverse all cells in lexicographic order and update only the changed coordinates of the induced point.
+		std::vector<std::size_t> current( dim, 0 );
+		Point<unsigned> induced = Point<unsigned>::Zero( unsigned( dim ) );
+		unsigned below = 0;
+		for ( std::size_t d = 0; d < dim; ++d ) {
+			below += positions[d][0] < 0 ? 1 : 0;
+			induced[d] = positions[d][0] < 0 ? 0 : unsigned( positions[d][0] );
+		}
+		for ( std::uint64_t index = 0; index < mSize; ++index ) {
+			if ( below == 0 && grid.colorAtInduced( induced ) ) {
+				result[index / 64] |= std::uint64_t( 1 ) << ( index % 64 );
+			}
+			std::size_t d = dim;
+			while ( d > 0 && current[d - 1] + 1 == mCoordinates[d - 1].size() ) {
+				current[d - 1] = 0;
+				update( positions[d - 1], d - 1, current, induced, below );
+				--d;
+			}
+			if ( d == 0 ) {
+				break;
+			}
+			++current[d - 1];
+			update( positions[d - 1], d - 1, current, induced, below );
+		}
+		return result;
+	}
+
+	/**
+	 * @brief      Returns the vertices of the polyhedron given by the passed cell colors.
+	 */
+	std::vector<Vertex<Number>> vertices( const bits& colors ) const {
+		std::size_t dim = mCoordinates.size();
+		std::vector<Vertex<Number>> result;
+		if ( dim == 0 ) {
+			return result;
+		}
+
+		bits candidates = ones();
+		for ( std::size_t i = 0; i < dim; ++i ) {
+			// mark cells differing from their i-predecessor, cells below the grid are white.
+			bits marks = shifted( colors, mStrides[i] );
+			conjunction( marks, predecessorMask( i ) );
+			exclusiveDisjunction( marks, colors );
+			// spread the marks along all other dimensions to obtain the i-neighborhoods.
+			for ( std::size_t j = 0; j < dim; ++j ) {
+				if ( j != i ) {
+					dilate( marks, j );
+				}
+			}
+			conjunction( candidates, marks );
+		}
+
+		for ( std::size_t wordIndex = 0; wordIndex < candidates.size(); ++wordIndex ) {
+			std::uint64_t word = candidates[wordIndex];
+			while ( word != 0 ) {
+				unsigned pos = 0;
+				while ( ( ( word >> pos ) & 1 ) == 0 ) {
+					++pos;
+				}
+				word &= ~( std::uint64_t( 1 ) << pos );
+				std::uint64_t index = wordIndex * 64 + pos;
+				result.emplace_back( point( index ), ( ( colors[wordIndex] >> pos ) & 1 ) == 1 );
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * @brief      Colors each cell black, whose i-predecessor is black. Afterwards a cell is black, iff its lower facet in
+	 * dimension i belongs to the closure of the black cells.
+	 */
+	void dilate( bits& colors, std::size_t i ) const {
+		bits spread = shifted( colors, mStrides[i] );
+		conjunction( spread, predecessorMask( i ) );
+		disjunction( colors, spread );
+	}
+
+	/**
+	 * @brief      Returns true, if no cell is black in both passed color arrays.
+	 */
+	static bool disjoint( const bits& lhs, const bits& rhs ) {
+		assert( lhs.size() == rhs.size() );
+		for ( std::size_t wordIndex = 0; wordIndex < lhs.size(); ++wordIndex ) {
+			if ( ( lhs[wordIndex] & rhs[wordIndex] ) != 0 ) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void conjunction( bits& lhs, const bits& rhs ) {
+		assert( lhs.size() == rhs.size() );
+		for ( std::size_t wordIndex = 0; wordIndex < lhs.size(); ++wordIndex ) lhs[wordIndex] &= rhs[wordIndex];
+	}
+
+	static void disjunction( bits& lhs, const bits& rhs ) {
+		assert( lhs.size() == rhs.size() );
+		for ( std::size_t wordIndex = 0; wordIndex < lhs.size(); ++wordIndex ) lhs[wordIndex] |= rhs[wordIndex];
+	}
+
+	static void exclusiveDisjunction( bits& lhs, const bits& rhs ) {
+		assert( lhs.size() == rhs.size() );
+		for ( std::size_t wordIndex = 0; wordIndex < lhs.size(); ++wordIndex ) lhs[wordIndex] ^= rhs[wordIndex];
+	}
+
+	/**
+	 * @brief      Inverts the passed colors, i.e. computes the complement with respect to the cells of the grid.
+	 */
+	void complement( bits& colors ) const {
+		for ( auto& word : colors ) word = ~word;
+		clearTail( colors );
+	}
+
+  private:
+	bits zeros() const { return bits( ( mSize + 63 ) / 64, 0 ); }
+
+	bits ones() const {
+		bits result( ( mSize + 63 ) / 64, ~std::uint64_t( 0 ) );
+		clearTail( result );
+		return result;
+	}
+
+	void clearTail( bits& array ) const {
+		if ( mSize % 64 != 0 ) {
+			array.back() &= ( std::uint64_t( 1 ) << ( mSize % 64 ) ) - 1;
+		}
+	}
+
+	// moves every bit by the passed offset towards higher indices.
+	bits shifted( const bits& array, std::uint64_t offset ) const {
+		bits result = zeros();
+		std::size_t wordShift = std::size_t( offset / 64 );
+		unsigned bitShift = unsigned( offset % 64 );
+		for ( std::size_t wordIndex = wordShift; wordIndex < result.size(); ++wordIndex ) {
+			result[wordIndex] = array[wordIndex - wordShift] << bitShift;
+			if ( bitShift != 0 && wordIndex > wordShift ) {
+				result[wordIndex] |= array[wordIndex - wordShift - 1] >> ( 64 - bitShift );
+			}
+		}
+		clearTail( result );
+		return result;
+	}
+
+	// marks all cells which have an i-predecessor in the grid.
+	bits predecessorMask( std::size_t i ) const {
+		bits result = ones();
+		std::uint64_t block = mStrides[i] * mCoordinates[i].size();
+		for ( std::uint64_t start = 0; start < mSize; start += block ) {
+			for ( std::uint64_t index = start; index < start + mStrides[i]; ++index ) {
+				result[index / 64] &= ~( std::uint64_t( 1 ) << ( index % 64 ) );
+			}
+		}
+		return result;
+	}
+
+	void update( const std::vector<int>& positions, std::size_t d, const std::vector<std::size_t>& current,
+				 Point<unsigned>& induced, unsigned& below ) const {
+		bool wasBelow = ( current[d] == 0 ? positions.back() : positions[current[d] - 1] ) < 0;
+		int pos = positions[current[d]];
+		bool isBelow = pos < 0;
+		if ( wasBelow != isBelow ) {
+			below = isBelow ? below + 1 : below - 1;
+		}
+		induced[d] = isBelow ? 0 : unsigned( pos );
+	}
+
+	Point<Number> point( std::uint64_t index ) const {
+		vector_t<Number> coordinates = vector_t<Number>( mCoordinates.size() );
+		for ( std::size_t d = 0; d < mCoordinates.size(); ++d ) {
+			coordinates( d ) = mCoordinates[d][std::size_t( index / mStrides[d] )];
+			index %= mStrides[d];
+		}
+		return Point<Number>( coordinates );
+	}
+};
+
+}  // namespace hypro
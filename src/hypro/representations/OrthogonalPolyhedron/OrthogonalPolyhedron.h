@@ -13,11 +13,13 @@
 #include "../Box/Box.h"
 #include "NeighborhoodContainer.h"
 #include "Grid.h"
+#include "GridSweep.h"
 
 #include <iostream>
 #include <string>
 #include <map>
 #include <list>
+#include <set>
 #include <vector>
 #include <fstream>
 
@@ -129,6 +131,13 @@ class OrthogonalPolyhedronT {
 
   private:
 	void updateBoundaryBox() const;
+
+	/**
+	 * @brief      Computes the union (black dominates) or the intersection (white dominates) by testing the vertex
+	 * condition for all potential vertices. Used instead of a GridSweep, if the common grid has too many cells.
+	 */
+	OrthogonalPolyhedronT<Number, Converter, Type> combineVertices( const OrthogonalPolyhedronT<Number, Converter, Type>& rhs,
+																	bool blackDominates ) const;
 };
 
 }  // namespace
@@ -207,71 +207,23 @@ OrthogonalPolyhedronT<Number, Converter, Type> OrthogonalPolyhedronT<Number, Con
 template <typename Number, typename Converter, ORTHO_TYPE Type>
 OrthogonalPolyhedronT<Number, Converter, Type> OrthogonalPolyhedronT<Number, Converter, Type>::intersect(
 	  const OrthogonalPolyhedronT<Number, Converter, Type> &rhs ) const {
-	std::vector<Vertex<Number>> potentialVertices;
-	std::vector<Vertex<Number>> v1 = this->vertices();
-	std::vector<Vertex<Number>> v2 = rhs.vertices();
-	std::vector<Vertex<Number>> resVertices;
-
-	// potential vertices are all original vertices and their pairwise
-	// componentwise-max.
-	potentialVertices.insert( potentialVertices.end(), v1.begin(), v1.end() );
-	potentialVertices.insert( potentialVertices.end(), v2.begin(), v2.end() );
-	for ( const auto &vA : v1 ) {
-		for ( const auto &vB : v2 ) {
-			potentialVertices.emplace_back( Point<Number>::coeffWiseMax( vA.point(), vB.point() ) );
-		}
+	if ( this->empty() || rhs.empty() ) {
+		return OrthogonalPolyhedronT<Number, Converter, Type>();
 	}
-	std::unique( potentialVertices.begin(), potentialVertices.end() );
 
-	Grid<Number> aCombination = Grid<Number>::combine( this->mGrid, rhs.grid() );
-	Grid<Number> bCombination = Grid<Number>::combine( this->mGrid, rhs.grid() );
-
-	for ( const auto &vertex : v1 ) {
-		aCombination.insert( vertex.point(), vertex.color() );
+	// a cell of the combined grid is black, iff it is black in both polyhedra.
+	GridSweep<Number> sweep( this->mGrid, rhs.grid() );
+	if ( !sweep.dense() ) {
+		return combineVertices( rhs, false );
 	}
+	typename GridSweep<Number>::bits colors = sweep.colors( this->mGrid );
+	GridSweep<Number>::conjunction( colors, sweep.colors( rhs.grid() ) );
 
-	for ( const auto &vertex : v2 ) bCombination.insert( vertex.point(), vertex.color() );
-
-	for ( auto pIt = potentialVertices.begin(); pIt != potentialVertices.end(); ++pIt ) {
-		// std::cout << "Consider potential vertex " << *pIt << std::endl;
-
-		std::vector<Point<Number>> neighborsA = aCombination.neighborhood( pIt->point() );
-		std::vector<Point<Number>> neighborsB = bCombination.neighborhood( pIt->point() );
-
-		// ATTENTION: As both combination-grids should be identical, the neighbor
-		// order should be too - we assume that
-		// here!
-		assert( neighborsA.size() == neighborsB.size() );
-		std::vector<Vertex<Number>> vertices;
-		for ( unsigned id = 0; id < neighborsA.size(); ++id ) {
-			// white dominates
-			if ( aCombination.colorAt( neighborsA[id] ) == true && bCombination.colorAt( neighborsB[id] ) == true ) {
-				vertices.emplace_back( neighborsA[id], true );
-			} else {
-				vertices.emplace_back( neighborsA[id], false );
-			}
-		}
-
-		// std::cout << "Unified neighborhood: ";
-		// for(const auto& v : vertices)
-		//	std::cout << v << " ";
-
-		// std::cout << std::endl;
-
-		Grid<Number> tmp( vertices );
-		if ( tmp.isVertex( pIt->point() ) ) {
-			bool color = tmp.colorAt( pIt->point() );
-			// std::cout << "Is vertex " << pIt->point() << " " << color << std::endl;
-			resVertices.emplace_back( pIt->point(), color );
-		}
+	std::vector<Vertex<Number>> vertices = sweep.vertices( colors );
+	if ( vertices.empty() ) {
+		return OrthogonalPolyhedronT<Number, Converter, Type>();
 	}
-
-	// std::cout << "Computed vertices: " << std::endl;
-	// for(const auto& v : resVertices ) {
-	//	std::cout << v << std::endl;
-	//}
-
-	return ( OrthogonalPolyhedronT<Number, Converter, Type>( std::move( resVertices ) ) );
+	return ( OrthogonalPolyhedronT<Number, Converter, Type>( std::move( vertices ) ) );
 }
 
 template <typename Number, typename Converter, ORTHO_TYPE Type>
@@ -312,21 +264,51 @@ bool OrthogonalPolyhedronT<Number, Converter, Type>::contains( const Point<Numbe
 
 template <typename Number, typename Converter, ORTHO_TYPE Type>
 bool OrthogonalPolyhedronT<Number, Converter, Type>::contains( const OrthogonalPolyhedronT<Number, Converter, Type> &_other ) const {
-	for ( const auto &vertex : _other.vertices() ) {
-		if ( !contains( vertex.point() ) ) return false;
+	if ( _other.empty() ) {
+		return true;
 	}
-	return true;
+	if ( this->empty() ) {
+		return false;
+	}
+
+	// the other polyhedron is contained, iff none of its black cells is white here.
+	GridSweep<Number> sweep( this->mGrid, _other.grid() );
+	if ( !sweep.dense() ) {
+		// too many cells for bit arrays: the other polyhedron is contained, iff it equals the intersection.
+		std::vector<Vertex<Number>> otherVertices = _other.vertices();
+		std::vector<Vertex<Number>> intersectionVertices = combineVertices( _other, false ).vertices();
+		return std::set<Vertex<Number>>( otherVertices.begin(), otherVertices.end() ) ==
+			   std::set<Vertex<Number>>( intersectionVertices.begin(), intersectionVertices.end() );
+	}
+	typename GridSweep<Number>::bits colors = sweep.colors( this->mGrid );
+	sweep.complement( colors );
+	return GridSweep<Number>::disjoint( colors, sweep.colors( _other.grid() ) );
 }
 
 template <typename Number, typename Converter, ORTHO_TYPE Type>
 OrthogonalPolyhedronT<Number, Converter, Type> OrthogonalPolyhedronT<Number, Converter, Type>::unite(
 	  const OrthogonalPolyhedronT<Number, Converter, Type> &rhs ) const {
-	/* Algorithm: create combined grids each, for each potential vertex determine
-	 * vertex condition, black dominates,
-	 * same as for intersection, just inverted:
-	 * If vertex condition holds, color = color in originals, black dominates.
-	 */
+	if ( this->empty() ) {
+		return rhs;
+	}
+	if ( rhs.empty() ) {
+		return *this;
+	}
+
+	// a cell of the combined grid is black, iff it is black in one of the polyhedra.
+	GridSweep<Number> sweep( this->mGrid, rhs.grid() );
+	if ( !sweep.dense() ) {
+		return combineVertices( rhs, true );
+	}
+	typename GridSweep<Number>::bits colors = sweep.colors( this->mGrid );
+	GridSweep<Number>::disjunction( colors, sweep.colors( rhs.grid() ) );
 
+	return ( OrthogonalPolyhedronT<Number, Converter, Type>( sweep.vertices( colors ) ) );
+}
+
+template <typename Number, typename Converter, ORTHO_TYPE Type>
+OrthogonalPolyhedronT<Number, Converter, Type> OrthogonalPolyhedronT<Number, Converter, Type>::combineVertices(
+	  const OrthogonalPolyhedronT<Number, Converter, Type> &rhs, bool blackDominates ) const {
 	std::vector<Vertex<Number>> potentialVertices;
 	std::vector<Vertex<Number>> v1 = this->vertices();
 	std::vector<Vertex<Number>> v2 = rhs.vertices();
@@ -346,43 +328,26 @@ OrthogonalPolyhedronT<Number, Converter, Type> OrthogonalPolyhedronT<Number, Con
 	Grid<Number> aCombination = Grid<Number>::combine( this->mGrid, rhs.grid() );
 	Grid<Number> bCombination = Grid<Number>::combine( this->mGrid, rhs.grid() );
 
-	for ( const auto &vertex : v1 ) {
-		aCombination.insert( vertex.point(), vertex.color() );
-	}
-
+	for ( const auto &vertex : v1 ) aCombination.insert( vertex.point(), vertex.color() );
 	for ( const auto &vertex : v2 ) bCombination.insert( vertex.point(), vertex.color() );
 
 	for ( auto pIt = potentialVertices.begin(); pIt != potentialVertices.end(); ++pIt ) {
-		// std::cout << "Consider potential vertex " << *pIt << std::endl;
-
 		std::vector<Point<Number>> neighborsA = aCombination.neighborhood( pIt->point() );
 		std::vector<Point<Number>> neighborsB = bCombination.neighborhood( pIt->point() );
 
 		// ATTENTION: As both combination-grids should be identical, the neighbor
-		// order should be too - we assume that
-		// here!
+		// order should be too - we assume that here!
 		assert( neighborsA.size() == neighborsB.size() );
 		std::vector<Vertex<Number>> vertices;
 		for ( unsigned id = 0; id < neighborsA.size(); ++id ) {
-			// black dominates
-			if ( aCombination.colorAt( neighborsA[id] ) == false && bCombination.colorAt( neighborsB[id] ) == false ) {
-				vertices.emplace_back( neighborsA[id], false );
-			} else {
-				vertices.emplace_back( neighborsA[id], true );
-			}
+			bool colorA = aCombination.colorAt( neighborsA[id] );
+			bool colorB = bCombination.colorAt( neighborsB[id] );
+			vertices.emplace_back( neighborsA[id], blackDominates ? ( colorA || colorB ) : ( colorA && colorB ) );
 		}
 
-		// std::cout << "Unified neighborhood: ";
-		// for(const auto& v : vertices)
-		// 	std::cout << v << " ";
-
-		// std::cout << std::endl;
-
 		Grid<Number> tmp( vertices );
 		if ( tmp.isVertex( pIt->point() ) ) {
-			bool color = tmp.colorAt( pIt->point() );
-			// std::cout << "Is vertex " << pIt->point() << " " << color << std::endl;
-			resVertices.emplace_back( pIt->point(), color );
+			resVertices.emplace_back( pIt->point(), tmp.colorAt( pIt->point() ) );
 		}
 	}
 
@@ -172,8 +172,8 @@ namespace hypro
 		 */
 		int computeMaxVDegree();
 		Point<Number> computeMaxPoint();
-		Point<Number> computeInitVertex(PolytopeT<Number,Converter> _secondPoly);
-		Point<Number> localSearch(Point<Number>& _vertex,  Point<Number>& _sinkMaximizerTarget);
+		Point<Number> computeInitVertex(PolytopeT<Number,Converter> _secondPoly, polytope::Decomposition<Number>& _decomposition);
+		Point<Number> localSearch(Point<Number>& _vertex,  Point<Number>& _sinkMaximizerTarget, polytope::Decomposition<Number>& _decomposition);
 
 	};
 } // namespace
@@ -422,6 +422,7 @@ PolytopeT<Number,Converter> PolytopeT<Number,Converter>::altMinkowskiSum( Polyto
 	// within the tests)
 	result = Parma_Polyhedra_Library::C_Polyhedron( 0, EMPTY );
 	std::vector<Point<Number>> alreadyExploredVertices;
+	polytope::Decomposition<Number> decomposition;
 
 	/**
 	 * Preprocessing
@@ -432,7 +433,7 @@ PolytopeT<Number,Converter> PolytopeT<Number,Converter>::altMinkowskiSum( Polyto
 	int delta_2 = rhs.computeMaxVDegree();
 
 	// initVertex = initial extreme point & root of spanning tree
-	Point<Number> initVertex = this->computeInitVertex( rhs );
+	Point<Number> initVertex = this->computeInitVertex( rhs, decomposition );
 	result.addPoint( initVertex );
 	alreadyExploredVertices.push_back( initVertex );
 #ifdef fukuda_DEBUG
@@ -444,10 +445,10 @@ PolytopeT<Number,Converter> PolytopeT<Number,Converter>::altMinkowskiSum( Polyto
 	// compute the maximizer vector (& its target) for the initial extreme point
 	// -> necessary for localSearch()
 	Point<Number> sinkMaximizerTarget;
-	vector_t<Number> sinkMaximizerVector = polytope::computeMaximizerVector( sinkMaximizerTarget, initVertex );
+	vector_t<Number> sinkMaximizerVector = polytope::computeMaximizerVector( sinkMaximizerTarget, initVertex, decomposition );
 
 	// compute the normal cone of the initial extreme point
-	Cone<Number> *cone = polytope::computeCone( initVertex, sinkMaximizerVector );
+	Cone<Number> *cone = polytope::computeCone( initVertex, sinkMaximizerVector, decomposition );
 	// add this normal cone to the fan of the polytope
 	result.rFan().add( cone );
 
@@ -497,7 +498,7 @@ PolytopeT<Number,Converter> PolytopeT<Number,Converter>::altMinkowskiSum( Polyto
 #endif
 
 			// choose next Vertex, only continue if one exists
-			if ( polytope::adjOracle( nextVertex, currentVertex, counter ) ) {
+			if ( polytope::adjOracle( nextVertex, currentVertex, counter, decomposition ) ) {
 				// set neighbors of the vertices accordingly - the adjacency oracle
 				// confirmed neighborship
 				// TODO problem: addNeighbor requires a pointer
@@ -520,7 +521,7 @@ PolytopeT<Number,Converter> PolytopeT<Number,Converter>::altMinkowskiSum( Polyto
 					// dont traverse back and forth between two vertices
 					continue;
 				}
-				Point<Number> localSearchVertex = result.localSearch( nextVertex, sinkMaximizerTarget );
+				Point<Number> localSearchVertex = result.localSearch( nextVertex, sinkMaximizerTarget, decomposition );
 				parentMap.insert( std::make_pair( nextVertex, localSearchVertex ) );
 				if ( localSearchVertex == currentVertex ) {
 					// reverse traverse
@@ -817,15 +818,14 @@ Point<Number> PolytopeT<Number,Converter>::computeMaxPoint() {
  * returns one vertex of the sum polytope P = P1+P2
  */
 template <typename Number, typename Converter>
-Point<Number> PolytopeT<Number,Converter>::computeInitVertex( PolytopeT<Number,Converter> _secondPoly ) {
+Point<Number> PolytopeT<Number,Converter>::computeInitVertex( PolytopeT<Number,Converter> _secondPoly, polytope::Decomposition<Number>& _decomposition ) {
 	Point<Number> p1 = this->computeMaxPoint();
 	Point<Number> p2 = _secondPoly.computeMaxPoint();
 
 	Point<Number> res = p1.extAdd( p2 );
 
 	// remember how the resulting point is composed (v= v1+v2)
-	res.addToComposition( p1 );
-	res.addToComposition( p2 );
+	_decomposition[res] = std::vector<Point<Number>>{ p1, p2 };
 	return res;
 }
 
@@ -834,7 +834,7 @@ Point<Number> PolytopeT<Number,Converter>::computeInitVertex( PolytopeT<Number,C
  * computes the parent of a given vertex w.r.t the sink of the spanning tree
  */
 template <typename Number, typename Converter>
-Point<Number> PolytopeT<Number,Converter>::localSearch( Point<Number> &_vertex, Point<Number> &_sinkMaximizerTarget ) {
+Point<Number> PolytopeT<Number,Converter>::localSearch( Point<Number> &_vertex, Point<Number> &_sinkMaximizerTarget, polytope::Decomposition<Number>& _decomposition ) {
 #ifdef fukuda_DEBUG
 	std::cout << "-------------------------" << std::endl;
 	std::cout << "in the following: Local Search for Vertex " << _vertex << std::endl;
@@ -843,7 +843,7 @@ Point<Number> PolytopeT<Number,Converter>::localSearch( Point<Number> &_vertex,
 
 	// compute the maximizer vector of the currently considered vertex
 	Point<Number> maximizerTarget;
-	vector_t<Number> maximizerVector = polytope::computeMaximizerVector( maximizerTarget, _vertex );
+	vector_t<Number> maximizerVector = polytope::computeMaximizerVector( maximizerTarget, _vertex, _decomposition );
 
 	// compute the ray direction (a vector)
 	vector_t<Number> ray = polytope::computeEdge( maximizerTarget, _sinkMaximizerTarget );
@@ -854,7 +854,7 @@ Point<Number> PolytopeT<Number,Converter>::localSearch( Point<Number> &_vertex,
 #endif
 
 	// compute the normal cone of _vertex
-	Cone<Number> *cone = polytope::computeCone( _vertex, maximizerVector );
+	Cone<Number> *cone = polytope::computeCone( _vertex, maximizerVector, _decomposition );
 
 	// iterate through all planes and check which one intersects with the ray
 	Number factor;
@@ -887,7 +887,7 @@ Point<Number> PolytopeT<Number,Converter>::localSearch( Point<Number> &_vertex,
 	std::cout << "-----------------" << std::endl;
 #endif
 
-	std::vector<vector_t<Number>> decompositionEdges = polytope::computeEdgeSet( _vertex );
+	std::vector<vector_t<Number>> decompositionEdges = polytope::computeEdgeSet( _vertex, _decomposition );
 
 	for ( unsigned i = 0; i < decompositionEdges.size(); i++ ) {
 		Number dotProduct = intersectedPlane.normal().dot( decompositionEdges.at( i ) );
@@ -928,7 +928,7 @@ Point<Number> PolytopeT<Number,Converter>::localSearch( Point<Number> &_vertex,
 			// now we have to retrieve the new vertex in this edge direction, using
 			// the adjacency oracle
 			// the result is stored in secondOrigin
-			bool res = polytope::adjOracle( secondOrigin, _vertex, counter );
+			bool res = polytope::adjOracle( secondOrigin, _vertex, counter, _decomposition );
 			if ( res ) {
 				break;
 			}
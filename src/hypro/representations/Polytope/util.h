@@ -102,7 +102,7 @@ static inline Parma_Polyhedra_Library::Generator pointToGenerator( const vector_
  */
 template <typename Number>
 static inline Parma_Polyhedra_Library::Generator pointToGenerator( const Point<Number>& point ) {
-	return pointToGenerator(point.rawCoordinates());
+	return pointToGenerator(vector_t<Number>(point.rawCoordinates()));
 }
 
 /**
@@ -160,6 +160,12 @@ static inline matrix_t<Number> polytopeToMatrix( const Parma_Polyhedra_Library::
  * Utility Functions for the Minkowski Sum Computation according to Fukuda
  */
 
+/**
+ * maps each vertex v = v1 + v2 of the sum polytope to its decomposition (v1,v2)
+ */
+template <typename Number>
+using Decomposition = std::map<Point<Number>, std::vector<Point<Number>>>;
+
 /**
  * computes the edge between two input points
  */
@@ -206,7 +212,7 @@ Point<Number> computePoint( Point<Number>& _point, vector_t<Number>& _edge, bool
  * computes one adjacent vertex in the sum polytope, given a specific direction (indirectly by the counter)
  */
 template <typename Number>
-bool adjOracle( Point<Number>& result, Point<Number>& _vertex, std::pair<int, int>& _counter ) {
+bool adjOracle( Point<Number>& result, Point<Number>& _vertex, std::pair<int, int>& _counter, Decomposition<Number>& _decomposition ) {
 // retrieve the edge that is defined by the counter (j,i)
 // first get both source & target vertex (dependent on the counter param.)
 #ifdef fukuda_DEBUG
@@ -215,7 +221,7 @@ bool adjOracle( Point<Number>& result, Point<Number>& _vertex, std::pair<int, in
 	std::cout << "-------------------------" << std::endl;
 #endif
 
-	std::vector<Point<Number>> vertexComposition = _vertex.composedOf();
+	const std::vector<Point<Number>>& vertexComposition = _decomposition.at( _vertex );
 	Point<Number> sourceVertex;
 	Point<Number> targetVertex;
 
@@ -403,8 +409,7 @@ bool adjOracle( Point<Number>& result, Point<Number>& _vertex, std::pair<int, in
 			result = targetVertex.extAdd( otherSource );
 
 			// set the composition of the new Vertex accordingly
-			result.addToComposition( targetVertex );
-			result.addToComposition( otherSource );
+			_decomposition[result] = std::vector<Point<Number>>{ targetVertex, otherSource };
 		} else {
 			// if there was a parallel edge: v_new = a1(v1,i1) + a2(v2,i2)
 			Point<Number> otherTargetVertex = computePoint( otherSource, parallelEdge, true );
@@ -414,8 +419,7 @@ bool adjOracle( Point<Number>& result, Point<Number>& _vertex, std::pair<int, in
 #endif
 			result = targetVertex.extAdd( otherTargetVertex );
 
-			result.addToComposition( targetVertex );
-			result.addToComposition( otherTargetVertex );
+			_decomposition[result] = std::vector<Point<Number>>{ targetVertex, otherTargetVertex };
 		}
 	}
 
@@ -434,9 +438,9 @@ bool adjOracle( Point<Number>& result, Point<Number>& _vertex, std::pair<int, in
  * computes the unique maximizer vector for a given vertex (and also the target point of this vector)
  */
 template <typename Number>
-vector_t<Number> computeMaximizerVector( Point<Number>& _targetVertex, Point<Number>& _vertex ) {
+vector_t<Number> computeMaximizerVector( Point<Number>& _targetVertex, Point<Number>& _vertex, const Decomposition<Number>& _decomposition ) {
 	// to prepare the LP, compute all incident edges of v1 & v2 for v=v1+v2
-	std::vector<Point<Number>> vertexComposition = _vertex.composedOf();
+	const std::vector<Point<Number>>& vertexComposition = _decomposition.at( _vertex );
 	Point<Number> sourceVertex1 = vertexComposition[0];
 	Point<Number> sourceVertex2 = vertexComposition[1];
 
@@ -650,8 +654,8 @@ vector_t<Number> computeNormalConeVector( std::vector<vector_t<Number>>& _edgeSe
  * i.e. consider all incident edges at the vertex decomposition
  */
 template <typename Number>
-std::vector<vector_t<Number>> computeEdgeSet( Point<Number>& _vertex ) {
-	std::vector<Point<Number>> vertexComposition = _vertex.composedOf();
+std::vector<vector_t<Number>> computeEdgeSet( Point<Number>& _vertex, const Decomposition<Number>& _decomposition ) {
+	const std::vector<Point<Number>>& vertexComposition = _decomposition.at( _vertex );
 	Point<Number> sourceVertex1 = vertexComposition[0];
 	Point<Number> sourceVertex2 = vertexComposition[1];
 
@@ -680,8 +684,8 @@ std::vector<vector_t<Number>> computeEdgeSet( Point<Number>& _vertex ) {
  * computes the normal cone for a given vertex
  */
 template <typename Number>
-Cone<Number>* computeCone( Point<Number>& _vertex, vector_t<Number>& _maximizerVector ) {
-	std::vector<vector_t<Number>> edges = computeEdgeSet( _vertex );
+Cone<Number>* computeCone( Point<Number>& _vertex, vector_t<Number>& _maximizerVector, const Decomposition<Number>& _decomposition ) {
+	std::vector<vector_t<Number>> edges = computeEdgeSet( _vertex, _decomposition );
 
 	std::vector<vector_t<Number>> tmpEdges;
 	unsigned dimension = edges.at( 0 ).rows();
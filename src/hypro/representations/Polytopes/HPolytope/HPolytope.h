@@ -15,6 +15,8 @@
 #include "../../../util/templateDirections.h"
 #include "../../../util/linearOptimization/Optimizer.h"
 #include "../../../algorithms/convexHull/ConvexHull.h"
+#include "../../../algorithms/convexHull/DoubleDescription.h"
+#include "../../../algorithms/convexHull/QuickHull.h"
 
 #include <algorithm>
 #include <cassert>
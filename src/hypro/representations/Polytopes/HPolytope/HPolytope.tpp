@@ -165,12 +165,12 @@ HPolytopeT<Number, Converter>::HPolytopeT( const std::vector<Point<Number>>& poi
 			mHPlanes = ch.getHsv();
 			*/
 
-			std::vector<std::shared_ptr<Facet<Number>>> facets = convexHull( points ).first;
-			for ( auto &facet : facets ) {
-				assert(facet->halfspace().contains(points));
-				mHPlanes.push_back( facet->halfspace() );
+			QuickHull<Number> qh( points );
+			qh.compute();
+			for ( const auto &plane : qh.getHsv() ) {
+				assert(plane.contains(points));
+				mHPlanes.push_back( plane );
 			}
-			facets.clear();
 
 		}
 	}
@@ -275,74 +275,10 @@ template <typename Number, typename Converter>
 typename std::vector<Point<Number>> HPolytopeT<Number, Converter>::vertices( const Location<Number>* ) const {
 	typename std::vector<Point<Number>> vertices;
 	if(!mHPlanes.empty() && mHPlanes.size() >= this->dimension() && !this->empty()) {
-		unsigned dim = this->dimension();
-
-		Permutator permutator(mHPlanes.size(), dim);
-		std::vector<unsigned> permutation;
-		while(!permutator.end()) {
-			permutation = permutator();
-
-			matrix_t<Number> A( dim, dim );
-			vector_t<Number> b( dim );
-			unsigned pos = 0;
-			//std::cout << "Permute planes ";
-			for(auto planeIt = permutation.begin(); planeIt != permutation.end(); ++planeIt) {
-				//std::cout << *planeIt << ", ";
-				A.row(pos) = mHPlanes.at(*planeIt).normal().transpose();
-				// std::cout << A.row(pos) << std::endl;
-				b(pos) = mHPlanes.at(*planeIt).offset();
-				// std::cout << b(pos) << std::endl;
-				++pos;
-			}
-			//std::cout << std::endl;
-
-			//std::cout << "Created first matrix" << std::endl;
-
-			Eigen::FullPivLU<matrix_t<Number>> lu_decomp( A );
-			if ( lu_decomp.rank() < A.rows() ) {
-				continue;
-			}
-			#ifdef HPOLY_DEBUG_MSG
-			std::cout << convert<Number,double>(A) << std::endl;
-			std::cout << convert<Number,double>(b) << std::endl;
-			#endif
-
-			vector_t<Number> res = lu_decomp.solve( b );
-
-			TRACE("hypro.hPolytope","Computed Vertex: " << (convert<Number,double>(res).transpose()));
-
-			// Check if the computed vertex is a real vertex
-			bool outside = false;
-			for(unsigned planePos = 0; planePos < mHPlanes.size(); ++planePos) {
-				bool skip = false;
-				for(unsigned permPos = 0; permPos < permutation.size(); ++permPos) {
-					if(planePos == permutation.at(permPos)) {
-						//std::cout << "Skip plane " << planePos << std::endl;
-						skip = true;
-						break;
-					}
-				}
-
-				if(!skip) {
-					if( !carl::AlmostEqual2sComplement(mHPlanes.at(planePos).offset(), mHPlanes.at(planePos).normal().dot(res), default_double_comparison_ulps) && mHPlanes.at(planePos).offset() - mHPlanes.at(planePos).normal().dot(res) < 0 ) {
-						TRACE("hypro.hPolytope","Drop vertex: " << (convert<Number,double>(res).transpose()) << " because of plane " << planePos );
-						outside = true;
-						break;
-					}
-				}
-			}
-			if(!outside) {
-				// insert, if no duplicate
-				Point<Number> tmp(res);
-				if(std::find(vertices.begin(), vertices.end(), tmp) == vertices.end()) {
-					vertices.push_back(tmp);
-				}
-				TRACE("hypro.hPolytope","Final vertex: " << (convert<Number,double>(res).transpose()));
-				if(vertices.back().at(0) >= 94.5 && vertices.back().at(0) <= 94.6) {
-					TRACE("hypro.hPolytope","Created by planes " << permutation);
-				}
-			}
-		}
+		DoubleDescription<Number> enumeration(mHPlanes);
+		enumeration.enumerateVertices();
+		vertices = enumeration.getPoints();
+		TRACE("hypro.hPolytope","Computed " << vertices.size() << " vertices.");
 	}
 	return vertices;
 /*
@@ -547,7 +483,17 @@ bool HPolytopeT<Number, Converter>::isExtremePoint( const vector_t<Number>& poin
 
 template <typename Number, typename Converter>
 bool HPolytopeT<Number, Converter>::isExtremePoint( const Point<Number> &point ) const {
-	return isExtremePoint( point.rawCoordinates() );
+	auto coordinates = point.rawCoordinates();
+	unsigned cnt = 0;
+	for ( const auto &plane : mHPlanes ) {
+		Number val = plane.normal().dot( coordinates );
+		if ( plane.offset() == val  ) {
+			++cnt;
+		} else if ( plane.offset() - val < 0 ) {
+			return false;
+		}
+	}
+	return (cnt >= mDimension);
 }
 
 template <typename Number, typename Converter>
@@ -748,7 +694,15 @@ HPolytopeT<Number, Converter> HPolytopeT<Number, Converter>::intersectHalfspaces
 template <typename Number, typename Converter>
 bool HPolytopeT<Number, Converter>::contains( const Point<Number> &point ) const {
 	TRACE("hypro.hPolytope",point);
-	return this->contains( point.rawCoordinates() );
+	// work on the coordinates in place, binding them to a vector_t would copy them.
+	auto coordinates = point.rawCoordinates();
+	for ( const auto &plane : mHPlanes ) {
+		Number value = plane.normal().dot( coordinates );
+		if ( !carl::AlmostEqual2sComplement( value, plane.offset(), 128 ) && value > plane.offset() ) {
+			return false;
+		}
+	}
+	return true;
 }
 
 template <typename Number, typename Converter>
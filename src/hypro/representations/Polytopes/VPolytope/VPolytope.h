@@ -10,11 +10,19 @@
 
 #include "../Cone.h"
 #include "../../../algorithms/convexHull/ConvexHull.h"
+#include "../../../algorithms/convexHull/DoubleDescription.h"
+#include "../../../algorithms/convexHull/QuickHull.h"
 #include "../../../util/convexHull.h"
 #include "../../../util/linearOptimization/Optimizer.h"
 #include "../../../util/Permutator.h"
 #include "../../../util/pca.h"
 #include "../../../datastructures/Facet.h"
+#include "../../../datastructures/PointHashSet.h"
+#ifdef HYPRO_USE_MULTITHREADING
+#include "../../../util/multithreading/ThreadPool.h"
+#include <future>
+#endif
+#include <map>
 #include <set>
 #include <cassert>
 #include <vector>
@@ -277,7 +285,7 @@ class VPolytopeT : public GeometricObject<Number, VPolytopeT<Number,Converter>>
 		return false;
 	}
 
-	bool hasVertex( const vector_t<Number>& vertex ) const { return ( mVertices.find( vertex ) != mVertices.end() ); }
+	bool hasVertex( const vector_t<Number>& vertex ) const { return hasVertex( Point<Number>( vertex ) ); }
 
 	typename pointVector::iterator begin() { return mVertices.begin(); }
 	typename pointVector::const_iterator begin() const { return mVertices.begin(); }
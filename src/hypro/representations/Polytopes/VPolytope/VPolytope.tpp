@@ -23,8 +23,10 @@ VPolytopeT<Number, Converter>::VPolytopeT( const Point<Number> &point ) {
 
 template <typename Number, typename Converter>
 VPolytopeT<Number, Converter>::VPolytopeT( const pointVector &points ) {
-	for ( const auto point : points ) {
-		if(std::find(mVertices.begin(), mVertices.end(), point) == mVertices.end()) {
+	PointHashSet<Number> known;
+	known.reserve( points.size() );
+	for ( const auto& point : points ) {
+		if( known.insert( point ).second ) {
 			mVertices.push_back( point );
 			mNeighbors.push_back( std::set<unsigned>() );
 		}
@@ -35,10 +37,11 @@ VPolytopeT<Number, Converter>::VPolytopeT( const pointVector &points ) {
 
 template <typename Number, typename Converter>
 VPolytopeT<Number, Converter>::VPolytopeT( const std::vector<vector_t<Number>>& rawPoints ) {
-	for ( const auto point : rawPoints ) {
-		Point<Number> tmpPoint(point);
-		if(std::find(mVertices.begin(), mVertices.end(), tmpPoint ) == mVertices.end()) {
-			mVertices.push_back( tmpPoint );
+	PointHashSet<Number> known;
+	known.reserve( rawPoints.size() );
+	for ( const auto& point : rawPoints ) {
+		if( known.insert( point ).second ) {
+			mVertices.emplace_back( point );
 			mNeighbors.push_back( std::set<unsigned>() );
 		}
 	}
@@ -48,70 +51,16 @@ VPolytopeT<Number, Converter>::VPolytopeT( const std::vector<vector_t<Number>>&
 
 template <typename Number, typename Converter>
 VPolytopeT<Number, Converter>::VPolytopeT( const matrix_t<Number> &_constraints, const vector_t<Number> _constants ) {
-	// calculate all possible Halfspace intersections
-
-	//std::cout << __func__ << ": matrix: " << _constraints << " and vector: " << _constants << std::endl;
 	assert(_constraints.rows() == _constants.rows());
-	Permutator permutator = Permutator( _constraints.rows(), _constraints.cols() );
-	matrix_t<Number> intersection = matrix_t<Number>( _constraints.cols(), _constraints.cols() );
-	vector_t<Number> intersectionConstants = vector_t<Number>( _constraints.cols() );
-	std::set<vector_t<Number>> possibleVertices;
-	std::vector<unsigned> permutation;
-	while ( !permutator.end()  ) {
-		permutation = permutator();
-		unsigned rowCount = 0;
-		// std::cout << "Intersect :" << std::endl;
-		for ( const auto &rowIndex : permutation ) {
-			// std::cout << _constraints.row(rowIndex) << " <= " <<
-			// _constants(rowIndex) << std::endl;
-			assert(rowCount < _constraints.cols());
-			intersection.row( rowCount ) = _constraints.row( rowIndex );
-			intersectionConstants( rowCount ) = _constants( rowIndex );
-			++rowCount;
-		}
-		// check if rank is full
-		if ( intersection.fullPivLu().rank() == intersection.cols() ) {
-			vector_t<Number> vertex = intersection.fullPivLu().solve( intersectionConstants );
-			assert(vertex.rows() == _constraints.cols());
-			assert(insidePlanes(vertex, intersection, intersectionConstants));
-			// avoid duplicate entries
-			if(std::find(possibleVertices.begin(), possibleVertices.end(),vertex) == possibleVertices.end()) {
-				possibleVertices.emplace( std::move(vertex) );
-			}
-		}
-	}
-	TRACE("hypro.representations.vpolytope",": Computed " << possibleVertices.size() << " possible vertices.");
-
-	// check if vertices are true vertices (i.e. they fulfill all constraints)
-	for ( auto vertex = possibleVertices.begin(); vertex != possibleVertices.end(); ) {
-		// std::cout<<__func__ << " : " <<__LINE__ << " current position : " << i <<
-		// std::endl;
-		// std::cout<<__func__ << " : " <<__LINE__ << "number of vertices : " <<
-		// possibleVertices.size() << std::endl;
-		bool deleted = false;
-		for ( unsigned rowIndex = 0; rowIndex < _constraints.rows(); ++rowIndex ) {
-			Number res = vertex->dot( _constraints.row( rowIndex ) );
-			if ( !carl::AlmostEqual2sComplement(res, _constants( rowIndex ), 128) && res > _constants( rowIndex ) ){
-				vertex = possibleVertices.erase( vertex );
-				deleted = true;
-				break;
-			}
-		}
-		if(!deleted){
-			++vertex;
-		}
-	}
-
-	TRACE("hypro.representations.vpolytope","Deleted vertices. Remaining " << possibleVertices.size() << " vertices.");
+	// enumerate the vertices output-sensitive instead of intersecting all d-subsets of halfspaces.
+	DoubleDescription<Number> enumeration(_constraints, _constants);
+	enumeration.enumerateVertices();
+	TRACE("hypro.representations.vpolytope",": Computed " << enumeration.getPoints().size() << " vertices.");
 
-	// std::cout<<__func__ << " : " <<__LINE__ <<std::endl;
-	// finish initialization
-	for ( const auto &point : possibleVertices ) {
+	for ( const auto &point : enumeration.getPoints() ) {
 		mVertices.emplace_back( point );
 		mNeighbors.push_back( std::set<unsigned>() );
-		// std::cout << "Real vertex " << point.transpose() << std::endl;
 	}
-	// std::cout<<__func__ << " : " <<__LINE__ <<std::endl;
 	mReduced = false;
 
 	//reduceNumberRepresentation();
@@ -135,9 +84,10 @@ template <typename Number, typename Converter>
 VPolytopeT<Number, Converter> VPolytopeT<Number, Converter>::linearTransformation( const matrix_t<Number> &A ) const {
 	// std::cout << __func__ << " A: " << A << ", b: " << b << std::endl;
 	VPolytopeT<Number, Converter> result;
+	PointHashSet<Number> known;
 	for ( const auto &vertex : mVertices ) {
 		Point<Number> tmp(vertex.linearTransformation( A ));
-		if(std::find(result.begin(), result.end(), tmp) == result.end()) {
+		if( known.insert( tmp ).second ) {
 			result.emplace_back( std::move(tmp) );
 		}
 	}
@@ -151,9 +101,10 @@ VPolytopeT<Number, Converter> VPolytopeT<Number, Converter>::affineTransformatio
 														   const vector_t<Number> &b ) const {
 	// std::cout << __func__ << " A: " << A << ", b: " << b << std::endl;
 	VPolytopeT<Number, Converter> result;
+	PointHashSet<Number> known;
 	for ( const auto &vertex : mVertices ) {
 		Point<Number> tmp(vertex.affineTransformation( A, b ));
-		if(std::find(result.begin(), result.end(), tmp) == result.end()) {
+		if( known.insert( tmp ).second ) {
 			result.emplace_back( std::move(tmp) );
 		}
 	}
@@ -165,10 +116,15 @@ VPolytopeT<Number, Converter> VPolytopeT<Number, Converter>::affineTransformatio
 template <typename Number, typename Converter>
 VPolytopeT<Number, Converter> VPolytopeT<Number, Converter>::minkowskiSum( const VPolytopeT<Number, Converter> &rhs ) const {
 	VPolytopeT<Number, Converter> result;
-	// add each rhs-vertex to each vertex of this polytope.
-	for ( auto lhsVertex : mVertices ) {
-		for ( auto rhsVertex : rhs.mVertices ) {
-			result.insert( lhsVertex + rhsVertex );
+	// add each rhs-vertex to each vertex of this polytope, duplicate sums are dropped in linear time.
+	PointHashSet<Number> sums;
+	sums.reserve( mVertices.size() * rhs.mVertices.size() );
+	for ( const auto& lhsVertex : mVertices ) {
+		for ( const auto& rhsVertex : rhs.mVertices ) {
+			vector_t<Number> sum = lhsVertex.rawCoordinates() + rhsVertex.rawCoordinates();
+			if ( sums.insert( sum ).second ) {
+				result.emplace_back( Point<Number>( std::move( sum ) ) );
+			}
 		}
 	}
 	result.setCone( mCone.minkowskiSum( rhs.cone() ) );
@@ -289,16 +245,21 @@ VPolytopeT<Number, Converter> VPolytopeT<Number, Converter>::unite( const VPolyt
 		//std::cout << __func__ << " : of " << *this << " and " << rhs << std::endl;
 		VPolytopeT<Number, Converter>::pointVector points;
 
-		std::set<Point<Number>> pointSet;
-		pointSet.insert( this->mVertices.begin(), this->mVertices.end() );
-		pointSet.insert( rhs.mVertices.begin(), rhs.mVertices.end() );
+		PointHashSet<Number> pointSet;
+		pointSet.reserve( this->mVertices.size() + rhs.mVertices.size() );
+		for ( const auto& vertex : this->mVertices ) {
+			pointSet.insert( vertex );
+		}
+		for ( const auto& vertex : rhs.mVertices ) {
+			pointSet.insert( vertex );
+		}
 
 		if(pointSet.empty()){
 			return VPolytopeT<Number,Converter>();
 		}
 
-		unsigned effDim = unsigned(effectiveDimension(pointSet));
-		points.insert( points.end(), pointSet.begin(), pointSet.end() );
+		points = pointSet.points();
+		unsigned effDim = unsigned(effectiveDimension(points));
 		assert(!points.empty());
 		TRACE("hypro.representations.vpolytope","Effective dimension: " << effDim << ", points dimension: " << points.begin()->dimension());
 
@@ -307,18 +268,9 @@ VPolytopeT<Number, Converter> VPolytopeT<Number, Converter>::unite( const VPolyt
 			return VPolytopeT<Number,Converter>(points);
 		} else if(points.size() > points.begin()->dimension()){
 			TRACE("hypro.representations.vpolytope","Using convex hull algorithm to reduce point set.");
-			std::vector<std::shared_ptr<Facet<Number>>> facets = convexHull( points ).first;
-			std::set<Point<Number>> preresult;
-			for ( unsigned i = 0; i < facets.size(); i++ ) {
-				for ( unsigned j = 0; j < facets[i]->vertices().size(); j++ ) {
-					preresult.insert( facets[i]->vertices().at( j ) );
-				}
-			}
-			VPolytopeT<Number, Converter>::pointVector res;
-			for ( const auto &point : preresult ) {
-				res.push_back( point );
-			}
-			result = VPolytopeT<Number, Converter>( res );
+			QuickHull<Number> qh( points );
+			qh.compute();
+			result = VPolytopeT<Number, Converter>( qh.getVertices() );
 		} else {
 			result = VPolytopeT<Number, Converter>(points);
 		}
@@ -339,17 +291,19 @@ VPolytopeT<Number,Converter> VPolytopeT<Number,Converter>::unite( const std::vec
 		//std::cout << __func__ << " : of " << *this << " and " << rhs << std::endl;
 		VPolytopeT<Number, Converter>::pointVector points;
 
-		std::set<Point<Number>> pointSet;
+		PointHashSet<Number> pointSet;
 		for(const auto& poly : rhs){
-			pointSet.insert( rhs.mVertices.begin(), rhs.mVertices.end() );
+			for ( const auto& vertex : poly.mVertices ) {
+				pointSet.insert( vertex );
+			}
 		}
 
 		if(pointSet.empty()){
 			return VPolytopeT<Number,Converter>();
 		}
 
-		unsigned effDim = unsigned(effectiveDimension(pointSet));
-		points.insert( points.end(), pointSet.begin(), pointSet.end() );
+		points = pointSet.points();
+		unsigned effDim = unsigned(effectiveDimension(points));
 		assert(!points.empty());
 
 		if(effDim < points.begin()->dimension()){
@@ -400,25 +354,16 @@ VPolytopeT<Number,Converter> VPolytopeT<Number,Converter>::unite( const std::vec
 					}
 				}
 				if(!outside) {
-					pointSet.emplace(res);
+					pointSet.insert(res);
 				}
 			}
-			for ( const auto &point : pointSet ) {
+			for ( const auto &point : pointSet.points() ) {
 				result.insert( point );
 			}
 		} else if(points.size() > points.begin()->dimension()){
-			std::vector<std::shared_ptr<Facet<Number>>> facets = convexHull( points ).first;
-			std::set<Point<Number>> preresult;
-			for ( unsigned i = 0; i < facets.size(); i++ ) {
-				for ( unsigned j = 0; j < facets[i]->vertices().size(); j++ ) {
-					preresult.insert( facets[i]->vertices().at( j ) );
-				}
-			}
-			VPolytopeT<Number, Converter>::pointVector res;
-			for ( const auto &point : preresult ) {
-				res.push_back( point );
-			}
-			result = VPolytopeT<Number, Converter>( res );
+			QuickHull<Number> qh( points );
+			qh.compute();
+			result = VPolytopeT<Number, Converter>( qh.getVertices() );
 		} else {
 			result = VPolytopeT<Number, Converter>(points);
 		}
@@ -445,79 +390,168 @@ Number VPolytopeT<Number, Converter>::supremum() const {
 template <typename Number, typename Converter>
 void VPolytopeT<Number, Converter>::removeRedundancy() {
 	if ( !mReduced ) {
-		#ifdef USE_SMTRAT
-			std::set<Point<Number>> toDelete;
-			smtrat::SimplexSolver simplex;
-			simplex.push();
-
-			// create mapping of variables (lambdas') to vertices.
-			std::map<Point<Number>, carl::Variable> lambdas;
-			for(const auto& vertex : mVertices) {
-				carl::Variable lambda = carl::freshRealVariable();
-				lambdas.insert(std::make_pair(vertex, lambda));
-				//std::cout << "Assigned " << lambdas.find(vertex)->second << " to " << lambdas.find(vertex)->first << std::endl;
+		// duplicates would render each other redundant in the linear programs below.
+		PointHashSet<Number> known;
+		known.reserve( mVertices.size() );
+		for ( const auto &vertex : mVertices ) {
+			known.insert( vertex );
+		}
+		pointVector points = known.points();
+		std::size_t dim = points.empty() ? 0 : points.begin()->dimension();
+
+		// the lexicographically smallest and largest points with respect to each axis are extreme.
+		std::vector<unsigned char> extreme( points.size(), 0 );
+		std::vector<unsigned char> redundant( points.size(), 0 );
+		auto lexLess = [&points, dim]( std::size_t lhs, std::size_t rhs, std::size_t axis ) {
+			if ( points[lhs].at( axis ) != points[rhs].at( axis ) ) {
+				return points[lhs].at( axis ) < points[rhs].at( axis );
 			}
-
-
-			for(auto currVertex = mVertices.begin(); currVertex != mVertices.end(); ){
-				//std::cout << currVertex << ": " << std::endl;
-				// create constraint for Sum(lambdas) == 1
-				carl::MultivariatePolynomial<smtrat::Rational> sumBound;
-				for(const auto& vertex : mVertices) {
-					if(vertex != *currVertex) {
-						carl::Variable lambda = lambdas.find(vertex)->second;
-						sumBound += lambda;
-						smtrat::FormulaT constr = smtrat::FormulaT(carl::MultivariatePolynomial<smtrat::Rational>(lambda), carl::Relation::GEQ);
-						simplex.inform(constr);
-						simplex.add(constr);
-					}
+			for ( std::size_t d = 0; d < dim; ++d ) {
+				if ( points[lhs].at( d ) != points[rhs].at( d ) ) {
+					return points[lhs].at( d ) < points[rhs].at( d );
 				}
-				sumBound -= smtrat::Rational(1);
-				smtrat::FormulaT constr = smtrat::FormulaT(sumBound, carl::Relation::EQ);
-				simplex.inform(constr);
-				simplex.add(constr);
-
-				for(unsigned dim = 0; dim < this->dimension(); ++dim) {
-					carl::MultivariatePolynomial<smtrat::Rational> row;
-					for(const auto& vertex : mVertices ) {
-						if(*currVertex != vertex) {
-							carl::Variable tmp = lambdas.find(vertex)->second;
-							row += tmp*carl::convert<Number, smtrat::Rational>(vertex.at(dim));
-						} else {
-							row -= carl::convert<Number, smtrat::Rational>(vertex.at(dim));
-						}
-					}
-					smtrat::FormulaT constr = smtrat::FormulaT(row, carl::Relation::EQ);
-					//std::cout << constr << std::endl;
-					simplex.inform(constr);
-					simplex.add(constr);
+			}
+			return false;
+		};
+		std::vector<std::size_t> extremeIndices;
+		for ( std::size_t axis = 0; axis < dim && points.size() > 2; ++axis ) {
+			std::size_t minIndex = 0;
+			std::size_t maxIndex = 0;
+			for ( std::size_t index = 1; index < points.size(); ++index ) {
+				if ( lexLess( index, minIndex, axis ) ) minIndex = index;
+				if ( lexLess( maxIndex, index, axis ) ) maxIndex = index;
+			}
+			for ( auto index : {minIndex, maxIndex} ) {
+				if ( !extreme[index] ) {
+					extreme[index] = 1;
+					extremeIndices.push_back( index );
 				}
+			}
+		}
 
-				//std::cout << "Checking: " << std::endl << simplex.formula().toString() << std::endl;
-
-				smtrat::Answer res = simplex.check();
-
-				if(res == smtrat::Answer::SAT) {
-					currVertex = mVertices.erase(currVertex);
-				} else {
-					++currVertex;
+		// points strictly inside a simplex spanned by extreme points are redundant.
+		std::vector<std::size_t> simplex;
+		matrix_t<Number> edges = matrix_t<Number>( dim, 0 );
+		for ( auto index : extremeIndices ) {
+			if ( simplex.empty() ) {
+				simplex.push_back( index );
+				continue;
+			}
+			matrix_t<Number> extended = matrix_t<Number>( dim, edges.cols() + 1 );
+			extended.leftCols( edges.cols() ) = edges;
+			extended.col( edges.cols() ) = points[index].rawCoordinates() - points[simplex.front()].rawCoordinates();
+			if ( unsigned( extended.fullPivLu().rank() ) == extended.cols() ) {
+				edges = extended;
+				simplex.push_back( index );
+			}
+		}
+		if ( simplex.size() == dim + 1 ) {
+			matrix_t<Number> barycentric = edges.fullPivLu().inverse();
+			for ( std::size_t index = 0; index < points.size(); ++index ) {
+				if ( extreme[index] ) {
+					continue;
 				}
-
-				//std::cout << "Is extreme point: " << (res == smtrat::Answer::UNSAT) << std::endl << std::endl << std::endl << std::endl;
-				simplex.pop();
-				simplex.push();
+				vector_t<Number> coefficients = barycentric * ( points[index].rawCoordinates() - points[simplex.front()].rawCoordinates() );
+				bool inside = coefficients.sum() < Number( 1 );
+				for ( unsigned d = 0; d < dim && inside; ++d ) {
+					inside = coefficients( d ) > 0;
+				}
+				redundant[index] = inside ? 1 : 0;
 			}
+		}
 
-			mReduced = true;
+		// the remaining candidates are decided by one linear program each, which share the constraint matrix:
+		// p is extreme iff some hyperplane a*x = beta strictly separates p from all other points. Rows are
+		// a*v - beta <= 0 for all points v, except for the row of p, which is relaxed to a*p - beta <= 1.
+		std::vector<std::size_t> remaining;
+		for ( std::size_t index = 0; index < points.size(); ++index ) {
+			if ( !redundant[index] ) {
+				remaining.push_back( index );
+			}
+		}
+		std::vector<std::size_t> candidates;
+		for ( std::size_t row = 0; row < remaining.size(); ++row ) {
+			if ( !extreme[remaining[row]] ) {
+				candidates.push_back( row );
+			}
+		}
+		matrix_t<Number> constraints = matrix_t<Number>( remaining.size(), dim + 1 );
+		for ( std::size_t row = 0; row < remaining.size(); ++row ) {
+			constraints.block( row, 0, 1, dim ) = points[remaining[row]].rawCoordinates().transpose();
+			constraints( row, dim ) = Number( -1 );
+		}
+		auto check = [&]( std::size_t begin, std::size_t end ) {
+			if ( begin == end ) {
+				return;
+			}
+			vector_t<Number> constants = vector_t<Number>::Zero( remaining.size() );
+			Optimizer<Number> opt( constraints, constants );
+			for ( std::size_t pos = begin; pos < end; ++pos ) {
+				std::size_t row = candidates[pos];
+				constants( row ) = Number( 1 );
+				opt.setVector( constants );
+				// the optimum is either 0 or 1, as the problem is invariant under scaling.
+				EvaluationResult<Number> res = opt.evaluate( vector_t<Number>( constraints.row( row ).transpose() ), true );
+				extreme[remaining[row]] = res.supportValue > Number( 1 ) / Number( 2 ) ? 1 : 0;
+				constants( row ) = Number( 0 );
+			}
+		};
+		#ifdef HYPRO_USE_MULTITHREADING
+		if ( candidates.size() >= 2 * VPOLYTOPE_REDUNDANCY_MIN_CHUNK_SIZE && !ThreadPool::isWorkerThread() ) {
+			ThreadPool &pool = ThreadPool::getInstance();
+			std::size_t chunkCount = std::min( pool.size(), candidates.size() / VPOLYTOPE_REDUNDANCY_MIN_CHUNK_SIZE );
+			std::size_t chunkSize = ( candidates.size() + chunkCount - 1 ) / chunkCount;
+			std::vector<std::future<void>> chunks;
+			for ( std::size_t begin = 0; begin < candidates.size(); begin += chunkSize ) {
+				chunks.emplace_back( pool.enqueue( check, begin, std::min( begin + chunkSize, candidates.size() ) ) );
+			}
+			for ( auto &chunk : chunks ) {
+				chunk.get();
+			}
+		} else {
+			check( 0, candidates.size() );
+		}
 		#else
-			updateNeighbors();
+		check( 0, candidates.size() );
 		#endif
+
+		pointVector oldVertices = std::move( mVertices );
+		std::vector<std::set<unsigned>> oldNeighbors = std::move( mNeighbors );
+		std::map<Point<Number>, unsigned> newIndex;
+		mVertices.clear();
+		for ( auto index : remaining ) {
+			if ( extreme[index] ) {
+				newIndex.emplace( points[index], unsigned( mVertices.size() ) );
+				mVertices.push_back( points[index] );
+			}
+		}
+		// keep the neighborhood among the surviving vertices, duplicates contribute to the same vertex.
+		mNeighbors = std::vector<std::set<unsigned>>( mVertices.size() );
+		for ( std::size_t pos = 0; pos < oldNeighbors.size() && pos < oldVertices.size(); ++pos ) {
+			auto vertexIt = newIndex.find( oldVertices[pos] );
+			if ( vertexIt == newIndex.end() ) {
+				continue;
+			}
+			for ( unsigned nPos : oldNeighbors[pos] ) {
+				auto neighborIt = newIndex.find( oldVertices[nPos] );
+				if ( neighborIt != newIndex.end() && neighborIt->second != vertexIt->second ) {
+					mNeighbors[vertexIt->second].insert( neighborIt->second );
+				}
+			}
+		}
+		TRACE( "hypro.representations.vpolytope", "Reduced " << points.size() << " points to " << mVertices.size() << " vertices." );
+		mReduced = true;
 	}
 }
 
 template <typename Number, typename Converter>
 void VPolytopeT<Number, Converter>::updateNeighbors() {
-	std::map<Point<Number>, std::set<Point<Number>>> neighbors = convexHull( mVertices ).second;
+	QuickHull<Number> qh( mVertices );
+	qh.compute();
+	if ( !qh.isFullDimensional() ) {
+		return;
+	}
+	std::map<Point<Number>, std::set<Point<Number>>> neighbors = qh.getNeighborhood();
 	mVertices.clear();
 	for ( const auto &pointNeighborsPair : neighbors ) {
 		mVertices.push_back( pointNeighborsPair.first );
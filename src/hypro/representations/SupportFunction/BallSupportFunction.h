@@ -50,12 +50,23 @@ class BallSupportFunction {
 
 	/**
 	 * @brief Evaluates the support function in the directions given in the passed matrix.
-	 * @details Uses the standard evaluate method for multiple directions.
+	 * @details Uses the closed form provided by multiEvaluateSupportValues, optimum points are only computed on request.
 	 *
 	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @param computeOptimum If false, the results do not contain optimum points.
 	 * @return Vector of support values.
 	 */
-	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _A ) const;
+	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _A, bool computeOptimum = true ) const;
+
+	/**
+	 * @brief Computes the support values in the directions given in the passed matrix at once.
+	 * @details The support value of a ball in direction l is the radius times the dual norm of l, i.e. the 1-norm for the
+	 * infinity-ball and the 2-norm for the 2-ball.
+	 *
+	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @return Vector holding the support value for each row of _A.
+	 */
+	vector_t<Number> multiEvaluateSupportValues( const matrix_t<Number>& _A ) const;
 
 	/**
 	 * @brief Check if point is contained in the support function.
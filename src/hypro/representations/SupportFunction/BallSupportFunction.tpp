@@ -68,49 +68,76 @@ EvaluationResult<Number> BallSupportFunction<Number>::evaluate( const vector_t<N
 	}
 
 	// there is a non-zero cost function and the ball is not empty.
+	return multiEvaluate(matrix_t<Number>(l.transpose())).front();
+}
+
+template <typename Number>
+std::vector<EvaluationResult<Number>> BallSupportFunction<Number>::multiEvaluate( const matrix_t<Number> &_A, bool computeOptimum ) const {
+	if(mRadius < 0) {
+		return std::vector<EvaluationResult<Number>>(_A.rows(), EvaluationResult<Number>(SOLUTION::INFEAS));
+	}
+	vector_t<Number> supportValues = multiEvaluateSupportValues(_A);
+	std::vector<EvaluationResult<Number>> res;
+	res.reserve(_A.rows());
+	for(unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex) {
+		res.emplace_back(supportValues(rowIndex), SOLUTION::FEAS);
+		if(computeOptimum) {
+			// the optimum is the point of the ball which is extremal in direction l.
+			vector_t<Number> optimum = vector_t<Number>::Zero(_A.cols());
+			switch ( mType ) {
+				case SF_TYPE::INFTY_BALL: {
+					for(unsigned colIndex = 0; colIndex < _A.cols(); ++colIndex) {
+						optimum(colIndex) = _A(rowIndex,colIndex) < 0 ? Number(-mRadius) : mRadius;
+					}
+					break;
+				}
+				case SF_TYPE::TWO_BALL: {
+					if(supportValues(rowIndex) != 0) {
+						optimum = (mRadius * mRadius / supportValues(rowIndex)) * vector_t<Number>(_A.row(rowIndex));
+					}
+					break;
+				}
+				default:
+					assert( false );
+			}
+			res.back().optimumValue = std::move(optimum);
+		}
+	}
+	assert(res.size() == unsigned(_A.rows()));
+
+	return res;
+}
+
+template <typename Number>
+vector_t<Number> BallSupportFunction<Number>::multiEvaluateSupportValues( const matrix_t<Number> &_A ) const {
+	vector_t<Number> res = vector_t<Number>::Zero(_A.rows());
 	switch ( mType ) {
 		case SF_TYPE::INFTY_BALL: {
-			unsigned max = 0;
-			for ( unsigned i = 1; i < l.rows(); ++i ) {
-				max = abs( l( i ) ) > abs( l( max ) ) ? i : max;
+			for(unsigned colIndex = 0; colIndex < _A.cols(); ++colIndex) {
+				for(unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex) {
+					res(rowIndex) += carl::abs(_A(rowIndex,colIndex));
+				}
 			}
-			result.supportValue = ( mRadius / abs( l( max ) ) );
-			result.optimumValue = result.supportValue * normalize(l);
-			result.errorCode = SOLUTION::FEAS;
 			break;
 		}
 		case SF_TYPE::TWO_BALL: {
-			Number length = norm(l,true);
-			if(length == 0) {
-				return EvaluationResult<Number>(l, SOLUTION::FEAS);
+			for(unsigned colIndex = 0; colIndex < _A.cols(); ++colIndex) {
+				for(unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex) {
+					res(rowIndex) += _A(rowIndex,colIndex) * _A(rowIndex,colIndex);
+				}
+			}
+			// round up to obtain an over-approximation for exact number types.
+			for(unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex) {
+				if(res(rowIndex) != 0) {
+					res(rowIndex) = carl::sqrt_safe(res(rowIndex)).second;
+				}
 			}
-			DEBUG("hypro.representations.BallSupportFunction", "l: " << l << ", length: " << length);
-			result.supportValue = ( mRadius / length );
-			result.optimumValue = result.supportValue * normalize(l);
-			result.errorCode = SOLUTION::FEAS;
 			break;
 		}
 		default:
 			assert( false );
 	}
-
-	return result;
-}
-
-template <typename Number>
-std::vector<EvaluationResult<Number>> BallSupportFunction<Number>::multiEvaluate( const matrix_t<Number> &_A ) const {
-	EvaluationResult<Number> r;
-	r.supportValue = mRadius;
-	r.errorCode = mRadius > 0 ? SOLUTION::FEAS : SOLUTION::INFEAS;
-	std::vector<EvaluationResult<Number>> res(_A.rows(), r);
-	unsigned cnt = 0;
-	for(auto& singleRes : res ){
-		singleRes.optimumValue = singleRes.supportValue * normalize(vector_t<Number>(_A.row(cnt)));
-		++cnt;
-	}
-	assert(res.size() == unsigned(_A.rows()));
-
-	return res;
+	return mRadius * res;
 }
 
 template <typename Number>
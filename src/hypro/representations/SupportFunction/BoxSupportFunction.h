@@ -0,0 +1,75 @@
+/*
+ * This file contains the basic implementation of support functions of axis-aligned boxes and their evaluation.
+ * @file BoxSupportFunction.h
+ *
+ * @author Norman Hansen
+ */
+
+#pragma once
+
+#include "util.h"
+#include "../../config.h"
+#include "../../datastructures/Point.h"
+
+namespace hypro {
+
+/*
+* This class defines a support Function object representing an axis-aligned box given by its lower and upper bounds.
+* SupportFunctions can be evaluated in a specified direction l and return a correspondent EvaluationResult
+*/
+template <typename Number>
+class BoxSupportFunction {
+  private:
+	vector_t<Number> mLower;
+	vector_t<Number> mUpper;
+
+  public:
+	BoxSupportFunction( const BoxSupportFunction<Number>& _orig ) = default;
+	BoxSupportFunction( const vector_t<Number>& _lower, const vector_t<Number>& _upper );
+	~BoxSupportFunction() {}
+
+	/**
+	 * Returns the dimension of the object.
+	 * @return
+	 */
+	unsigned dimension() const;
+
+	const vector_t<Number>& lower() const { return mLower; }
+	const vector_t<Number>& upper() const { return mUpper; }
+
+	Point<Number> supremumPoint() const;
+
+	/**
+	 * Evaluates the support function in the given direction.
+	 * @param l
+	 * @return
+	 */
+	EvaluationResult<Number> evaluate( const vector_t<Number>& l ) const;
+
+	/**
+	 * @brief Evaluates the support function in the directions given in the passed matrix.
+	 * @details Uses the closed form provided by multiEvaluateSupportValues, optimum points are only computed on request.
+	 *
+	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @param computeOptimum If false, the results do not contain optimum points.
+	 * @return Vector of support values.
+	 */
+	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _A, bool computeOptimum = true ) const;
+
+	/**
+	 * @brief Computes the support values in the directions given in the passed matrix at once.
+	 * @details The support value of a box in direction l is sum_i max(l_i * lo_i, l_i * hi_i), which equals
+	 * l*c + |l|*r for the center c and the radius r of the box. Thus all values are obtained by two matrix-vector products.
+	 *
+	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @return Vector holding the support value for each row of _A.
+	 */
+	vector_t<Number> multiEvaluateSupportValues( const matrix_t<Number>& _A ) const;
+
+	bool contains( const Point<Number>& _point ) const;
+	bool contains( const vector_t<Number>& _point ) const;
+
+	bool empty() const;
+};
+}  // namespace
+#include "BoxSupportFunction.tpp"
@@ -0,0 +1,96 @@
+/*
+ * This file contains the basic implementation of support functions of axis-aligned boxes and their evaluation.
+ * @file BoxSupportFunction.tpp
+ */
+
+#include "BoxSupportFunction.h"
+
+namespace hypro {
+
+template <typename Number>
+BoxSupportFunction<Number>::BoxSupportFunction( const vector_t<Number>& _lower, const vector_t<Number>& _upper )
+	: mLower( _lower ), mUpper( _upper ) {
+	assert( _lower.rows() == _upper.rows() );
+}
+
+template <typename Number>
+unsigned BoxSupportFunction<Number>::dimension() const {
+	return mLower.rows();
+}
+
+template<typename Number>
+Point<Number> BoxSupportFunction<Number>::supremumPoint() const {
+	vector_t<Number> res = vector_t<Number>( mLower.rows() );
+	for(unsigned d = 0; d < mLower.rows(); ++d) {
+		res(d) = carl::abs(mLower(d)) > carl::abs(mUpper(d)) ? mLower(d) : mUpper(d);
+	}
+	return Point<Number>(res);
+}
+
+template <typename Number>
+EvaluationResult<Number> BoxSupportFunction<Number>::evaluate( const vector_t<Number> &l ) const {
+	if(this->empty()) {
+		return EvaluationResult<Number>();
+	}
+	if(l.rows() == 0){
+		return EvaluationResult<Number>(SOLUTION::FEAS);
+	}
+	return multiEvaluate(matrix_t<Number>(l.transpose())).front();
+}
+
+template <typename Number>
+std::vector<EvaluationResult<Number>> BoxSupportFunction<Number>::multiEvaluate( const matrix_t<Number> &_A, bool computeOptimum ) const {
+	assert(_A.cols() == mLower.rows());
+	if(this->empty()) {
+		return std::vector<EvaluationResult<Number>>(_A.rows(), EvaluationResult<Number>(SOLUTION::INFEAS));
+	}
+	vector_t<Number> supportValues = multiEvaluateSupportValues(_A);
+	std::vector<EvaluationResult<Number>> res;
+	res.reserve(_A.rows());
+	for(unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex) {
+		res.emplace_back(supportValues(rowIndex), SOLUTION::FEAS);
+		if(computeOptimum) {
+			// the optimum is the vertex selecting the upper bound for positive and the lower bound for negative entries.
+			vector_t<Number> optimum = vector_t<Number>( _A.cols() );
+			for(unsigned colIndex = 0; colIndex < _A.cols(); ++colIndex) {
+				optimum(colIndex) = _A(rowIndex,colIndex) < 0 ? mLower(colIndex) : mUpper(colIndex);
+			}
+			res.back().optimumValue = std::move(optimum);
+		}
+	}
+	return res;
+}
+
+template <typename Number>
+vector_t<Number> BoxSupportFunction<Number>::multiEvaluateSupportValues( const matrix_t<Number> &_A ) const {
+	vector_t<Number> center = ( mLower + mUpper ) / Number(2);
+	vector_t<Number> radius = ( mUpper - mLower ) / Number(2);
+	return _A * center + _A.array().abs().matrix() * radius;
+}
+
+template <typename Number>
+bool BoxSupportFunction<Number>::contains( const Point<Number> &_point ) const {
+	return this->contains( _point.rawCoordinates() );
+}
+
+template <typename Number>
+bool BoxSupportFunction<Number>::contains( const vector_t<Number> &_point ) const {
+	assert(_point.rows() == mLower.rows());
+	for(unsigned d = 0; d < mLower.rows(); ++d) {
+		if(_point(d) < mLower(d) || _point(d) > mUpper(d)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename Number>
+bool BoxSupportFunction<Number>::empty() const {
+	for(unsigned d = 0; d < mLower.rows(); ++d) {
+		if(mLower(d) > mUpper(d)) {
+			return true;
+		}
+	}
+	return false;
+}
+}  // namespace
@@ -47,34 +47,27 @@ class EllipsoidSupportFunction {
 	 * @param l
 	 * @return
 	 */
-	//EvaluationResult<Number> evaluate( const vector_t<Number>& _l ) const;
-
-	template<typename N = Number, carl::DisableIf< std::is_same<N,double> > = carl::dummy>
-	EvaluationResult<Number> evaluate( const vector_t<Number> &_l ) const {
-	    EvaluationResult<Number> result ;
-	    result.supportValue = carl::sqrt_safe(_l.dot(this->mShapeMatrix * _l)).first;
-	    result.optimumValue = result.supportValue * _l;
-	    result.errorCode = SOLUTION::FEAS;
-	    return result;
-	}
-
-	template<typename N = Number, carl::EnableIf< std::is_same<N,double> > = carl::dummy>
-	EvaluationResult<Number> evaluate( const vector_t<Number> &_l ) const {
-	    EvaluationResult<Number> result ;
-	    result.supportValue = std::sqrt(_l.dot(this->mShapeMatrix * _l));
-	    result.optimumValue = result.supportValue * _l;
-	    result.errorCode = SOLUTION::FEAS;
-	    return result;
-	}
+	EvaluationResult<Number> evaluate( const vector_t<Number>& _l ) const;
 
 	/**
 	 * @brief Evaluates the support function in the directions given in the passed matrix.
-	 * @details Uses the standard evaluate method for multiple directions.
+	 * @details Uses the closed form provided by multiEvaluateSupportValues, optimum points are only computed on request.
 	 *
 	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @param computeOptimum If false, the results do not contain optimum points.
 	 * @return Vector of support values.
 	 */
-	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _A ) const;
+	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _A, bool computeOptimum = true ) const;
+
+	/**
+	 * @brief Computes the support values in the directions given in the passed matrix at once.
+	 * @details The support values are sqrt(diag(L Q L^T)), where the diagonal is obtained from a single matrix product
+	 * without forming L Q L^T.
+	 *
+	 * @param _A Matrix L holding the directions in which to evaluate.
+	 * @return Vector holding the support value for each row of _A.
+	 */
+	vector_t<Number> multiEvaluateSupportValues( const matrix_t<Number>& _A ) const;
 
 	/**
 	 * @brief Check if point is contained in the support function.
@@ -98,6 +91,20 @@ class EllipsoidSupportFunction {
 
 	bool empty() const;
 
+  private:
+	// rounds up to obtain an over-approximation for exact number types.
+	template<typename N = Number, carl::DisableIf< std::is_same<N,double> > = carl::dummy>
+	static Number squareRoot( const Number& _in ) {
+		if(_in == 0) {
+			return _in;
+		}
+		return carl::sqrt_safe(_in).second;
+	}
+
+	template<typename N = Number, carl::EnableIf< std::is_same<N,double> > = carl::dummy>
+	static Number squareRoot( const Number& _in ) {
+		return std::sqrt(_in);
+	}
 };
 }  // namespace
 #include "EllipsoidSupportFunction.tpp"
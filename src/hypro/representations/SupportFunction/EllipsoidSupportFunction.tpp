@@ -36,19 +36,54 @@ unsigned EllipsoidSupportFunction<Number>::dimension() const {
 }
 
 template <typename Number>
-std::vector<EvaluationResult<Number>> EllipsoidSupportFunction<Number>::multiEvaluate( const matrix_t<Number> &_A ) const {
+EvaluationResult<Number> EllipsoidSupportFunction<Number>::evaluate( const vector_t<Number> &_l ) const {
+	return multiEvaluate(matrix_t<Number>(_l.transpose())).front();
+}
+
+template <typename Number>
+std::vector<EvaluationResult<Number>> EllipsoidSupportFunction<Number>::multiEvaluate( const matrix_t<Number> &_A, bool computeOptimum ) const {
 	assert( _A.cols() == mDimension );
-	std::vector<EvaluationResult<Number>> res;
 //	std::cout << "ELLIPSOID SF, evaluate in directions " << convert<Number,double>(_A) << std::endl;
+	vector_t<Number> supportValues = multiEvaluateSupportValues(_A);
+	// the optimum in direction l is Ql / sqrt(l^T Q l), where (LQ)_i = (Ql_i)^T as Q is symmetric.
+	matrix_t<Number> transformed;
+	if(computeOptimum) {
+		transformed = _A * mShapeMatrix;
+	}
+	std::vector<EvaluationResult<Number>> res;
+	res.reserve(_A.rows());
 	for ( unsigned index = 0; index < _A.rows(); ++index ) {
-		res.push_back(evaluate( _A.row( index ) ));
+		res.emplace_back(supportValues(index), SOLUTION::FEAS);
+		if(computeOptimum) {
+			if(supportValues(index) == 0) {
+				res.back().optimumValue = vector_t<Number>::Zero(mDimension);
+			} else {
+				res.back().optimumValue = vector_t<Number>(transformed.row( index )) / supportValues(index);
+			}
+		}
 		//assert(res.back().errorCode != SOLUTION::FEAS || this->contains(res.back().optimumValue));
-		//assert(this->contains(res.back().optimumValue));
 	}
 	assert(res.size() == std::size_t(_A.rows()));
 	return res;
 }
 
+template <typename Number>
+vector_t<Number> EllipsoidSupportFunction<Number>::multiEvaluateSupportValues( const matrix_t<Number> &_A ) const {
+	assert( _A.cols() == mDimension );
+	matrix_t<Number> transformed = _A * mShapeMatrix;
+	vector_t<Number> res = vector_t<Number>::Zero(_A.rows());
+	// diag(L Q L^T)_i = (L Q)_i . L_i
+	for ( unsigned colIndex = 0; colIndex < _A.cols(); ++colIndex ) {
+		for ( unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex ) {
+			res(rowIndex) += transformed(rowIndex,colIndex) * _A(rowIndex,colIndex);
+		}
+	}
+	for ( unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex ) {
+		res(rowIndex) = squareRoot(res(rowIndex));
+	}
+	return res;
+}
+
 
 template <typename Number>
 bool EllipsoidSupportFunction<Number>::contains( const Point<Number> &_point ) const {
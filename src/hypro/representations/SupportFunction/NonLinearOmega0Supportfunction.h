@@ -11,7 +11,7 @@
 //#define TEST_
 
 //#include "hyreach_utils.h"
-#include "BoxSupportfunction.h"
+#include "BoxSupportFunction.h"
 
 // NLopt includes
 #include <nlopt.hpp>
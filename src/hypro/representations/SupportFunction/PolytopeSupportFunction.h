@@ -20,6 +20,12 @@
 #include "../../util/adaptions_eigen/adaptions_eigen.h"
 #include "../../util/linearOptimization/Optimizer.h"
 #include "../../util/Permutator.h"
+#ifdef HYPRO_USE_MULTITHREADING
+#include "../../util/multithreading/ThreadPool.h"
+#include <memory>
+#include <mutex>
+#include <thread>
+#endif
 #include <map>
 
 //#define PPOLYTOPESUPPORTFUNCTION_VERBOSE
@@ -40,6 +46,10 @@ class PolytopeSupportFunction {
 	Optimizer<Number> mOpt;
 	unsigned mDimension;
 	std::map<vector_t<Number>, Number> mCache;
+#ifdef HYPRO_USE_MULTITHREADING
+	mutable std::mutex mOptimizerMutex;
+	mutable std::map<std::thread::id, std::unique_ptr<Optimizer<Number>>> mThreadOptimizers;
+#endif
 
   public:
 	PolytopeSupportFunction( matrix_t<Number> constraints, vector_t<Number> constraintConstants );
@@ -127,6 +137,18 @@ class PolytopeSupportFunction {
 
 private:
 	void removeRedundancy();
+
+	/**
+	 * @brief Returns the optimizer to be used by the calling thread.
+	 * @details Worker threads of the thread pool obtain their own optimizer instance, as the linear optimization
+	 * backends are not thread-safe. All other threads use the default instance.
+	 */
+	const Optimizer<Number>& optimizer() const;
+
+	/**
+	 * @brief Replaces the default optimizer and drops the per-thread instances, which refer to the previous constraints.
+	 */
+	void resetOptimizer();
 };
 }  // namespace
 #include "PolytopeSupportFunction.tpp"
@@ -103,8 +103,9 @@ PolytopeSupportFunction<Number>& PolytopeSupportFunction<Number>::operator=(cons
 	std::cout << __func__ << std::endl;
     this->mConstraints = _orig.mConstraints;
     this->mConstraintConstants = _orig.mConstraintConstants;
-    this->mOpt = Optimizer<Number>(mConstraints,mConstraintConstants);
+    this->resetOptimizer();
     this->mDimension = _orig.mDimension;
+    return *this;
 }
 
 template <typename Number>
@@ -252,7 +253,7 @@ EvaluationResult<Number> PolytopeSupportFunction<Number>::evaluate( const vector
 		}
 	}
 
-	EvaluationResult<Number> res(mOpt.evaluate(l, useExact));
+	EvaluationResult<Number> res(optimizer().evaluate(l, useExact));
 #ifdef PPOLYTOPESUPPORTFUNCTION_VERBOSE
 	std::cout << __func__ << ": " << *this << " evaluated in direction " << convert<Number,double>(l) << " results in " << res << std::endl;
 #endif
@@ -293,8 +294,9 @@ std::vector<EvaluationResult<Number>> PolytopeSupportFunction<Number>::multiEval
 		return res;
 	}
 
+	const Optimizer<Number>& opt = optimizer();
 	for ( unsigned index = 0; index < _A.rows(); ++index ) {
-		res.emplace_back(mOpt.evaluate( _A.row( index ), useExact ));
+		res.emplace_back(opt.evaluate( _A.row( index ), useExact ));
 	}
 	assert(res.size() == std::size_t(_A.rows()));
 	return res;
@@ -321,7 +323,7 @@ bool PolytopeSupportFunction<Number>::contains( const vector_t<Number> &_point )
 
 template <typename Number>
 bool PolytopeSupportFunction<Number>::empty() const {
-	return !mOpt.checkConsistency();
+	return !optimizer().checkConsistency();
 }
 
 template <typename Number>
@@ -341,6 +343,30 @@ std::string PolytopeSupportFunction<Number>::createCode(unsigned index) const {
 
 }
 
+template<typename Number>
+const Optimizer<Number>& PolytopeSupportFunction<Number>::optimizer() const {
+#ifdef HYPRO_USE_MULTITHREADING
+	if(ThreadPool::isWorkerThread()) {
+		ScopedLock<std::mutex> lock(mOptimizerMutex);
+		auto optIt = mThreadOptimizers.find(std::this_thread::get_id());
+		if(optIt == mThreadOptimizers.end()) {
+			optIt = mThreadOptimizers.emplace(std::this_thread::get_id(), std::unique_ptr<Optimizer<Number>>(new Optimizer<Number>(mConstraints,mConstraintConstants))).first;
+		}
+		return *(optIt->second);
+	}
+#endif
+	return mOpt;
+}
+
+template<typename Number>
+void PolytopeSupportFunction<Number>::resetOptimizer() {
+	mOpt = Optimizer<Number>(mConstraints,mConstraintConstants);
+#ifdef HYPRO_USE_MULTITHREADING
+	ScopedLock<std::mutex> lock(mOptimizerMutex);
+	mThreadOptimizers.clear();
+#endif
+}
+
 template<typename Number>
 void PolytopeSupportFunction<Number>::removeRedundancy() {
 	if(mConstraints.rows() > 1){
@@ -364,7 +390,7 @@ void PolytopeSupportFunction<Number>::removeRedundancy() {
 			assert(insertionIndex == -1);
 			mConstraints = newConstraints;
 			mConstraintConstants = newConstants;
-			mOpt = Optimizer<Number>(mConstraints,mConstraintConstants);
+			resetOptimizer();
 		}
 		assert(redundant.empty());
 	}
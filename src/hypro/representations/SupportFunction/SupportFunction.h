@@ -10,6 +10,10 @@
 #include "SupportFunctionContent.h"
 #include "../../util/templateDirections.h"
 #include "../../datastructures/hybridAutomata/Location.h"
+#ifdef HYPRO_USE_MULTITHREADING
+#include "../../util/multithreading/ThreadPool.h"
+#include <iterator>
+#endif
 
 namespace hypro {
 
@@ -34,6 +38,14 @@ public:
 	SupportFunctionT ();
 	SupportFunctionT (const SupportFunctionT<Number,Converter>& _orig);
 	SupportFunctionT (SF_TYPE _type, Number _radius, unsigned dimension );
+	/**
+	 * @brief      Constructs a box (SF_TYPE::BOX) from its lower and upper bounds.
+	 */
+	SupportFunctionT (SF_TYPE _type, const vector_t<Number>& _lower, const vector_t<Number>& _upper );
+	/**
+	 * @brief      Constructs a zonotope (SF_TYPE::ZONOTOPE) from its center and its generators.
+	 */
+	SupportFunctionT (SF_TYPE _type, const vector_t<Number>& _center, const matrix_t<Number>& _generators );
 	SupportFunctionT (const std::vector<Point<Number>>& _vertices);
 	SupportFunctionT (const matrix_t<Number>& _directions, const vector_t<Number>& _distances);
 	SupportFunctionT (const std::vector<Halfspace<Number>>& _planes);
@@ -45,7 +57,13 @@ public:
 	SupportFunctionT<Number,Converter>& operator=(SupportFunctionT<Number,Converter> _orig );
 
 	EvaluationResult<Number> evaluate( const vector_t<Number>& _direction, bool useExact = true ) const;
-	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _directions, bool useExact = true ) const;
+	/**
+	 * @brief      Evaluates the support function in all directions given as rows of the passed matrix.
+	 * @param[in]  _directions     The directions.
+	 * @param[in]  useExact        Use exact linear optimization.
+	 * @param[in]  computeOptimum  If false, only support values are computed and no optimum points are returned.
+	 */
+	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _directions, bool useExact = true, bool computeOptimum = true ) const;
 
 	std::size_t dimension() const;
 	std::size_t size() const { return 0; } // TODO: Better implementation?
@@ -63,6 +81,8 @@ public:
 	PolytopeSupportFunction<Number>* polytope() const;
 	BallSupportFunction<Number>* ball() const;
 	EllipsoidSupportFunction<Number>* ellipsoid() const;
+	BoxSupportFunction<Number>* box() const;
+	ZonotopeSupportFunction<Number>* zonotope() const;
 
 	matrix_t<Number> matrix() const;
 	vector_t<Number> vector() const;
@@ -117,6 +137,12 @@ public:
 
 private:
 	void evaluateTemplate() const;
+
+	/**
+	 * @brief      Evaluates the support function in the passed directions by splitting the direction matrix into chunks
+	 * which are evaluated concurrently on the thread pool. The results are merged in the order of the directions.
+	 */
+	std::vector<EvaluationResult<Number>> multiEvaluateParallel( const matrix_t<Number>& _directions, bool useExact, bool computeOptimum ) const;
 };
 
 /** @} */
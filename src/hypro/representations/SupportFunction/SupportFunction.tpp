@@ -44,6 +44,16 @@ namespace hypro{
         //handled by initializer list
     }
 
+    template<typename Number, typename Converter>
+    SupportFunctionT<Number,Converter>::SupportFunctionT(SF_TYPE _type, const vector_t<Number>& _lower, const vector_t<Number>& _upper ) : content(SupportFunctionContent<Number>::create(_type, _lower, _upper)){
+        //handled by initializer list
+    }
+
+    template<typename Number, typename Converter>
+    SupportFunctionT<Number,Converter>::SupportFunctionT(SF_TYPE _type, const vector_t<Number>& _center, const matrix_t<Number>& _generators ) : content(SupportFunctionContent<Number>::create(_type, _center, _generators)){
+        //handled by initializer list
+    }
+
     template<typename Number, typename Converter>
     SupportFunctionT<Number,Converter>::SupportFunctionT(const std::vector<Point<Number>>& _vertices)
         : content(SupportFunctionContent<Number>::create(SF_TYPE::POLY, _vertices)) {
@@ -91,9 +101,15 @@ namespace hypro{
     }
 
     template<typename Number, typename Converter>
-    std::vector<EvaluationResult<Number>> SupportFunctionT<Number,Converter>::multiEvaluate( const matrix_t<Number> &_directions, bool useExact ) const {
+    std::vector<EvaluationResult<Number>> SupportFunctionT<Number,Converter>::multiEvaluate( const matrix_t<Number> &_directions, bool useExact, bool computeOptimum ) const {
         //std::cout << __func__ << " " << convert<Number,double>(_directions) << std::endl;
-        std::vector<EvaluationResult<Number>> res = content->multiEvaluate(_directions, useExact);
+        #ifdef HYPRO_USE_MULTITHREADING
+        // nested parallel evaluation from within a worker thread might exhaust the pool, thus evaluate sequentially.
+        if(std::size_t(_directions.rows()) >= 2*SF_PARALLEL_MIN_CHUNK_SIZE && !ThreadPool::isWorkerThread()) {
+            return multiEvaluateParallel(_directions, useExact, computeOptimum);
+        }
+        #endif
+        std::vector<EvaluationResult<Number>> res = content->multiEvaluate(_directions, useExact, computeOptimum);
         assert(res.size() == std::size_t(_directions.rows()));
         //std::cout << __func__ << " Distances: " << std::endl;
         //for(const auto& item : res){
@@ -167,6 +183,16 @@ namespace hypro{
         return content->ellipsoid();
     }
 
+    template<typename Number, typename Converter>
+    BoxSupportFunction<Number> *SupportFunctionT<Number,Converter>::box() const {
+        return content->box();
+    }
+
+    template<typename Number, typename Converter>
+    ZonotopeSupportFunction<Number> *SupportFunctionT<Number,Converter>::zonotope() const {
+        return content->zonotope();
+    }
+
 	template<typename Number, typename Converter>
     matrix_t<Number> SupportFunctionT<Number,Converter>::matrix() const {
     	if(!mTemplateSet) {
@@ -233,7 +259,7 @@ namespace hypro{
 			}
 			//std::cout << "TemplateDirectionMatrix: " << std::endl << templateDirectionMatrix << std::endl;
 
-			std::vector<EvaluationResult<Number>> offsets = content->multiEvaluate(templateDirectionMatrix);
+			std::vector<EvaluationResult<Number>> offsets = content->multiEvaluate(templateDirectionMatrix, true, false);
 			assert(offsets.size() == unsigned(templateDirectionMatrix.rows()));
 
 			//std::cout << "Multi-Eval done, add zero constraints" << std::endl;
@@ -544,7 +570,7 @@ namespace hypro{
 		    }
 
 		    //lets the support function evaluate the offset of the halfspaces for each direction
-		    std::vector<EvaluationResult<Number>> offsets = this->multiEvaluate(templateDirectionMatrix);
+		    std::vector<EvaluationResult<Number>> offsets = this->multiEvaluate(templateDirectionMatrix, true, false);
 
 		    std::vector<std::size_t> boundedConstraints;
 		    for(unsigned offsetIndex = 0; offsetIndex < offsets.size(); ++offsetIndex){
@@ -569,5 +595,41 @@ namespace hypro{
 		}
 	}
 
+	template<typename Number, typename Converter>
+	std::vector<EvaluationResult<Number>> SupportFunctionT<Number,Converter>::multiEvaluateParallel( const matrix_t<Number>& _directions, bool useExact, bool computeOptimum ) const {
+		#ifdef HYPRO_USE_MULTITHREADING
+		ThreadPool& pool = ThreadPool::getInstance();
+		std::size_t rows = std::size_t(_directions.rows());
+		std::size_t chunkCount = std::min(pool.size(), rows / SF_PARALLEL_MIN_CHUNK_SIZE);
+		std::size_t chunkSize = rows / chunkCount;
+		std::size_t remainder = rows % chunkCount;
+
+		std::vector<std::future<std::vector<EvaluationResult<Number>>>> chunkResults;
+		std::size_t startRow = 0;
+		for(std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+			// distribute the remaining directions over the first chunks.
+			std::size_t currentSize = chunk < remainder ? chunkSize + 1 : chunkSize;
+			matrix_t<Number> chunkDirections = _directions.block(startRow, 0, currentSize, _directions.cols());
+			std::shared_ptr<SupportFunctionContent<Number>> source = content;
+			chunkResults.emplace_back(pool.enqueue([source, useExact, computeOptimum](const matrix_t<Number>& directions){
+				return source->multiEvaluate(directions, useExact, computeOptimum);
+			}, std::move(chunkDirections)));
+			startRow += currentSize;
+		}
+		assert(startRow == rows);
+
+		std::vector<EvaluationResult<Number>> res;
+		res.reserve(rows);
+		for(auto& chunkResult : chunkResults) {
+			std::vector<EvaluationResult<Number>> tmp = chunkResult.get();
+			std::move(tmp.begin(), tmp.end(), std::back_inserter(res));
+		}
+		assert(res.size() == rows);
+		return res;
+		#else
+		return content->multiEvaluate(_directions, useExact, computeOptimum);
+		#endif
+	}
+
 
 } // namespace hypro
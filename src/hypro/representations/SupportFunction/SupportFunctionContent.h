@@ -17,6 +17,8 @@
 #include "PolytopeSupportFunction.h"
 #include "BallSupportFunction.h"
 #include "EllipsoidSupportFunction.h"
+#include "BoxSupportFunction.h"
+#include "ZonotopeSupportFunction.h"
 #include "../../util/templateDirections.h"
 
 //#define SUPPORTFUNCTION_VERBOSE
@@ -44,10 +46,11 @@ struct trafoContent {
 	std::shared_ptr<const lintrafoParameters<Number>> parameters;
 	unsigned currentExponent;
 	std::size_t successiveTransformations;
+	bool composed; // parameters are the product of several transformations and are not composed any further
 	// 2^power defines the max. number of successive lin.trans before reducing the SF
 
 	trafoContent( const std::shared_ptr<SupportFunctionContent<Number>>& _origin, const matrix_t<Number>& A, const vector_t<Number>& b )
-		: origin( _origin ), currentExponent(1) {
+		: origin( _origin ), currentExponent(1), successiveTransformations(0), composed(false) {
 		// Determine, if we need to create new parameters or if this matrix and vector pair has already been used (recursive).
 		parameters = std::make_shared<const lintrafoParameters<Number>>(A,b);
 		// in case this transformation has already been performed, parameters will be updated.
@@ -75,27 +78,14 @@ struct trafoContent {
 		} while (reduced == true);
 		assert(origin->checkTreeValidity());
 #endif
+		// fill the shared power table up front, such that evaluation only performs lookups.
+		parameters->precompute(currentExponent);
 	}
 
-	trafoContent( const trafoContent<Number>& _origin ) : origin( _origin.origin ), parameters(_origin.parameters), currentExponent(_origin.currentExponent), successiveTransformations( _origin.successiveTransformations )
+	trafoContent( const trafoContent<Number>& _origin ) : origin( _origin.origin ), parameters(_origin.parameters), currentExponent(_origin.currentExponent), successiveTransformations( _origin.successiveTransformations ), composed( _origin.composed )
 	{}
 
 	std::size_t originCount() const { return 1; }
-
-	std::pair<matrix_t<Number>, vector_t<Number>> reduceLinTrans(const matrix_t<Number>& _a, const vector_t<Number>& _b, std::size_t _power){
-		std::size_t powerOfTwo = carl::pow(2, _power);
-			// first compute the new b
-		vector_t<Number> bTrans = _b;
-		matrix_t<Number> aTrans = _a;
-		for (std::size_t i = 1; i < powerOfTwo ; i++){
-			bTrans = _a*bTrans + _b;
-		}
-		// now compute a^i efficiently
-		for (std::size_t i = 0; i < _power; i++){
-			aTrans = aTrans*aTrans;
-		}
-		return std::make_pair(aTrans, bTrans);
-	}
 };
 
 template <typename Number>
@@ -172,12 +162,16 @@ class SupportFunctionContent {
 		PolytopeSupportFunction<Number>* mPolytope;
 		BallSupportFunction<Number>* mBall;
 		EllipsoidSupportFunction<Number>* mEllipsoid;
+		BoxSupportFunction<Number>* mBox;
+		ZonotopeSupportFunction<Number>* mZonotope;
 	};
 
 	std::weak_ptr<SupportFunctionContent<Number>> pThis;
 
 	SupportFunctionContent( const matrix_t<Number>& _shapeMatrix, SF_TYPE _type = SF_TYPE::ELLIPSOID );
 	SupportFunctionContent( Number _radius, unsigned dimension, SF_TYPE _type = SF_TYPE::INFTY_BALL );
+	SupportFunctionContent( const vector_t<Number>& _lower, const vector_t<Number>& _upper, SF_TYPE _type = SF_TYPE::BOX );
+	SupportFunctionContent( const vector_t<Number>& _center, const matrix_t<Number>& _generators, SF_TYPE _type = SF_TYPE::ZONOTOPE );
 	SupportFunctionContent( const matrix_t<Number>& _directions, const vector_t<Number>& _distances,
 					 SF_TYPE _type = SF_TYPE::POLY );
 	SupportFunctionContent( const std::vector<Halfspace<Number>>& _planes, SF_TYPE _type = SF_TYPE::POLY );
@@ -207,6 +201,26 @@ class SupportFunctionContent {
 		return obj;
 	}
 
+	/**
+	 * @brief      Creates a box from its lower and upper bounds.
+	 */
+	static std::shared_ptr<SupportFunctionContent<Number>> create( SF_TYPE _type, const vector_t<Number>& _lower, const vector_t<Number>& _upper ) {
+		auto obj = std::shared_ptr<SupportFunctionContent<Number>>( new SupportFunctionContent<Number>( _lower, _upper, _type ));
+		obj->pThis = obj;
+		assert(obj->checkTreeValidity());
+		return obj;
+	}
+
+	/**
+	 * @brief      Creates a zonotope from its center and its generators.
+	 */
+	static std::shared_ptr<SupportFunctionContent<Number>> create( SF_TYPE _type, const vector_t<Number>& _center, const matrix_t<Number>& _generators ) {
+		auto obj = std::shared_ptr<SupportFunctionContent<Number>>( new SupportFunctionContent<Number>( _center, _generators, _type ));
+		obj->pThis = obj;
+		assert(obj->checkTreeValidity());
+		return obj;
+	}
+
 	static std::shared_ptr<SupportFunctionContent<Number>> create( SF_TYPE _type, const matrix_t<Number>& _directions,
 																	const vector_t<Number>& _distances ) {
 		auto obj = std::shared_ptr<SupportFunctionContent<Number>>( new SupportFunctionContent<Number>( _directions, _distances, _type ));
@@ -277,7 +291,15 @@ class SupportFunctionContent {
 	std::shared_ptr<SupportFunctionContent<Number>>& operator=( const std::shared_ptr<SupportFunctionContent<Number>>& _orig ) ;
 
 	EvaluationResult<Number> evaluate( const vector_t<Number>& _direction, bool useExact ) const;
-	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _directions, bool useExact ) const;
+	/**
+	 * @brief      Evaluates the support function in all directions given as rows of the passed matrix.
+	 * @details    Linear transformations are handled by evaluating the origin in the transformed directions A^T l. In case
+	 * no optimum points are requested, only the support values are propagated and affine offsets are added as l^T b.
+	 * @param[in]  _directions      The directions.
+	 * @param[in]  useExact         Use exact linear optimization.
+	 * @param[in]  computeOptimum   If false, the results do not contain optimum points (witnesses).
+	 */
+	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _directions, bool useExact, bool computeOptimum = true ) const;
 
 	std::size_t dimension() const;
 	SF_TYPE type() const;
@@ -307,6 +329,8 @@ class SupportFunctionContent {
 	PolytopeSupportFunction<Number>* polytope() const;
 	BallSupportFunction<Number>* ball() const;
 	EllipsoidSupportFunction<Number>* ellipsoid() const;
+	BoxSupportFunction<Number>* box() const;
+	ZonotopeSupportFunction<Number>* zonotope() const;
 
 	std::shared_ptr<SupportFunctionContent<Number>> project(const std::vector<unsigned>& dimensions) const;
 	std::shared_ptr<SupportFunctionContent<Number>> affineTransformation( const matrix_t<Number>& A, const vector_t<Number>& b ) const;
@@ -364,7 +388,9 @@ class SupportFunctionContent {
 					case SF_TYPE::INFTY_BALL:
 					case SF_TYPE::TWO_BALL:
 					case SF_TYPE::POLY:
-					case SF_TYPE::ELLIPSOID: {
+					case SF_TYPE::ELLIPSOID:
+					case SF_TYPE::BOX:
+					case SF_TYPE::ZONOTOPE: {
 			            resultStack.at(currentResult.first).second.push_back(true);
 			            break;
 			        }
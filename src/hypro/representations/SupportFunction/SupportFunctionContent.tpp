@@ -26,6 +26,14 @@ SupportFunctionContent<Number>::SupportFunctionContent( const SupportFunctionCon
 			mBall = new BallSupportFunction<Number>(*_orig.ball());
 			break;
 		}
+		case SF_TYPE::BOX: {
+			mBox = new BoxSupportFunction<Number>(*_orig.box());
+			break;
+		}
+		case SF_TYPE::ZONOTOPE: {
+			mZonotope = new ZonotopeSupportFunction<Number>(*_orig.zonotope());
+			break;
+		}
 		case SF_TYPE::INTERSECT: {
 			mIntersectionParameters = new intersectionContent<Number>(*_orig.intersectionParameters());
 			break;
@@ -98,6 +106,38 @@ SupportFunctionContent<Number>::SupportFunctionContent( Number _radius, unsigned
 	}
 }
 
+template <typename Number>
+SupportFunctionContent<Number>::SupportFunctionContent( const vector_t<Number>& _lower, const vector_t<Number>& _upper, SF_TYPE _type ) {
+	switch ( _type ) {
+		case SF_TYPE::BOX: {
+			mBox = new BoxSupportFunction<Number>( _lower, _upper );
+			mType = SF_TYPE::BOX;
+			mDimension = _lower.rows();
+			mDepth = 0;
+			mOperationCount = 0;
+			break;
+		}
+		default:
+			assert( false );
+	}
+}
+
+template <typename Number>
+SupportFunctionContent<Number>::SupportFunctionContent( const vector_t<Number>& _center, const matrix_t<Number>& _generators, SF_TYPE _type ) {
+	switch ( _type ) {
+		case SF_TYPE::ZONOTOPE: {
+			mZonotope = new ZonotopeSupportFunction<Number>( _center, _generators );
+			mType = SF_TYPE::ZONOTOPE;
+			mDimension = _center.rows();
+			mDepth = 0;
+			mOperationCount = 0;
+			break;
+		}
+		default:
+			assert( false );
+	}
+}
+
 template <typename Number>
 SupportFunctionContent<Number>::SupportFunctionContent( const matrix_t<Number> &_directions, const vector_t<Number> &_distances,
 										  SF_TYPE _type ) {
@@ -307,6 +347,12 @@ SupportFunctionContent<Number>::~SupportFunctionContent() {
 		case SF_TYPE::ELLIPSOID:
 			delete ellipsoid();
 			break;
+		case SF_TYPE::BOX:
+			delete mBox;
+			break;
+		case SF_TYPE::ZONOTOPE:
+			delete mZonotope;
+			break;
 		case SF_TYPE::NONE: {
 			std::cout << __func__ << ": SF Type not properly initialized!" << std::endl;
 			assert(false);
@@ -332,6 +378,12 @@ std::shared_ptr<SupportFunctionContent<Number>>& SupportFunctionContent<Number>:
 		case SF_TYPE::TWO_BALL:
 			mBall = new BallSupportFunction<Number>(*_other->ball());
 			break;
+		case SF_TYPE::BOX:
+			mBox = new BoxSupportFunction<Number>(*_other->box());
+			break;
+		case SF_TYPE::ZONOTOPE:
+			mZonotope = new ZonotopeSupportFunction<Number>(*_other->zonotope());
+			break;
 		case SF_TYPE::LINTRAFO:
 			mLinearTrafoParameters = new trafoContent<Number>(*_other->linearTrafoParameters());
 			break;
@@ -402,6 +454,12 @@ EvaluationResult<Number> SupportFunctionContent<Number>::evaluate( const vector_
 					case SF_TYPE::TWO_BALL: {
 						return ball()->evaluate( currentParam );
 					}
+					case SF_TYPE::BOX: {
+						return box()->evaluate( currentParam );
+					}
+					case SF_TYPE::ZONOTOPE: {
+						return zonotope()->evaluate( currentParam );
+					}
 					case SF_TYPE::POLY: {
 						return polytope()->evaluate( currentParam, useExact );
 					}
@@ -420,6 +478,14 @@ EvaluationResult<Number> SupportFunctionContent<Number>::evaluate( const vector_
 						resultStack.at(currentResult.first).second.push_back(cur->ball()->evaluate( currentParam ));
 						break;
 					}
+					case SF_TYPE::BOX: {
+						resultStack.at(currentResult.first).second.push_back(cur->box()->evaluate( currentParam ));
+						break;
+					}
+					case SF_TYPE::ZONOTOPE: {
+						resultStack.at(currentResult.first).second.push_back(cur->zonotope()->evaluate( currentParam ));
+						break;
+					}
 					case SF_TYPE::POLY: {
 						resultStack.at(currentResult.first).second.push_back(cur->polytope()->evaluate( currentParam, useExact ));
 						break;
@@ -581,7 +647,9 @@ EvaluationResult<Number> SupportFunctionContent<Number>::evaluate( const vector_
 					case SF_TYPE::ELLIPSOID:
 					case SF_TYPE::INFTY_BALL:
 					case SF_TYPE::POLY:
-					case SF_TYPE::TWO_BALL: {
+					case SF_TYPE::TWO_BALL:
+					case SF_TYPE::BOX:
+					case SF_TYPE::ZONOTOPE: {
 						assert(false);
 						FATAL("hypro.representations.supportFunction","Leaf node cannot be an intermediate case.");
 						break;
@@ -667,7 +735,7 @@ EvaluationResult<Number> SupportFunctionContent<Number>::evaluate( const vector_
 }
 
 template <typename Number>
-std::vector<EvaluationResult<Number>> SupportFunctionContent<Number>::multiEvaluate( const matrix_t<Number> &_directions, bool useExact ) const {
+std::vector<EvaluationResult<Number>> SupportFunctionContent<Number>::multiEvaluate( const matrix_t<Number> &_directions, bool useExact, bool computeOptimum ) const {
 	//std::cout << "Multi-evaluate, type: " << mType << std::endl;
 	checkTreeValidity();
 
@@ -692,46 +760,48 @@ std::vector<EvaluationResult<Number>> SupportFunctionContent<Number>::multiEvalu
 
 			std::pair<int,std::vector<Res>> currentResult = resultStack.back();
 
-			// update result
-			// special case: When the node is a leaf, we directly return the result.
-			if(currentResult.first == -1) {
-				// we reached the top, exit (or return result or whatever)
-				switch ( cur->type() ) {
-					case SF_TYPE::ELLIPSOID: {
-						return ellipsoid()->multiEvaluate( currentParam );
-					}
-					case SF_TYPE::INFTY_BALL:
-					case SF_TYPE::TWO_BALL: {
-						return ball()->multiEvaluate( currentParam );
-					}
-					case SF_TYPE::POLY: {
-						return polytope()->multiEvaluate( currentParam, useExact );
-					}
-					default:
-						assert(false);
-						FATAL("hypro.representations.supportFunction","Wrong type.");
+			Res leafResult;
+			switch ( cur->type() ) {
+				case SF_TYPE::ELLIPSOID: {
+					leafResult = cur->ellipsoid()->multiEvaluate( currentParam, computeOptimum );
+					break;
 				}
-			} else {
-				switch ( cur->type() ) {
-					case SF_TYPE::ELLIPSOID: {
-						resultStack.at(currentResult.first).second.push_back(cur->ellipsoid()->multiEvaluate( currentParam ));
-						break;
-					}
-					case SF_TYPE::INFTY_BALL:
-					case SF_TYPE::TWO_BALL: {
-						resultStack.at(currentResult.first).second.push_back(cur->ball()->multiEvaluate( currentParam ));
-						break;
-					}
-					case SF_TYPE::POLY: {
-						resultStack.at(currentResult.first).second.push_back(cur->polytope()->multiEvaluate( currentParam, useExact ));
-						break;
+				case SF_TYPE::INFTY_BALL:
+				case SF_TYPE::TWO_BALL: {
+					leafResult = cur->ball()->multiEvaluate( currentParam, computeOptimum );
+					break;
+				}
+				case SF_TYPE::BOX: {
+					leafResult = cur->box()->multiEvaluate( currentParam, computeOptimum );
+					break;
+				}
+				case SF_TYPE::ZONOTOPE: {
+					leafResult = cur->zonotope()->multiEvaluate( currentParam, computeOptimum );
+					break;
+				}
+				case SF_TYPE::POLY: {
+					leafResult = cur->polytope()->multiEvaluate( currentParam, useExact );
+					if(!computeOptimum) {
+						// only support values are propagated, release the optimum points early.
+						for(auto& entry : leafResult) {
+							entry.optimumValue = vector_t<Number>();
+						}
 					}
-					default:
-						assert(false);
-						FATAL("hypro.representations.supportFunction","Wrong type.");
+					break;
 				}
+				default:
+					assert(false);
+					FATAL("hypro.representations.supportFunction","Wrong type.");
 			}
 
+			// update result
+			// special case: When the node is a leaf, we directly return the result.
+			if(currentResult.first == -1) {
+				// we reached the top, exit
+				return leafResult;
+			}
+			resultStack.at(currentResult.first).second.push_back(std::move(leafResult));
+
 			// leave recursive call.
 			callStack.pop_back();
 			paramStack.pop_back();
@@ -749,21 +819,27 @@ std::vector<EvaluationResult<Number>> SupportFunctionContent<Number>::multiEvalu
 					case SF_TYPE::LINTRAFO: {
 						TRACE("hypro.representations.supportFunction", ": LINTRAFO, accumulate results.")
 						assert(resultStack.back().second.size() == 1);
-						std::pair<matrix_t<Number>, vector_t<Number>> parameterPair = cur->linearTrafoParameters()->parameters->getParameterSet(cur->linearTrafoParameters()->currentExponent);
+						const std::pair<matrix_t<Number>, vector_t<Number>>& parameterPair = cur->linearTrafoParameters()->parameters->getParameterSet(cur->linearTrafoParameters()->currentExponent);
 						TRACE("hypro.representations.supportFunction", "Matrix: " << parameterPair.first);
 						TRACE("hypro.representations.supportFunction", "Vector: " << parameterPair.second);
 						if(resultStack.back().second.front().begin()->errorCode != SOLUTION::INFEAS) {
 							unsigned directionCnt = 0;
+							// the origin has been evaluated in directions A^T l, thus only the offset l^T b is missing.
+							vector_t<Number> offsets;
+							if(!computeOptimum) {
+								offsets = currentParam * parameterPair.second;
+							}
 							for(auto& entry : resultStack.back().second.front()) {
-								vector_t<Number> currentDir(currentParam.row(directionCnt));
 								if(entry.errorCode == SOLUTION::INFTY) {
 									entry.optimumValue = entry.optimumValue;
 									entry.supportValue = 1;
+								} else if(!computeOptimum) {
+									entry.supportValue += offsets(directionCnt);
 								} else {
 									TRACE("hypro.representations.supportFunction", ": Entry val before trafo: " << entry.optimumValue);
 									entry.optimumValue = parameterPair.first * entry.optimumValue + parameterPair.second;
 									// As we know, that the optimal vertex lies on the supporting Halfspace, we can obtain the distance by dot product.
-									entry.supportValue = entry.optimumValue.dot(currentDir);
+									entry.supportValue = entry.optimumValue.dot(vector_t<Number>(currentParam.row(directionCnt)));
 								}
 								auto t = convert<Number,double>(currentParam.row(directionCnt));
 								TRACE("hypro.representations.supportFunction", "Direction: " << t << ", Entry value: " << entry.supportValue);
@@ -933,14 +1009,16 @@ std::vector<EvaluationResult<Number>> SupportFunctionContent<Number>::multiEvalu
 					case SF_TYPE::ELLIPSOID:
 					case SF_TYPE::INFTY_BALL:
 					case SF_TYPE::POLY:
-					case SF_TYPE::TWO_BALL: {
+					case SF_TYPE::TWO_BALL:
+					case SF_TYPE::BOX:
+					case SF_TYPE::ZONOTOPE: {
 						assert(false);
 						FATAL("hypro.representations.supportFunction","Leaf node cannot be an intermediate case.");
 						break;
 					}
 					case SF_TYPE::LINTRAFO: {
 						// std::cout << "Directions " << convert<Number,double>(_directions) << std::endl << "A:" << convert<Number,double>(linearTrafoParameters()->a) << std::endl;
-						std::pair<matrix_t<Number>, vector_t<Number>> parameterPair = cur->linearTrafoParameters()->parameters->getParameterSet(cur->linearTrafoParameters()->currentExponent);
+						const std::pair<matrix_t<Number>, vector_t<Number>>& parameterPair = cur->linearTrafoParameters()->parameters->getParameterSet(cur->linearTrafoParameters()->currentExponent);
 						#ifndef HYPRO_USE_VECTOR_CACHING
 						currentParam = currentParam * parameterPair.first;
 						#else
@@ -1069,7 +1147,9 @@ unsigned SupportFunctionContent<Number>::multiplicationsPerEvaluation() const {
 			switch(cur->type()) {
 				case SF_TYPE::INFTY_BALL:
 				case SF_TYPE::TWO_BALL:
-				case SF_TYPE::ELLIPSOID: {
+				case SF_TYPE::ELLIPSOID:
+				case SF_TYPE::BOX:
+				case SF_TYPE::ZONOTOPE: {
 		            resultStack.at(currentResult.first).second.push_back(1);
 		            break;
 		        }
@@ -1266,6 +1346,12 @@ Point<Number> SupportFunctionContent<Number>::supremumPoint() const {
 		case SF_TYPE::TWO_BALL: {
 			return ball()->supremumPoint();
 		}
+		case SF_TYPE::BOX: {
+			return box()->supremumPoint();
+		}
+		case SF_TYPE::ZONOTOPE: {
+			return zonotope()->supremumPoint();
+		}
 		case SF_TYPE::LINTRAFO: {
 			Point<Number> supPoint = linearTrafoParameters()->origin->supremumPoint();
 			if(supPoint.dimension() == 0){
@@ -1367,7 +1453,7 @@ std::vector<unsigned> SupportFunctionContent<Number>::collectProjections() const
 		//T currentParam = paramStack.back();
 
 		//if(cur->children.empty()) {
-		if(cur->mType == SF_TYPE::POLY || cur->mType == SF_TYPE::INFTY_BALL || cur->mType == SF_TYPE::TWO_BALL || cur->mType == SF_TYPE::ELLIPSOID ) {
+		if(cur->mType == SF_TYPE::POLY || cur->mType == SF_TYPE::INFTY_BALL || cur->mType == SF_TYPE::TWO_BALL || cur->mType == SF_TYPE::ELLIPSOID || cur->mType == SF_TYPE::BOX || cur->mType == SF_TYPE::ZONOTOPE ) {
 			//std::cout << "Reached bottom." << std::endl;
 			// Do computation and write results in case recursion ends.
 
@@ -1587,6 +1673,18 @@ BallSupportFunction<Number> *SupportFunctionContent<Number>::ball() const {
 	return mBall;
 }
 
+template <typename Number>
+BoxSupportFunction<Number> *SupportFunctionContent<Number>::box() const {
+	assert( mType == SF_TYPE::BOX );
+	return mBox;
+}
+
+template <typename Number>
+ZonotopeSupportFunction<Number> *SupportFunctionContent<Number>::zonotope() const {
+	assert( mType == SF_TYPE::ZONOTOPE );
+	return mZonotope;
+}
+
 template<typename Number>
 std::shared_ptr<SupportFunctionContent<Number>> SupportFunctionContent<Number>::project(const std::vector<unsigned>& dimensions) const {
 	return create(getThis(),dimensions);
@@ -1595,6 +1693,34 @@ std::shared_ptr<SupportFunctionContent<Number>> SupportFunctionContent<Number>::
 template <typename Number>
 std::shared_ptr<SupportFunctionContent<Number>> SupportFunctionContent<Number>::affineTransformation(
 	  const matrix_t<Number>& A, const vector_t<Number>& b ) const {
+	// Compose A*(A'x+b')+b = (A*A')x + (A*b'+b) with the transformation at the root to keep the tree depth bounded.
+	// Only a single, plain transformation is composed: parameters shared with other nodes or collected by the
+	// exponent-based reduction are kept, as is an already composed root, such that repeated transformations
+	// stacked on top of it are reduced and share their parameters again.
+	if(mType == SF_TYPE::LINTRAFO && A.rows() == A.cols() && std::size_t(A.rows()) <= SF_LINTRAFO_FOLD_MAX_DIMENSION) {
+		const trafoContent<Number>& root = *linearTrafoParameters();
+		const lintrafoParameters<Number>& parameters = *(root.parameters);
+		bool identical = (A == parameters.matrix() && b == parameters.vector());
+		bool foldable = !root.composed && root.parameters.use_count() == 1 && root.currentExponent == 1 && root.successiveTransformations == 0;
+		if(foldable && !identical) {
+			const std::pair<matrix_t<Number>, vector_t<Number>>& inner = parameters.getParameterSet(root.currentExponent);
+			assert(inner.first.rows() == A.cols());
+			matrix_t<Number> composedMatrix = A*inner.first;
+			double maxCoefficient = 0;
+			for(unsigned rowIndex = 0; rowIndex < composedMatrix.rows(); ++rowIndex) {
+				for(unsigned colIndex = 0; colIndex < composedMatrix.cols(); ++colIndex) {
+					maxCoefficient = std::max(maxCoefficient, std::abs(carl::toDouble(composedMatrix(rowIndex,colIndex))));
+				}
+			}
+			// large coefficients amplify rounding errors, keep the transformations separate in this case.
+			if(maxCoefficient <= SF_LINTRAFO_FOLD_MAX_COEFFICIENT) {
+				TRACE("hypro.representations.supportFunction", "Compose linear transformation with root transformation.");
+				std::shared_ptr<SupportFunctionContent<Number>> res = create(root.origin, composedMatrix, vector_t<Number>(A*inner.second + b));
+				res->linearTrafoParameters()->composed = true;
+				return res;
+			}
+		}
+	}
 	return create(getThis(), A, b);
 }
 
@@ -1628,6 +1754,14 @@ bool SupportFunctionContent<Number>::contains( const vector_t<Number> &_point )
 			DEBUG("hypro.representations.supportFunction","BALL, point: " << _point);
 			return ball()->contains( _point );
 		}
+		case SF_TYPE::BOX: {
+			DEBUG("hypro.representations.supportFunction","BOX, point: " << _point);
+			return box()->contains( _point );
+		}
+		case SF_TYPE::ZONOTOPE: {
+			DEBUG("hypro.representations.supportFunction","ZONOTOPE, point: " << _point);
+			return zonotope()->contains( _point );
+		}
 		case SF_TYPE::LINTRAFO: {
 			// TODO: Verify.
 			DEBUG("hypro.representations.supportFunction","TRANSFORMATION, point: " << _point);
@@ -1720,6 +1854,12 @@ bool SupportFunctionContent<Number>::empty() const {
 		case SF_TYPE::TWO_BALL: {
 			return ball()->empty();
 		}
+		case SF_TYPE::BOX: {
+			return box()->empty();
+		}
+		case SF_TYPE::ZONOTOPE: {
+			return zonotope()->empty();
+		}
 		case SF_TYPE::LINTRAFO: {
 			return linearTrafoParameters()->origin->empty();
 		}
@@ -1788,6 +1928,12 @@ void SupportFunctionContent<Number>::print() const {
 		case SF_TYPE::TWO_BALL: {
 			std::cout << "2-BALL" << std::endl;
 		} break;
+		case SF_TYPE::BOX: {
+			std::cout << "BOX" << std::endl;
+		} break;
+		case SF_TYPE::ZONOTOPE: {
+			std::cout << "ZONOTOPE" << std::endl;
+		} break;
 		case SF_TYPE::LINTRAFO: {
 			std::cout << "LINTRAFO A^" << linearTrafoParameters()->currentExponent << std::endl;
 			std::cout << "of" << std::endl;
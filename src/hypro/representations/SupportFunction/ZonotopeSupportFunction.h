@@ -0,0 +1,81 @@
+/*
+ * This file contains the basic implementation of support functions of zonotopes and their evaluation.
+ * @file ZonotopeSupportFunction.h
+ */
+
+#pragma once
+
+#include "util.h"
+#include "../../config.h"
+#include "../../datastructures/Point.h"
+#include "../../util/linearOptimization/Optimizer.h"
+
+namespace hypro {
+
+/*
+* This class defines a support Function object representing a zonotope given by its center and its generators.
+* SupportFunctions can be evaluated in a specified direction l and return a correspondent EvaluationResult
+*/
+template <typename Number>
+class ZonotopeSupportFunction {
+  private:
+	vector_t<Number> mCenter;
+	matrix_t<Number> mGenerators;
+
+  public:
+	ZonotopeSupportFunction( const ZonotopeSupportFunction<Number>& _orig ) = default;
+	ZonotopeSupportFunction( const vector_t<Number>& _center, const matrix_t<Number>& _generators );
+	~ZonotopeSupportFunction() {}
+
+	/**
+	 * Returns the dimension of the object.
+	 * @return
+	 */
+	unsigned dimension() const;
+
+	const vector_t<Number>& center() const { return mCenter; }
+	const matrix_t<Number>& generators() const { return mGenerators; }
+
+	Point<Number> supremumPoint() const;
+
+	/**
+	 * Evaluates the support function in the given direction.
+	 * @param l
+	 * @return
+	 */
+	EvaluationResult<Number> evaluate( const vector_t<Number>& l ) const;
+
+	/**
+	 * @brief Evaluates the support function in the directions given in the passed matrix.
+	 * @details Uses the closed form provided by multiEvaluateSupportValues, optimum points are only computed on request.
+	 *
+	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @param computeOptimum If false, the results do not contain optimum points.
+	 * @return Vector of support values.
+	 */
+	std::vector<EvaluationResult<Number>> multiEvaluate( const matrix_t<Number>& _A, bool computeOptimum = true ) const;
+
+	/**
+	 * @brief Computes the support values in the directions given in the passed matrix at once.
+	 * @details The support value of a zonotope in direction l is l*c + ||G^T l||_1, thus all values are obtained as
+	 * A*c + |A*G|*1.
+	 *
+	 * @param _A Matrix holding the directions in which to evaluate.
+	 * @return Vector holding the support value for each row of _A.
+	 */
+	vector_t<Number> multiEvaluateSupportValues( const matrix_t<Number>& _A ) const;
+
+	/**
+	 * @brief Check if point is contained in the zonotope.
+	 * @details Solves the feasibility problem G*x = p - c with x in [-1,1]^m.
+	 *
+	 * @param _point The point to check.
+	 * @return True, if the point is inside the zonotope.
+	 */
+	bool contains( const Point<Number>& _point ) const;
+	bool contains( const vector_t<Number>& _point ) const;
+
+	bool empty() const;
+};
+}  // namespace
+#include "ZonotopeSupportFunction.tpp"
@@ -0,0 +1,112 @@
+/*
+ * This file contains the basic implementation of support functions of zonotopes and their evaluation.
+ * @file ZonotopeSupportFunction.tpp
+ */
+
+#include "ZonotopeSupportFunction.h"
+
+namespace hypro {
+
+template <typename Number>
+ZonotopeSupportFunction<Number>::ZonotopeSupportFunction( const vector_t<Number>& _center, const matrix_t<Number>& _generators )
+	: mCenter( _center ), mGenerators( _generators ) {
+	assert( _generators.cols() == 0 || _center.rows() == _generators.rows() );
+	if( mGenerators.cols() == 0 ) {
+		mGenerators = matrix_t<Number>::Zero( mCenter.rows(), 0 );
+	}
+}
+
+template <typename Number>
+unsigned ZonotopeSupportFunction<Number>::dimension() const {
+	return mCenter.rows();
+}
+
+template<typename Number>
+Point<Number> ZonotopeSupportFunction<Number>::supremumPoint() const {
+	// the point with the largest infinity norm is extremal in one of the unit directions.
+	matrix_t<Number> directions = matrix_t<Number>( 2 * mCenter.rows(), mCenter.rows() );
+	directions << matrix_t<Number>::Identity( mCenter.rows(), mCenter.rows() ), -matrix_t<Number>::Identity( mCenter.rows(), mCenter.rows() );
+	std::vector<EvaluationResult<Number>> results = multiEvaluate( directions );
+	auto best = std::max_element( results.begin(), results.end(), []( const EvaluationResult<Number>& lhs, const EvaluationResult<Number>& rhs ) {
+		return lhs.supportValue < rhs.supportValue;
+	} );
+	if( best == results.end() ) {
+		return Point<Number>();
+	}
+	return Point<Number>( best->optimumValue );
+}
+
+template <typename Number>
+EvaluationResult<Number> ZonotopeSupportFunction<Number>::evaluate( const vector_t<Number> &l ) const {
+	if(l.rows() == 0){
+		return EvaluationResult<Number>(SOLUTION::FEAS);
+	}
+	return multiEvaluate(matrix_t<Number>(l.transpose())).front();
+}
+
+template <typename Number>
+std::vector<EvaluationResult<Number>> ZonotopeSupportFunction<Number>::multiEvaluate( const matrix_t<Number> &_A, bool computeOptimum ) const {
+	assert(_A.cols() == mCenter.rows());
+	vector_t<Number> supportValues = multiEvaluateSupportValues(_A);
+	matrix_t<Number> projections;
+	if(computeOptimum) {
+		projections = _A * mGenerators;
+	}
+	std::vector<EvaluationResult<Number>> res;
+	res.reserve(_A.rows());
+	for(unsigned rowIndex = 0; rowIndex < _A.rows(); ++rowIndex) {
+		res.emplace_back(supportValues(rowIndex), SOLUTION::FEAS);
+		if(computeOptimum) {
+			// the optimum adds each generator oriented towards the direction.
+			vector_t<Number> optimum = mCenter;
+			for(unsigned colIndex = 0; colIndex < mGenerators.cols(); ++colIndex) {
+				if(projections(rowIndex,colIndex) < 0) {
+					optimum -= mGenerators.col(colIndex);
+				} else {
+					optimum += mGenerators.col(colIndex);
+				}
+			}
+			res.back().optimumValue = std::move(optimum);
+		}
+	}
+	return res;
+}
+
+template <typename Number>
+vector_t<Number> ZonotopeSupportFunction<Number>::multiEvaluateSupportValues( const matrix_t<Number> &_A ) const {
+	vector_t<Number> res = _A * mCenter;
+	if(mGenerators.cols() > 0) {
+		res += ( _A * mGenerators ).array().abs().rowwise().sum().matrix();
+	}
+	return res;
+}
+
+template <typename Number>
+bool ZonotopeSupportFunction<Number>::contains( const Point<Number> &_point ) const {
+	return this->contains( _point.rawCoordinates() );
+}
+
+template <typename Number>
+bool ZonotopeSupportFunction<Number>::contains( const vector_t<Number> &_point ) const {
+	assert(_point.rows() == mCenter.rows());
+	vector_t<Number> offset = _point - mCenter;
+	std::size_t generatorCount = mGenerators.cols();
+	if(generatorCount == 0) {
+		return offset == vector_t<Number>::Zero(mCenter.rows());
+	}
+	// G*x <= offset, -G*x <= -offset, x <= 1, -x <= 1.
+	matrix_t<Number> constraints = matrix_t<Number>( 2 * mCenter.rows() + 2 * generatorCount, generatorCount );
+	vector_t<Number> constants = vector_t<Number>( 2 * mCenter.rows() + 2 * generatorCount );
+	constraints << mGenerators, -mGenerators, matrix_t<Number>::Identity( generatorCount, generatorCount ), -matrix_t<Number>::Identity( generatorCount, generatorCount );
+	constants << offset, -offset, vector_t<Number>::Ones( 2 * generatorCount );
+	Optimizer<Number> opt;
+	opt.setMatrix( constraints );
+	opt.setVector( constants );
+	return opt.checkConsistency();
+}
+
+template <typename Number>
+bool ZonotopeSupportFunction<Number>::empty() const {
+	return false;
+}
+}  // namespace
@@ -8,6 +8,9 @@
 
 #include "../../config.h"
 #include "../../types.h"
+#include "../../util/multithreading/ScopedLock.h"
+#include <deque>
+#include <mutex>
 #ifdef HYPRO_USE_VECTOR_CACHING
 #include "../../datastructures/LRUCache.h"
 #endif
@@ -59,11 +62,17 @@ namespace hypro {
 
 	/**
 	 * @brief      Struct holding linear and affine transformation parameters.
+	 * @details    The reduced parameters for exponents (2^power)^k are stored in a dense table addressed by k, which is
+	 * extended on demand and shared by all nodes using the same transformation. The table additionally holds the
+	 * transposed matrices, as these are required to transform directions during support function evaluation.
 	 * @tparam     Number  The used number type.
 	 */
 	template<typename Number>
 	struct lintrafoParameters {
-		mutable std::map<unsigned, std::pair<matrix_t<Number>, vector_t<Number>>> parameters;
+		// std::deque keeps references to existing entries valid when the table is extended.
+		mutable std::deque<std::pair<matrix_t<Number>, vector_t<Number>>> parameters; // parameters[k] = (A^((2^power)^k), accumulated b)
+		mutable std::deque<matrix_t<Number>> transposedMatrices; // transposedMatrices[k] = parameters[k].first^T
+		mutable std::recursive_mutex mParameterMutex; // guards the lazily created reducts and caches during parallel evaluation
 		#ifdef HYPRO_USE_VECTOR_CACHING
 		mutable LRUCache<Cacheable<vector_t<Number>>, vector_t<Number>> mVectorCache;
 		mutable LRUCache<Cacheable<matrix_t<Number>>, matrix_t<Number>> mMatrixCache;
@@ -81,7 +90,8 @@ namespace hypro {
 		{
 			//TRACE("hypro.representations.supportFunction", "Created new lintrafo object." << " (@" << this << ")");
 			assert(_A.rows() == _b.rows());
-			parameters[1] = std::make_pair(_A, _b);
+			parameters.emplace_back(_A, _b);
+			transposedMatrices.emplace_back(_A.transpose());
 		}
 
 		~lintrafoParameters(){
@@ -89,35 +99,67 @@ namespace hypro {
 		}
 
 		matrix_t<Number> matrix() const {
-			assert(parameters.begin()->first == 1);
-			return parameters.begin()->second.first;
+			return parameters.front().first;
 		}
 
 		vector_t<Number> vector() const {
-			assert(parameters.begin()->first == 1);
-			return parameters.begin()->second.second;
+			return parameters.front().second;
+		}
+
+		/**
+		 * @brief      Returns the index in the parameter table for the passed exponent.
+		 * @param[in]  exponent  The exponent, which needs to be a power of 2^power.
+		 */
+		std::size_t tableIndex(unsigned exponent) const {
+			assert(exponent > 0);
+			std::size_t index = 0;
+			while(exponent > 1) {
+				assert(exponent % unsigned(carl::pow(2,power)) == 0);
+				exponent = exponent >> power;
+				++index;
+			}
+			return index;
+		}
+
+		/**
+		 * @brief      Makes sure the parameter table holds all entries up to the passed exponent. This allows to compute
+		 * the table once, e.g. for a whole flowpipe, before evaluation.
+		 */
+		void precompute(unsigned exponent) const {
+			ScopedLock<std::recursive_mutex> lock(mParameterMutex);
+			std::size_t index = tableIndex(exponent);
+			while(parameters.size() <= index) {
+				createNextReduct();
+			}
 		}
 
 		const std::pair<matrix_t<Number>, vector_t<Number>>& getParameterSet(unsigned exponent) const {
 			//std::cout << this << " Request parameter set for exponent " << exponent << std::endl;
-			if(parameters.find(exponent) != parameters.end()){
-				return parameters.at(exponent);
-			}
-			// create new parameters
-			while((--parameters.end())->first < exponent) {
+			std::size_t index = tableIndex(exponent);
+			ScopedLock<std::recursive_mutex> lock(mParameterMutex);
+			while(parameters.size() <= index) {
 				createNextReduct();
 			}
-			assert(parameters.find(exponent) != parameters.end());
-			return parameters.at(exponent);
+			return parameters[index];
 		};
 
+		const matrix_t<Number>& getTransposedMatrix(unsigned exponent) const {
+			std::size_t index = tableIndex(exponent);
+			ScopedLock<std::recursive_mutex> lock(mParameterMutex);
+			while(parameters.size() <= index) {
+				createNextReduct();
+			}
+			return transposedMatrices[index];
+		}
+
 		vector_t<Number> getTransformedDirection(const vector_t<Number>& inDirection, unsigned exponent) const {
 			#ifdef HYPRO_USE_VECTOR_CACHING
+			ScopedLock<std::recursive_mutex> lock(mParameterMutex);
 			//TRACE("hypro.representations.supportFunction","Attempt to access cache." << " (@" << this << ")");
 			auto cachePos = mVectorCache.get(Cacheable<vector_t<Number>>(exponent,inDirection));
 			if(cachePos == mVectorCache.end()) {
 				//TRACE("hypro.representations.supportFunction","Insert item into cache." << " (@" << this << ")");
-				vector_t<Number> tmp = getParameterSet(exponent).first.transpose() * inDirection;
+				vector_t<Number> tmp = getTransposedMatrix(exponent) * inDirection;
 				auto pos = mVectorCache.insert(Cacheable<vector_t<Number>>(exponent,inDirection), tmp);
 				assert((*pos).second.rows() == inDirection.rows());
 				return (*pos).second;
@@ -125,13 +167,13 @@ namespace hypro {
 			assert((*cachePos).second.rows() == inDirection.rows());
 			return (*cachePos).second;
 			#else
-			matrix_t<Number> tmp = getParameterSet(exponent).first.transpose();
-			return tmp * inDirection;
+			return getTransposedMatrix(exponent) * inDirection;
 			#endif
 		}
 
 		matrix_t<Number> getTransformedDirections(const matrix_t<Number>& inDirections, unsigned exponent) const {
 			#ifdef HYPRO_USE_VECTOR_CACHING
+			ScopedLock<std::recursive_mutex> lock(mParameterMutex);
 			//std::cout << __func__ << " attempt to access cache ";
 			auto cachePos = mMatrixCache.get(Cacheable<matrix_t<Number>>(exponent,inDirections));
 			//std::cout << "done." << std::endl;
@@ -147,29 +189,28 @@ namespace hypro {
 		}
 
 		void createNextReduct() const {
-			// the last created reduction pair is at the back, as a std::map is per default sorted ascending
+			// the last created reduction pair is at the back of the table.
 			assert(parameters.size() > 0);
+			assert(parameters.size() == transposedMatrices.size());
 			std::size_t powerOfTwo = carl::pow(2, power);
 			// first compute the new b
-			vector_t<Number> bTrans = (--parameters.end())->second.second;
-			matrix_t<Number> aTrans = (--parameters.end())->second.first;
-			//std::cout << "Starting from exponent " << (--matrices.end())->first << std::endl;
-			unsigned exponent = ((--parameters.end())->first) * powerOfTwo;
-			//std::cout << "New exponent: " << exponent << std::endl;
+			vector_t<Number> bTrans = parameters.back().second;
+			matrix_t<Number> aTrans = parameters.back().first;
 			// accumulate b
 			for (std::size_t i = 1; i < powerOfTwo ; i++){
 				// Note: aTrans hasn't changed yet -> we can use it for transformation.
-				bTrans = aTrans*bTrans + (--parameters.end())->second.second;
+				bTrans = aTrans*bTrans + parameters.back().second;
 			}
 			// accumulate A
 			for (std::size_t i = 0; i < power; i++){
 				aTrans = aTrans*aTrans;
 			}
-			parameters[exponent] = std::make_pair(aTrans, bTrans);
+			transposedMatrices.emplace_back(aTrans.transpose());
+			parameters.emplace_back(std::move(aTrans), std::move(bTrans));
 		}
 
 		bool operator== (const lintrafoParameters<Number>& rhs) const {
-			return (this->parameters.begin()->second == rhs.parameters.begin()->second);
+			return (this->parameters.front() == rhs.parameters.front());
 		}
 
 	};
@@ -0,0 +1,175 @@
+/*
+ * DenseTaylorModel.h
+ *
+ * Taylor models over a fixed set of variables with dense coefficient arrays.
+ */
+
+#pragma once
+
+#include "TaylorModel.h"
+#include "../../config.h"
+#ifdef HYPRO_USE_MULTITHREADING
+#include "../../util/multithreading/ThreadPool.h"
+#include <future>
+#endif
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class enumerating all monomials over a fixed, sorted set of variables up to a given total degree.
+ * @details    Monomials are ordered graded-lexicographically, i.e. by total degree and within one degree
+ * lexicographically, such that all monomials up to degree d form a prefix. The index of a monomial is computed from its
+ * exponents by counting the monomials preceding it, which also yields the index of a product without a multiplication
+ * table. Monomials exceeding the order, up to twice the order, continue this order, such that the truncated terms of a
+ * product are collected per monomial without storing these monomials.
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class DenseTaylorModelBasis {
+  public:
+	/**
+	 * @brief      Ranges of all monomials of a basis over a domain.
+	 */
+	struct Ranges {
+		std::vector<std::vector<carl::Interval<Number>>> powers;  // powers of each variable up to 2*order+1
+		std::vector<carl::Interval<Number>> monomials;
+	};
+
+  private:
+	std::vector<carl::Variable> mVariables;
+	exponent mOrder;
+	std::vector<std::vector<exponent>> mExponents;
+	std::vector<exponent> mDegrees;
+	std::vector<std::size_t> mDegreeEnds;  // number of monomials up to the degree
+	std::vector<std::vector<std::size_t>> mCounts;  // number of monomials in m variables up to degree s, s <= 2*order
+
+  public:
+	DenseTaylorModelBasis( const std::vector<carl::Variable>& variables, exponent order );
+
+	/**
+	 * @brief      Returns the shared basis for the passed variables and order, bases are created only once.
+	 */
+	static std::shared_ptr<const DenseTaylorModelBasis<Number>> get( const std::vector<carl::Variable>& variables,
+																	 exponent order );
+
+	std::size_t size() const { return mExponents.size(); }
+	exponent order() const { return mOrder; }
+	const std::vector<carl::Variable>& variables() const { return mVariables; }
+	const std::vector<exponent>& exponents( std::size_t i ) const { return mExponents[i]; }
+	exponent degree( std::size_t i ) const { return mDegrees[i]; }
+	std::size_t degreeEnd( exponent d ) const { return mDegreeEnds[std::min( d, mOrder )]; }
+	/**
+	 * @brief      Returns the number of monomials up to twice the order, which bounds the indices of all products.
+	 */
+	std::size_t productEnd() const { return mCounts[mVariables.size()][2 * std::size_t( mOrder )]; }
+
+	/**
+	 * @brief      Returns the index of the product of the monomials i and j, truncated products yield indices from
+	 * size() to productEnd().
+	 */
+	std::size_t product( std::size_t i, std::size_t j ) const {
+		const std::vector<exponent>& lhs = mExponents[i];
+		const std::vector<exponent>& rhs = mExponents[j];
+		return rank( [&]( std::size_t k ) { return lhs[k] + rhs[k]; }, mDegrees[i] + mDegrees[j] );
+	}
+
+	bool variableIndex( const carl::Variable& v, std::size_t& pos ) const;
+	bool index( const std::vector<exponent>& exps, std::size_t& i ) const;
+
+	Ranges evaluate( Domain<Number>& domain ) const;
+	carl::Interval<Number> evaluate( const std::vector<exponent>& exps, const Ranges& ranges ) const;
+
+	/**
+	 * @brief      Returns the range of the product of the monomials i and j.
+	 */
+	carl::Interval<Number> productRange( std::size_t i, std::size_t j, const Ranges& ranges ) const;
+
+  private:
+	/**
+	 * @brief      Returns the position of the monomial with the passed exponents and total degree in the graded
+	 * lexicographic order of all monomials up to twice the order.
+	 */
+	template <typename Exponents>
+	std::size_t rank( const Exponents& exps, std::size_t degree ) const {
+		assert( degree <= 2 * std::size_t( mOrder ) );
+		std::size_t result = degree == 0 ? 0 : mCounts[mVariables.size()][degree - 1];
+		// within a degree, monomials with a larger exponent of the first differing variable come first.
+		std::size_t remaining = degree;
+		for ( std::size_t k = 0; k + 1 < mVariables.size(); ++k ) {
+			std::size_t e = exps( k );
+			if ( remaining > e ) {
+				result += mCounts[mVariables.size() - k - 1][remaining - e - 1];
+			}
+			remaining -= e;
+		}
+		return result;
+	}
+};
+
+/**
+ * @brief      Class for Taylor models whose expansion is stored as dense coefficient vector over a
+ * DenseTaylorModelBasis.
+ * @details    Multiplication and integration truncate on the fly: coefficients of products exceeding the order of the
+ * basis are accumulated per monomial, only the ranges of the monomials which actually occur are evaluated.
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class DenseTaylorModel {
+  public:
+	using Basis = DenseTaylorModelBasis<Number>;
+	using BasisPtr = std::shared_ptr<const Basis>;
+	using Ranges = typename Basis::Ranges;
+
+  private:
+	BasisPtr mBasis;
+	std::vector<carl::Interval<Number>> mCoefficients;
+	carl::Interval<Number> mRemainder;
+
+  public:
+	DenseTaylorModel( const BasisPtr& basis );
+	DenseTaylorModel( const BasisPtr& basis, const carl::Interval<Number>& I );
+	DenseTaylorModel( const BasisPtr& basis, const carl::Variable& v );
+	DenseTaylorModel( const BasisPtr& basis, const TaylorModel<Number>& tm, const Ranges& ranges );
+
+	/**
+	 * @brief      Checks whether all variables of the passed Taylor model belong to the basis.
+	 */
+	static bool representable( const Basis& basis, const TaylorModel<Number>& tm );
+
+	TaylorModel<Number> toTaylorModel() const;
+
+	const carl::Interval<Number>& coefficient( std::size_t i ) const { return mCoefficients[i]; }
+	const carl::Interval<Number>& remainder() const { return mRemainder; }
+
+	carl::Interval<Number> polyEnclosure( const Ranges& ranges ) const;
+	carl::Interval<Number> enclosure( const Ranges& ranges ) const;
+
+	DenseTaylorModel<Number>& operator+=( const DenseTaylorModel<Number>& tm );
+	DenseTaylorModel<Number>& operator-=( const DenseTaylorModel<Number>& tm );
+
+	void multiply_assign( const carl::Interval<Number>& I );
+	DenseTaylorModel<Number> multiply( const DenseTaylorModel<Number>& tm, const Ranges& ranges ) const;
+
+	void integration_assign( const carl::Variable& v, const carl::Interval<Number>& range_of_v, const Ranges& ranges );
+
+	/**
+	 * @brief      Computes the Picard operator like TaylorModelVec::Picard using dense arithmetic over the variables of
+	 * the domain.
+	 * The components of the ODE are computed in parallel if multithreading is enabled.
+	 * @return     False, if a Taylor model or the ODE contains a variable which is not in the domain. The result is not
+	 * modified in this case.
+	 */
+	static bool Picard( TaylorModelVec<Number>& result, const TaylorModelVec<Number>& x, const TaylorModelVec<Number>& x0,
+						const PolynomialODE<Number>& ode, Domain<Number>& domain, carl::Variable::Arg t,
+						const carl::Interval<Number>& range_of_t, const exponent order );
+};
+
+}  // namespace
+
+#include "DenseTaylorModel.tpp"
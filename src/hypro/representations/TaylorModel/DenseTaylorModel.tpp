@@ -0,0 +1,543 @@
+/*
+ * DenseTaylorModel.tpp
+ *
+ * Taylor models over a fixed set of variables with dense coefficient arrays.
+ */
+
+#include "DenseTaylorModel.h"
+
+namespace hypro {
+
+template <typename Number>
+DenseTaylorModelBasis<Number>::DenseTaylorModelBasis( const std::vector<carl::Variable> &variables, exponent order )
+	: mVariables( variables ), mOrder( order ) {
+	std::sort( mVariables.begin(), mVariables.end() );
+
+	// collect all exponent vectors up to the order, one variable after another.
+	// Products exceeding the order are ranked by the counts below and never enumerated.
+	std::vector<std::vector<exponent>> exps( 1 );
+	std::vector<exponent> degrees( 1, 0 );
+	for ( std::size_t k = 0; k < mVariables.size(); ++k ) {
+		std::vector<std::vector<exponent>> extended;
+		std::vector<exponent> extendedDegrees;
+		for ( std::size_t i = 0; i < exps.size(); ++i ) {
+			for ( exponent e = 0; degrees[i] + e <= mOrder; ++e ) {
+				extended.push_back( exps[i] );
+				extended.back().push_back( e );
+				extendedDegrees.push_back( degrees[i] + e );
+			}
+		}
+		exps = std::move( extended );
+		degrees = std::move( extendedDegrees );
+	}
+
+	// graded lexicographic order
+	std::vector<std::size_t> permutation( exps.size() );
+	for ( std::size_t i = 0; i < permutation.size(); ++i ) {
+		permutation[i] = i;
+	}
+	std::sort( permutation.begin(), permutation.end(), [&]( std::size_t lhs, std::size_t rhs ) {
+		return degrees[lhs] != degrees[rhs] ? degrees[lhs] < degrees[rhs] : exps[lhs] > exps[rhs];
+	} );
+
+	mDegreeEnds = std::vector<std::size_t>( mOrder + 1, 0 );
+	for ( std::size_t i : permutation ) {
+		mExponents.push_back( std::move( exps[i] ) );
+		mDegrees.push_back( degrees[i] );
+		++mDegreeEnds[degrees[i]];
+	}
+	for ( exponent d = 1; d <= mOrder; ++d ) {
+		mDegreeEnds[d] += mDegreeEnds[d - 1];
+	}
+
+	// the number of monomials in m variables up to degree s is the binomial coefficient (s+m choose m).
+	mCounts = std::vector<std::vector<std::size_t>>( mVariables.size() + 1, std::vector<std::size_t>( 2 * mOrder + 1, 1 ) );
+	for ( std::size_t m = 1; m <= mVariables.size(); ++m ) {
+		for ( std::size_t s = 1; s <= 2 * std::size_t( mOrder ); ++s ) {
+			mCounts[m][s] = mCounts[m][s - 1] + mCounts[m - 1][s];
+		}
+	}
+}
+
+template <typename Number>
+std::shared_ptr<const DenseTaylorModelBasis<Number>> DenseTaylorModelBasis<Number>::get(
+	  const std::vector<carl::Variable> &variables, exponent order ) {
+	static std::mutex mutex;
+	static std::map<std::pair<std::vector<carl::Variable>, exponent>, std::shared_ptr<const DenseTaylorModelBasis<Number>>> bases;
+
+	std::vector<carl::Variable> sorted( variables );
+	std::sort( sorted.begin(), sorted.end() );
+
+	std::lock_guard<std::mutex> lock( mutex );
+	auto key = std::make_pair( sorted, order );
+	auto basisIt = bases.find( key );
+	if ( basisIt == bases.end() ) {
+		basisIt = bases.emplace( key, std::make_shared<const DenseTaylorModelBasis<Number>>( sorted, order ) ).first;
+	}
+	return basisIt->second;
+}
+
+template <typename Number>
+bool DenseTaylorModelBasis<Number>::variableIndex( const carl::Variable &v, std::size_t &pos ) const {
+	auto varIt = std::lower_bound( mVariables.begin(), mVariables.end(), v );
+	if ( varIt == mVariables.end() || *varIt != v ) {
+		return false;
+	}
+	pos = std::size_t( varIt - mVariables.begin() );
+	return true;
+}
+
+template <typename Number>
+bool DenseTaylorModelBasis<Number>::index( const std::vector<exponent> &exps, std::size_t &i ) const {
+	if ( exps.size() != mVariables.size() ) {
+		return false;
+	}
+	std::size_t degree = 0;
+	for ( exponent e : exps ) {
+		degree += e;
+	}
+	if ( degree > mOrder ) {
+		return false;
+	}
+	i = rank( [&]( std::size_t k ) { return exps[k]; }, degree );
+	return true;
+}
+
+template <typename Number>
+typename DenseTaylorModelBasis<Number>::Ranges DenseTaylorModelBasis<Number>::evaluate( Domain<Number> &domain ) const {
+	Ranges ranges;
+
+	for ( const auto &v : mVariables ) {
+		std::vector<carl::Interval<Number>> powers;
+		for ( exponent e = 0; e <= 2 * mOrder + 1; ++e ) {
+			powers.push_back( domain.power( v, e ) );
+		}
+		ranges.powers.emplace_back( std::move( powers ) );
+	}
+
+	ranges.monomials.reserve( size() );
+	for ( const auto &exps : mExponents ) {
+		ranges.monomials.push_back( evaluate( exps, ranges ) );
+	}
+
+	return ranges;
+}
+
+template <typename Number>
+carl::Interval<Number> DenseTaylorModelBasis<Number>::evaluate( const std::vector<exponent> &exps, const Ranges &ranges ) const {
+	carl::Interval<Number> result( 1 );
+
+	for ( std::size_t k = 0; k < exps.size(); ++k ) {
+		if ( exps[k] == 0 ) {
+			continue;
+		}
+
+		if ( exps[k] < ranges.powers[k].size() ) {
+			result *= ranges.powers[k][exps[k]];
+		} else {
+			result *= ranges.powers[k][1].pow( exps[k] );
+		}
+	}
+
+	return result;
+}
+
+template <typename Number>
+carl::Interval<Number> DenseTaylorModelBasis<Number>::productRange( std::size_t i, std::size_t j, const Ranges &ranges ) const {
+	carl::Interval<Number> result( 1 );
+	const std::vector<exponent> &lhs = mExponents[i];
+	const std::vector<exponent> &rhs = mExponents[j];
+
+	// the exponents of a product do not exceed twice the order, which is covered by the powers.
+	for ( std::size_t k = 0; k < lhs.size(); ++k ) {
+		if ( lhs[k] + rhs[k] > 0 ) {
+			result *= ranges.powers[k][lhs[k] + rhs[k]];
+		}
+	}
+
+	return result;
+}
+
+template <typename Number>
+DenseTaylorModel<Number>::DenseTaylorModel( const BasisPtr &basis )
+	: mBasis( basis ), mCoefficients( basis->size(), carl::Interval<Number>( 0 ) ), mRemainder( 0 ) {
+}
+
+template <typename Number>
+DenseTaylorModel<Number>::DenseTaylorModel( const BasisPtr &basis, const carl::Interval<Number> &I )
+	: DenseTaylorModel( basis ) {
+	// the constant monomial is the first one
+	mCoefficients[0] = I;
+}
+
+template <typename Number>
+DenseTaylorModel<Number>::DenseTaylorModel( const BasisPtr &basis, const carl::Variable &v ) : DenseTaylorModel( basis ) {
+	assert( basis->order() > 0 );
+
+	std::size_t pos, i;
+	bool bFound = basis->variableIndex( v, pos );
+	assert( bFound );
+	(void)bFound;
+
+	std::vector<exponent> exps( basis->variables().size(), 0 );
+	exps[pos] = 1;
+	basis->index( exps, i );
+	mCoefficients[i] = carl::Interval<Number>( 1 );
+}
+
+template <typename Number>
+DenseTaylorModel<Number>::DenseTaylorModel( const BasisPtr &basis, const TaylorModel<Number> &tm, const Ranges &ranges )
+	: DenseTaylorModel( basis ) {
+	assert( representable( *basis, tm ) );
+
+	for ( const auto &term : tm.expansion ) {
+		std::vector<exponent> exps( basis->variables().size(), 0 );
+		exponent degree = 0;
+
+		if ( term.monomial() ) {
+			const Monomial &m = *( term.monomial() );
+
+			for ( unsigned i = 0; i < m.nrVariables(); ++i ) {
+				std::size_t pos = 0;
+				basis->variableIndex( m[i].first, pos );
+				exps[pos] = m[i].second;
+				degree += m[i].second;
+			}
+		}
+
+		std::size_t i;
+		if ( degree <= basis->order() && basis->index( exps, i ) ) {
+			mCoefficients[i] += term.coeff();
+		} else {
+			mRemainder += term.coeff() * basis->evaluate( exps, ranges );
+		}
+	}
+
+	mRemainder += tm.remainder;
+}
+
+template <typename Number>
+bool DenseTaylorModel<Number>::representable( const Basis &basis, const TaylorModel<Number> &tm ) {
+	for ( const auto &term : tm.expansion ) {
+		if ( term.monomial() ) {
+			const Monomial &m = *( term.monomial() );
+
+			for ( unsigned i = 0; i < m.nrVariables(); ++i ) {
+				std::size_t pos;
+				if ( !basis.variableIndex( m[i].first, pos ) ) {
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+template <typename Number>
+TaylorModel<Number> DenseTaylorModel<Number>::toTaylorModel() const {
+	MultivariatePolynomial<carl::Interval<Number>> p;
+
+	for ( std::size_t i = 0; i < mCoefficients.size(); ++i ) {
+		if ( mCoefficients[i].isZero() ) {
+			continue;
+		}
+
+		Term<carl::Interval<Number>> term( mCoefficients[i] );
+		const std::vector<exponent> &exps = mBasis->exponents( i );
+
+		for ( std::size_t k = 0; k < exps.size(); ++k ) {
+			for ( exponent e = 0; e < exps[k]; ++e ) {
+				term *= mBasis->variables()[k];
+			}
+		}
+
+		p += term;
+	}
+
+	return TaylorModel<Number>( p, mRemainder );
+}
+
+template <typename Number>
+carl::Interval<Number> DenseTaylorModel<Number>::polyEnclosure( const Ranges &ranges ) const {
+	carl::Interval<Number> I( 0 );
+
+	for ( std::size_t i = 0; i < mCoefficients.size(); ++i ) {
+		if ( !mCoefficients[i].isZero() ) {
+			I += mCoefficients[i] * ranges.monomials[i];
+		}
+	}
+
+	return I;
+}
+
+template <typename Number>
+carl::Interval<Number> DenseTaylorModel<Number>::enclosure( const Ranges &ranges ) const {
+	return polyEnclosure( ranges ) + mRemainder;
+}
+
+template <typename Number>
+DenseTaylorModel<Number> &DenseTaylorModel<Number>::operator+=( const DenseTaylorModel<Number> &tm ) {
+	assert( mBasis == tm.mBasis );
+
+	for ( std::size_t i = 0; i < mCoefficients.size(); ++i ) {
+		mCoefficients[i] += tm.mCoefficients[i];
+	}
+	mRemainder += tm.mRemainder;
+
+	return *this;
+}
+
+template <typename Number>
+DenseTaylorModel<Number> &DenseTaylorModel<Number>::operator-=( const DenseTaylorModel<Number> &tm ) {
+	assert( mBasis == tm.mBasis );
+
+	for ( std::size_t i = 0; i < mCoefficients.size(); ++i ) {
+		mCoefficients[i] -= tm.mCoefficients[i];
+	}
+	mRemainder -= tm.mRemainder;
+
+	return *this;
+}
+
+template <typename Number>
+void DenseTaylorModel<Number>::multiply_assign( const carl::Interval<Number> &I ) {
+	for ( auto &coefficient : mCoefficients ) {
+		coefficient *= I;
+	}
+	mRemainder *= I;
+}
+
+template <typename Number>
+DenseTaylorModel<Number> DenseTaylorModel<Number>::multiply( const DenseTaylorModel<Number> &tm, const Ranges &ranges ) const {
+	assert( mBasis == tm.mBasis );
+
+	DenseTaylorModel<Number> result( mBasis );
+	std::size_t size = mBasis->size();
+	// truncated terms per monomial, together with one pair of factors yielding the monomial.
+	std::unordered_map<std::size_t, std::pair<carl::Interval<Number>, std::pair<std::size_t, std::size_t>>> truncated;
+
+	for ( std::size_t i = 0; i < size; ++i ) {
+		if ( mCoefficients[i].isZero() ) {
+			continue;
+		}
+
+		// the products with the first monomials do not exceed the order
+		std::size_t end = mBasis->degreeEnd( mBasis->order() - mBasis->degree( i ) );
+		for ( std::size_t j = 0; j < end; ++j ) {
+			if ( !tm.mCoefficients[j].isZero() ) {
+				result.mCoefficients[mBasis->product( i, j )] += mCoefficients[i] * tm.mCoefficients[j];
+			}
+		}
+		for ( std::size_t j = end; j < size; ++j ) {
+			if ( !tm.mCoefficients[j].isZero() ) {
+				auto termIt = truncated.find( mBasis->product( i, j ) );
+				if ( termIt == truncated.end() ) {
+					truncated.emplace( mBasis->product( i, j ), std::make_pair( mCoefficients[i] * tm.mCoefficients[j], std::make_pair( i, j ) ) );
+				} else {
+					termIt->second.first += mCoefficients[i] * tm.mCoefficients[j];
+				}
+			}
+		}
+	}
+
+	// the truncated terms are bounded by the ranges of their monomials, which are evaluated on demand.
+	for ( const auto &term : truncated ) {
+		if ( !term.second.first.isZero() ) {
+			result.mRemainder += term.second.first * mBasis->productRange( term.second.second.first, term.second.second.second, ranges );
+		}
+	}
+
+	carl::Interval<Number> enclosure_tm1 = polyEnclosure( ranges );
+	carl::Interval<Number> enclosure_tm2 = tm.polyEnclosure( ranges );
+
+	enclosure_tm1 *= tm.mRemainder;
+	enclosure_tm2 *= mRemainder;
+
+	result.mRemainder += mRemainder * tm.mRemainder + enclosure_tm1 + enclosure_tm2;
+
+	return result;
+}
+
+template <typename Number>
+void DenseTaylorModel<Number>::integration_assign( const carl::Variable &v, const carl::Interval<Number> &range_of_v,
+												   const Ranges &ranges ) {
+	std::size_t pos;
+	bool bFound = mBasis->variableIndex( v, pos );
+	assert( bFound );
+	(void)bFound;
+
+	std::vector<carl::Interval<Number>> coefficients( mCoefficients.size(), carl::Interval<Number>( 0 ) );
+	carl::Interval<Number> truncated( 0 );
+
+	for ( std::size_t i = 0; i < mCoefficients.size(); ++i ) {
+		if ( mCoefficients[i].isZero() ) {
+			continue;
+		}
+
+		std::vector<exponent> exps = mBasis->exponents( i );
+		carl::Interval<Number> coefficient = mCoefficients[i];
+
+		if ( exps[pos] > 0 ) {
+			carl::Interval<Number> intTemp( (double)exps[pos] + 1 ), intOne( 1 );
+			coefficient *= intOne / intTemp;
+		}
+
+		++exps[pos];
+
+		std::size_t j;
+		if ( mBasis->degree( i ) < mBasis->order() && mBasis->index( exps, j ) ) {
+			coefficients[j] = coefficient;
+		} else {
+			truncated += coefficient * mBasis->evaluate( exps, ranges );
+		}
+	}
+
+	mCoefficients = std::move( coefficients );
+	mRemainder *= range_of_v;
+	mRemainder += truncated;
+}
+
+template <typename Number>
+bool DenseTaylorModel<Number>::Picard( TaylorModelVec<Number> &result, const TaylorModelVec<Number> &x,
+									   const TaylorModelVec<Number> &x0, const PolynomialODE<Number> &ode,
+									   Domain<Number> &domain, carl::Variable::Arg t,
+									   const carl::Interval<Number> &range_of_t, const exponent order ) {
+	std::vector<carl::Variable> variables;
+	std::map<carl::Variable, carl::Interval<Number>> &assignments = domain.get_assignments();
+	for ( auto iter = assignments.begin(); iter != assignments.end(); ++iter ) {
+		variables.push_back( iter->first );
+	}
+
+	if ( order == 0 || x0.tms.size() != ode.assignments.size() ) {
+		return false;
+	}
+
+	BasisPtr basis = Basis::get( variables, order );
+
+	std::size_t pos;
+	if ( !basis->variableIndex( t, pos ) ) {
+		return false;
+	}
+
+	for ( auto iter = x.tms.begin(); iter != x.tms.end(); ++iter ) {
+		if ( !representable( *basis, iter->second ) ) {
+			return false;
+		}
+	}
+
+	for ( auto iter = ode.assignments.begin(); iter != ode.assignments.end(); ++iter ) {
+		auto x0Iter = x0.tms.find( iter->first );
+		if ( x0Iter == x0.tms.end() || !representable( *basis, x0Iter->second ) ) {
+			return false;
+		}
+
+		for ( const auto &term : iter->second ) {
+			if ( term.monomial() ) {
+				const Monomial &m = *( term.monomial() );
+
+				for ( unsigned i = 0; i < m.nrVariables(); ++i ) {
+					if ( x.tms.find( m[i].first ) == x.tms.end() && !basis->variableIndex( m[i].first, pos ) ) {
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	Ranges ranges = basis->evaluate( domain );
+
+	std::map<carl::Variable, DenseTaylorModel<Number>> substitutions;
+	for ( auto iter = x.tms.begin(); iter != x.tms.end(); ++iter ) {
+		substitutions.emplace( iter->first, DenseTaylorModel<Number>( basis, iter->second, ranges ) );
+	}
+
+	// powers of the substituted Taylor models are shared among all terms of the ODE. They are computed upfront, such that
+	// the components of the ODE can be processed independently afterwards.
+	std::map<carl::Variable, exponent> maxExponents;
+	for ( auto iter = ode.assignments.begin(); iter != ode.assignments.end(); ++iter ) {
+		for ( const auto &term : iter->second ) {
+			if ( term.monomial() ) {
+				const Monomial &m = *( term.monomial() );
+
+				for ( unsigned i = 0; i < m.nrVariables(); ++i ) {
+					exponent &e = maxExponents[m[i].first];
+					e = std::max( e, m[i].second );
+				}
+			}
+		}
+	}
+
+	std::map<std::pair<carl::Variable, exponent>, DenseTaylorModel<Number>> powers;
+	for ( const auto &maxExponent : maxExponents ) {
+		const carl::Variable &v = maxExponent.first;
+		auto sub = substitutions.find( v );
+		DenseTaylorModel<Number> base = sub != substitutions.end() ? sub->second : DenseTaylorModel<Number>( basis, v );
+
+		powers.emplace( std::make_pair( v, exponent( 1 ) ), base );
+		for ( exponent k = 2; k <= maxExponent.second; ++k ) {
+			powers.emplace( std::make_pair( v, k ), powers.at( std::make_pair( v, k - 1 ) ).multiply( base, ranges ) );
+		}
+	}
+
+	std::vector<typename std::map<carl::Variable, MultivariatePolynomial<carl::Interval<Number>>>::const_iterator> components;
+	for ( auto iter = ode.assignments.begin(); iter != ode.assignments.end(); ++iter ) {
+		components.push_back( iter );
+	}
+	std::vector<DenseTaylorModel<Number>> tms( components.size(), DenseTaylorModel<Number>( basis ) );
+
+	// the components only read the shared basis, ranges and powers. As dense arithmetic does not create monomials,
+	// carl's monomial pool is only accessed by the conversion below.
+	auto compute = [&]( std::size_t begin, std::size_t end ) {
+		for ( std::size_t c = begin; c < end; ++c ) {
+			DenseTaylorModel<Number> &tmTemp = tms[c];
+
+			for ( const auto &term : components[c]->second ) {
+				DenseTaylorModel<Number> termResult( basis, term.coeff() );
+
+				if ( term.monomial() ) {
+					const Monomial &m = *( term.monomial() );
+
+					for ( unsigned i = 0; i < m.nrVariables(); ++i ) {
+						termResult = termResult.multiply( powers.at( m[i] ), ranges );
+					}
+				}
+
+				tmTemp += termResult;
+			}
+
+			tmTemp.integration_assign( t, range_of_t, ranges );
+			tmTemp += DenseTaylorModel<Number>( basis, x0.tms.at( components[c]->first ), ranges );
+		}
+	};
+
+#ifdef HYPRO_USE_MULTITHREADING
+	if ( components.size() >= TAYLOR_MODEL_PARALLEL_MIN_COMPONENTS && !ThreadPool::isWorkerThread() ) {
+		ThreadPool &pool = ThreadPool::getInstance();
+		std::size_t chunkCount = std::min( pool.size(), components.size() );
+		std::size_t chunkSize = ( components.size() + chunkCount - 1 ) / chunkCount;
+		std::vector<std::future<void>> chunks;
+		for ( std::size_t begin = 0; begin < components.size(); begin += chunkSize ) {
+			chunks.emplace_back( pool.enqueue( compute, begin, std::min( begin + chunkSize, components.size() ) ) );
+		}
+		for ( auto &chunk : chunks ) {
+			chunk.get();
+		}
+	} else {
+		compute( 0, components.size() );
+	}
+#else
+	compute( 0, components.size() );
+#endif
+
+	TaylorModelVec<Number> tmvTemp;
+	for ( std::size_t c = 0; c < components.size(); ++c ) {
+		tmvTemp.assign( components[c]->first, tms[c].toTaylorModel() );
+	}
+
+	result = tmvTemp;
+
+	return true;
+}
+
+}  // namespace
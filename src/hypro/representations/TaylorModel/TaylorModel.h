@@ -23,6 +23,12 @@ class Domain {
 	std::map<carl::Variable, carl::Interval<Number>> assignments;
 	using assignment_type = std::pair<const carl::Variable, carl::Interval<Number>>;
 
+	// powers of the assigned intervals, extended on demand and dropped whenever an assignment may change
+	mutable std::map<carl::Variable, std::vector<carl::Interval<Number>>> powers;
+	using horner_term = std::pair<carl::Interval<Number>, std::vector<std::pair<carl::Variable, exponent>>>;
+
+	carl::Interval<Number> horner( std::vector<horner_term>& terms ) const;
+
   public:
 	Domain();
 	Domain( const Domain<Number>& domain );
@@ -34,6 +40,9 @@ class Domain {
 
 	std::map<carl::Variable, carl::Interval<Number>>& get_assignments();
 
+	carl::Interval<Number> power( const carl::Variable& v, exponent e ) const;
+	carl::Interval<Number> evaluate( const MultivariatePolynomial<carl::Interval<Number>>& p ) const;
+
 	Domain<Number>& operator=( const Domain<Number>& domain );
 
 	template <typename N>
@@ -46,6 +55,9 @@ class TaylorModelVec;
 template <typename Number>
 class Flowpipe;
 
+template <typename Number>
+class DenseTaylorModel;
+
 template <typename Number>
 class PolynomialODE {
   protected:
@@ -68,6 +80,7 @@ class PolynomialODE {
 	friend std::ostream& operator<<( std::ostream& os, const PolynomialODE<N>& ode );
 
 	friend class TaylorModelVec<Number>;
+	friend class DenseTaylorModel<Number>;
 };
 
 template <typename Number>
@@ -157,6 +170,7 @@ class TaylorModel {
 	friend std::ostream& operator<<( std::ostream& os, const TaylorModel<N>& tm );
 
 	friend class Flowpipe<Number>;
+	friend class DenseTaylorModel<Number>;
 };
 
 template <typename Number>
@@ -254,3 +268,4 @@ class TaylorModelVec {
 }  // namespace
 
 #include "TaylorModel.tpp"
+#include "DenseTaylorModel.h"
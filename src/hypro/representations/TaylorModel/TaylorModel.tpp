@@ -197,8 +197,7 @@ void TaylorModel<Number>::cutoff( const carl::Interval<Number> &threshold, Domai
 	for ( ; term != vTerms.end(); ) {
 		MultivariatePolynomial<carl::Interval<Number>> p( *term );
 
-		std::map<carl::Variable, carl::Interval<Number>> &d = domain.get_assignments();
-		carl::Interval<Number> intTemp = p.evaluate( d );
+		carl::Interval<Number> intTemp = domain.evaluate( p );
 
 		if ( threshold.contains( intTemp ) ) {
 			term = vTerms.erase( term );
@@ -218,8 +217,7 @@ void TaylorModel<Number>::cutoff_nr( const carl::Interval<Number> &threshold, Do
 	for ( ; term != vTerms.end(); ) {
 		MultivariatePolynomial<carl::Interval<Number>> p( *term );
 
-		std::map<carl::Variable, carl::Interval<Number>> &d = domain.get_assignments();
-		carl::Interval<Number> intTemp = p.evaluate( d );
+		carl::Interval<Number> intTemp = domain.evaluate( p );
 
 		if ( threshold.contains( intTemp ) ) {
 			term = vTerms.erase( term );
@@ -252,10 +250,7 @@ void TaylorModel<Number>::truncation( const exponent order, Domain<Number> &doma
 	TermsType &vTerms2 = p.getTerms();
 	vTerms2 = truncated_terms;
 
-	carl::Interval<Number> I;
-
-	std::map<carl::Variable, carl::Interval<Number>> &d = domain.get_assignments();
-	I = p.evaluate( d );
+	carl::Interval<Number> I = domain.evaluate( p );
 
 	remainder += I;
 }
@@ -279,17 +274,13 @@ void TaylorModel<Number>::truncation_nr( const exponent order ) {
 
 template <typename Number>
 void TaylorModel<Number>::enclosure( carl::Interval<Number> &I, Domain<Number> &domain ) const {
-	std::map<carl::Variable, carl::Interval<Number>> &d = domain.get_assignments();
-
-	I = expansion.evaluate( d );
+	I = domain.evaluate( expansion );
 	I += remainder;
 }
 
 template <typename Number>
 void TaylorModel<Number>::poly_enclosure( carl::Interval<Number> &I, Domain<Number> &domain ) const {
-	std::map<carl::Variable, carl::Interval<Number>> &d = domain.get_assignments();
-
-	I = expansion.evaluate( d );
+	I = domain.evaluate( expansion );
 }
 
 template <typename Number>
@@ -770,6 +761,7 @@ Domain<Number>::~Domain() {
 template <typename Number>
 Domain<Number>::Domain( const Domain<Number> &domain ) {
 	assignments = domain.assignments;
+	powers = domain.powers;
 }
 
 template <typename Number>
@@ -784,6 +776,8 @@ void Domain<Number>::assign( const carl::Variable &v, const carl::Interval<Numbe
 		assignments.erase( iter );
 		assignments.insert( assignment );
 	}
+
+	powers.erase( v );
 }
 
 template <typename Number>
@@ -800,12 +794,109 @@ bool Domain<Number>::find_assignment( carl::Interval<Number> &I, const carl::Var
 
 template <typename Number>
 std::map<carl::Variable, carl::Interval<Number>> &Domain<Number>::get_assignments() {
+	// the assignments may be modified by the caller
+	powers.clear();
 	return assignments;
 }
 
 template <typename Number>
 void Domain<Number>::clear() {
 	assignments.clear();
+	powers.clear();
+}
+
+template <typename Number>
+carl::Interval<Number> Domain<Number>::power( const carl::Variable &v, exponent e ) const {
+	std::vector<carl::Interval<Number>> &table = powers[v];
+
+	if ( table.empty() ) {
+		carl::Interval<Number> I;
+		if ( !find_assignment( I, v ) ) {
+			I = carl::Interval<Number>::unboundedInterval();
+		}
+
+		table.push_back( carl::Interval<Number>( 1 ) );
+		table.push_back( I );
+	}
+
+	while ( table.size() <= e ) {
+		table.push_back( table[1].pow( unsigned( table.size() ) ) );
+	}
+
+	return table[e];
+}
+
+template <typename Number>
+carl::Interval<Number> Domain<Number>::evaluate( const MultivariatePolynomial<carl::Interval<Number>> &p ) const {
+	std::vector<horner_term> terms;
+
+	for ( const auto &term : p ) {
+		horner_term hornerTerm( term.coeff(), std::vector<std::pair<carl::Variable, exponent>>() );
+
+		if ( term.monomial() ) {
+			const Monomial &m = *( term.monomial() );
+
+			for ( unsigned i = 0; i < m.nrVariables(); ++i ) {
+				hornerTerm.second.push_back( m[i] );
+			}
+		}
+
+		terms.push_back( std::move( hornerTerm ) );
+	}
+
+	return horner( terms );
+}
+
+// Factors out the smallest occurring variable v, i.e. p = sum_k v^k * p_k. If the interval of v does not contain
+// positive and negative values, the sum is evaluated by the Horner scheme, as then v^k * v^l = v^(k+l) holds for the
+// intervals. Otherwise, the even powers of v are only tight in the power table.
+template <typename Number>
+carl::Interval<Number> Domain<Number>::horner( std::vector<horner_term> &terms ) const {
+	carl::Interval<Number> result( 0 );
+
+	carl::Variable v = carl::Variable::NO_VARIABLE;
+	for ( const auto &term : terms ) {
+		if ( !term.second.empty() && ( v == carl::Variable::NO_VARIABLE || term.second.front().first < v ) ) {
+			v = term.second.front().first;
+		}
+	}
+
+	if ( v == carl::Variable::NO_VARIABLE ) {
+		for ( const auto &term : terms ) {
+			result += term.first;
+		}
+		return result;
+	}
+
+	std::map<exponent, std::vector<horner_term>> groups;
+	for ( auto &term : terms ) {
+		exponent e = 0;
+		if ( !term.second.empty() && term.second.front().first == v ) {
+			e = term.second.front().second;
+			term.second.erase( term.second.begin() );
+		}
+		groups[e].push_back( std::move( term ) );
+	}
+
+	carl::Interval<Number> I = power( v, 1 );
+	if ( I.isSemiPositive() || I.isSemiNegative() ) {
+		auto group = groups.rbegin();
+		exponent previous = group->first;
+		result = horner( group->second );
+
+		for ( ++group; group != groups.rend(); ++group ) {
+			result = result * power( v, previous - group->first ) + horner( group->second );
+			previous = group->first;
+		}
+
+		result *= power( v, previous );
+	} else {
+		for ( auto &group : groups ) {
+			result += power( v, group.first ) * horner( group.second );
+		}
+	}
+
+	return result;
 }
 
 template <typename Number>
@@ -813,6 +904,7 @@ Domain<Number> &Domain<Number>::operator=( const Domain<Number> &domain ) {
 	if ( this == &domain ) return *this;
 
 	assignments = domain.assignments;
+	powers = domain.powers;
 	return *this;
 }
 
@@ -1292,6 +1384,10 @@ TaylorModelVec<Number> TaylorModelVec<Number>::Picard( const TaylorModelVec<Numb
 													   const exponent order ) const {
 	TaylorModelVec<Number> tmvTemp;
 
+	if ( DenseTaylorModel<Number>::Picard( tmvTemp, *this, x0, ode, domain, t, range_of_t, order ) ) {
+		return tmvTemp;
+	}
+
 	for ( auto iter = ode.assignments.begin(); iter != ode.assignments.end(); ++iter ) {
 		TaylorModel<Number> tmODE( iter->second ), tmTemp;
 
@@ -1314,6 +1410,11 @@ void TaylorModelVec<Number>::Picard_assign( const TaylorModelVec<Number> &x0, co
 											const exponent order ) {
 	TaylorModelVec<Number> tmvTemp;
 
+	if ( DenseTaylorModel<Number>::Picard( tmvTemp, *this, x0, ode, domain, t, range_of_t, order ) ) {
+		*this = tmvTemp;
+		return;
+	}
+
 	for ( auto iter = ode.assignments.begin(); iter != ode.assignments.end(); ++iter ) {
 		TaylorModel<Number> tmODE( iter->second ), tmTemp;
 
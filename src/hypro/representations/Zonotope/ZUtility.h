@@ -13,6 +13,8 @@
 
 #include <eigen3/Eigen/Dense>
 #include <cmath>
+#include <utility>
+#include <vector>
 #include "../../config.h"
 
 namespace ZUtility {
@@ -75,6 +77,43 @@ std::vector<hypro::vector_t<Number>> getCornersRecursive(const hypro::matrix_t<N
 	return res;
 }
 
+/**
+ * @brief Computes the minimal and maximal value of a zonotope in the directions of all rows of a matrix in closed form.
+ * @details The support of a zonotope in direction n is n*c + ||G^T n||_1, thus all supports are obtained by two matrix
+ * products as mat*c +- |mat*G|*1.
+ * @param center The center of the zonotope.
+ * @param generators The generators of the zonotope.
+ * @param mat The matrix whose rows are the directions.
+ * @return A pair of vectors holding the minimal and the maximal value per row.
+ */
+template <typename Number>
+std::pair<hypro::vector_t<Number>, hypro::vector_t<Number>> rowBounds( const hypro::vector_t<Number>& center, const hypro::matrix_t<Number>& generators, const hypro::matrix_t<Number>& mat ) {
+	hypro::vector_t<Number> centerValues = mat * center;
+	hypro::vector_t<Number> extents = hypro::vector_t<Number>::Zero( mat.rows() );
+	if ( generators.cols() > 0 ) {
+		extents = ( mat * generators ).array().abs().rowwise().sum().matrix();
+	}
+	return std::make_pair( hypro::vector_t<Number>( centerValues - extents ), hypro::vector_t<Number>( centerValues + extents ) );
+}
+
+template <typename Number>
+hypro::matrix_t<Number> selectRows( const hypro::matrix_t<Number>& mat, const std::vector<unsigned>& rows ) {
+	hypro::matrix_t<Number> res = hypro::matrix_t<Number>( rows.size(), mat.cols() );
+	for ( unsigned pos = 0; pos < rows.size(); ++pos ) {
+		res.row( pos ) = mat.row( rows[pos] );
+	}
+	return res;
+}
+
+template <typename Number>
+hypro::vector_t<Number> selectRows( const hypro::vector_t<Number>& vec, const std::vector<unsigned>& rows ) {
+	hypro::vector_t<Number> res = hypro::vector_t<Number>( rows.size() );
+	for ( unsigned pos = 0; pos < rows.size(); ++pos ) {
+		res( pos ) = vec( rows[pos] );
+	}
+	return res;
+}
+
 template <typename Number>
 bool compareYVal( const hypro::vector_t<Number>& colvec1, const hypro::vector_t<Number>& colvec2 ) {
 	return ( colvec1( 1 ) < colvec2( 1 ) );
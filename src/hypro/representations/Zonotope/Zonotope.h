@@ -18,6 +18,8 @@
 #include "ZUtility.h"
 #include "../../datastructures/Halfspace.h"
 #include "../../util/pca.h"
+#include "../../util/VertexRange.h"
+#include "../../algorithms/convexHull/ZonotopeEnumeration.h"
 #include "../../util/adaptions_eigen/adaptions_eigen.h"
 
 #include <vector>
@@ -44,6 +46,16 @@ class ZonotopeT : public GeometricObject<Number, ZonotopeT<Number,Converter>> {
 	matrix_t<Number> mGenerators;
 
 	void removeGenerator( unsigned int colToRemove );
+	/**
+	 * @brief Intersects with the passed halfspaces, which are all assumed to cut the zonotope.
+	 */
+	ZonotopeT<Number,Converter> intersectCuttingHalfspaces( const matrix_t<Number>& mat, const vector_t<Number>& vec ) const;
+	/**
+	 * @brief Checks all halfspaces at once via the closed-form supports of the zonotope.
+	 * @return 1, if the zonotope is contained in all halfspaces, -1, if it lies outside of one halfspace, and 0 otherwise.
+	 * In the latter case the rows cutting the zonotope are collected.
+	 */
+	int classifyHalfspaces( const matrix_t<Number>& mat, const vector_t<Number>& vec, std::vector<unsigned>& cuttingRows ) const;
 
   public:
 	// Constructors and Destructors
@@ -196,15 +208,38 @@ class ZonotopeT : public GeometricObject<Number, ZonotopeT<Number,Converter>> {
 	std::vector<vector_t<Number>> computeZonotopeBoundary();
 
 	/**
-	 * @brief Compute a set of points containing the extreme points of a zonotopeT.
-	 * @details Compute all possible extreme points of a zonotopeT by considering all combinations of
-	 * generators. This gives a set of points, which contains also the real extreme points but also some
-	 * internal points.
+	 * @brief Compute the extreme points of a zonotopeT.
+	 * @details The vertices are the full-dimensional cells of the hyperplane arrangement of the generators, which are
+	 * enumerated output-sensitively instead of considering all combinations of generators, see ZonotopeEnumeration.
 	 * @return vector of points.
 	 */
 	std::vector<Point<Number>> vertices( const Location<Number>* = nullptr ) const;
 
+	/**
+	 * @brief Returns a range which enumerates all combinations of generators lazily.
+	 * @details The points are generated on the fly in Gray code order, zero generators are skipped. The points contain
+	 * the vertices but also internal points.
+	 * @return A range of points.
+	 */
+	ZonotopeVertexRange<Number> vertexRange() const { return ZonotopeVertexRange<Number>( mCenter, mGenerators ); }
+
+	/**
+	 * @brief Returns a range which enumerates the candidate vertices of the projection of the zonotopeT onto the passed
+	 * dimensions lazily.
+	 * @details Generators which vanish in the projection are skipped.
+	 * @param dimensions The dimensions to project on.
+	 * @return A range of points of dimension dimensions.size().
+	 */
+	ZonotopeVertexRange<Number> vertexRange( const std::vector<unsigned>& dimensions ) const {
+		return ZonotopeVertexRange<Number>( mCenter, mGenerators, dimensions );
+	}
+
 	ZonotopeT<Number,Converter> intersectHalfspace( const Halfspace<Number>& rhs ) const;
+	/**
+	 * @brief Intersects with all halfspaces given by the rows of mat and vec.
+	 * @details All row supports are computed at once in closed form, such that an empty intersection is detected before
+	 * any generator is modified and only halfspaces which cut the zonotope are intersected.
+	 */
 	ZonotopeT<Number,Converter> intersectHalfspaces( const matrix_t<Number>& mat, const vector_t<Number>& vec ) const;
 
 	std::pair<bool,ZonotopeT<Number,Converter>> satisfiesHalfspace( const Halfspace<Number>& rhs ) const;
@@ -430,61 +430,26 @@ std::vector<vector_t<Number>> ZonotopeT<Number,Converter>::computeZonotopeBounda
 	assert( mDimension == 2 && "Computing Zonotope boundaries only possible for Dim 2" );
 
 	this->removeEmptyGenerators();
-	matrix_t<Number> generators = this->mGenerators;
-
-	unsigned i;
-	std::vector<vector_t<Number>> sortArray, verticesArray;
-
-	// Reflect generators if y-value is negative
-	Eigen::Matrix<Number, 1, Eigen::Dynamic> yValsRow = generators.row( 1 );
-
-	for ( i = 0; i < yValsRow.cols(); i++ ) {
-		if ( yValsRow( i ) < 0 ) {
-			generators.col( i ) = -1 * generators.col( i );
-		}
-	}
-
-	// Sort generators
-
-	for ( i = 0; i < generators.cols(); i++ ) {
-		sortArray.push_back( generators.col( i ) );
-	}
 
-	std::sort( sortArray.begin(), sortArray.end(), ZUtility::compareColumnVectors<Number> );
-
-	vector_t<Number> pm = mCenter - generators.rowwise().sum();
-
-	verticesArray.push_back( pm );
-
-	// Finding vertices of Zonotope
-	for ( i = 0; i < sortArray.size(); i++ ) {
-		verticesArray.push_back( verticesArray.back() + 2 * sortArray[i] );
-	}
-	for ( i = 0; i < sortArray.size(); i++ ) {
-		verticesArray.push_back( verticesArray.back() - 2 * sortArray[i] );
+	// the boundary is returned as a closed polygon in clockwise order starting at the lowest vertex, i.e. the first
+	// vertex is repeated at the end.
+	ZonotopeEnumeration<Number> enumeration( mCenter, mGenerators );
+	enumeration.enumerateVertices();
+	std::vector<vector_t<Number>> verticesArray;
+	for ( const auto& vertex : enumeration.getVertices() ) {
+		verticesArray.push_back( vertex.rawCoordinates() );
 	}
+	std::reverse( verticesArray.begin() + 1, verticesArray.end() );
+	verticesArray.push_back( verticesArray.front() );
 
 	return verticesArray;
 }
 
 template<typename Number, typename Converter>
 std::vector<Point<Number>> ZonotopeT<Number,Converter>::vertices( const Location<Number>* ) const {
-	//uniteEqualVectors();
-
-	//removeEmptyGenerators();
-
-	//vector_t<Number> init = vector_t<Number>::Zero( this->dimension() );
-
-    vector_t<Number> init = mCenter;
-
-	std::vector<vector_t<Number>> possibleCorners = ZUtility::getCornersRecursive( mGenerators, init );
-	std::vector<Point<Number>> res;
-
-	for(const auto& coord : possibleCorners){
-		res.emplace_back(coord);
-	}
-
-	return res;
+	ZonotopeEnumeration<Number> enumeration( mCenter, mGenerators );
+	enumeration.enumerateVertices();
+	return enumeration.getVertices();
 }
 
 template<typename Number, typename Converter>
@@ -931,11 +896,40 @@ ZonotopeT<Number,Converter> ZonotopeT<Number,Converter>::intersectHalfspace( con
 	return result;
 }
 
+template<typename Number, typename Converter>
+int ZonotopeT<Number,Converter>::classifyHalfspaces( const matrix_t<Number>& mat, const vector_t<Number>& vec, std::vector<unsigned>& cuttingRows ) const {
+	assert(mat.rows() == vec.rows());
+	cuttingRows.clear();
+	std::pair<vector_t<Number>,vector_t<Number>> bounds = ZUtility::rowBounds( mCenter, mGenerators, mat );
+	for(unsigned rowIndex = 0; rowIndex < mat.rows(); ++rowIndex) {
+		if(bounds.first(rowIndex) > vec(rowIndex)) {
+			return -1;
+		}
+		if(bounds.second(rowIndex) > vec(rowIndex)) {
+			cuttingRows.push_back(rowIndex);
+		}
+	}
+	return cuttingRows.empty() ? 1 : 0;
+}
+
 template<typename Number, typename Converter>
 ZonotopeT<Number,Converter> ZonotopeT<Number,Converter>::intersectHalfspaces( const matrix_t<Number>& mat, const vector_t<Number>& vec ) const {
 	if(this->empty()) {
 		return *this;
 	}
+	std::vector<unsigned> cuttingRows;
+	switch( classifyHalfspaces( mat, vec, cuttingRows ) ) {
+		case -1:
+			return ZonotopeT<Number,Converter>();
+		case 1:
+			return *this;
+		default:
+			return intersectCuttingHalfspaces( ZUtility::selectRows( mat, cuttingRows ), ZUtility::selectRows( vec, cuttingRows ) );
+	}
+}
+
+template<typename Number, typename Converter>
+ZonotopeT<Number,Converter> ZonotopeT<Number,Converter>::intersectCuttingHalfspaces( const matrix_t<Number>& mat, const vector_t<Number>& vec ) const {
 	assert(mat.rows() == vec.rows());
 	ZonotopeT<Number,Converter> res = *this;
 
@@ -1026,21 +1020,18 @@ std::pair<bool,ZonotopeT<Number,Converter>> ZonotopeT<Number,Converter>::satisfi
 	if(this->empty()) {
 		return std::make_pair(false,*this);
 	}
-	assert(mat.rows() == vec.rows());
-	std::pair<bool, ZonotopeT<Number,Converter>> resultPair = std::make_pair(true, *this);
-
-	resultPair.second = resultPair.second.intersectHalfspaces(mat, vec);
-	resultPair.first = !resultPair.second.empty();
-
-	/*
-	for(unsigned constraintIndex = 0; constraintIndex < mat.rows(); ++constraintIndex) {
-		resultPair = resultPair.second.satisfiesHalfspace(Halfspace<Number>(vector_t<Number>(mat.row(constraintIndex)), vec(constraintIndex)));
-		if(resultPair.first == false) {
-			return resultPair;
+	// decide emptiness and containment for all rows at once, only cutting rows require an intersection.
+	std::vector<unsigned> cuttingRows;
+	switch( classifyHalfspaces( mat, vec, cuttingRows ) ) {
+		case -1:
+			return std::make_pair(false, ZonotopeT<Number,Converter>());
+		case 1:
+			return std::make_pair(true, *this);
+		default: {
+			ZonotopeT<Number,Converter> res = intersectCuttingHalfspaces( ZUtility::selectRows( mat, cuttingRows ), ZUtility::selectRows( vec, cuttingRows ) );
+			return std::make_pair(!res.empty(), res);
 		}
 	}
-	*/
-	return resultPair;
 }
 
 #ifdef HYPRO_USE_PPL
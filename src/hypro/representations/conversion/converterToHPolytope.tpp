@@ -116,6 +116,12 @@ typename Converter<Number>::HPolytope Converter<Number>::toHPolytope( const Box&
 //conversion from zonotope to H-Polytope (no differentiation between conversion modes - always EXACT)
 template<typename Number>
 typename Converter<Number>::HPolytope Converter<Number>::toHPolytope( const Zonotope& _source, const CONV_MODE mode ){
+    //full-dimensional zonotopes: the facets are spanned by subsets of the generators
+    ZonotopeEnumeration<Number> enumeration(_source.center(), _source.generators());
+    if(enumeration.isFullDimensional()){
+        enumeration.enumerateFacets();
+        return HPolytope(enumeration.getHsv());
+    }
     //computes vertices from source object
     typename std::vector<Point<Number>> vertices = _source.vertices();
     if(vertices.empty()){
@@ -153,7 +159,7 @@ typename Converter<Number>::HPolytope Converter<Number>::toHPolytope( const Supp
 	    }
 
 	    //lets the support function evaluate the offset of the halfspaces for each direction
-	    std::vector<EvaluationResult<Number>> offsets = _source.multiEvaluate(templateDirectionMatrix, false);
+	    std::vector<EvaluationResult<Number>> offsets = _source.multiEvaluate(templateDirectionMatrix, false, false);
 	    assert(offsets.size() == std::size_t(templateDirectionMatrix.rows()));
 
 	    std::vector<std::size_t> boundedConstraints;
@@ -216,7 +222,7 @@ typename Converter<Number>::HPolytope Converter<Number>::toHPolytope( const Supp
 		}
 		//std::cout << __func__ << ": TemplateDirectionMatrix: " << std::endl << templateDirectionMatrix << std::endl;
 
-		std::vector<EvaluationResult<Number>> offsets = _source.multiEvaluate(templateDirectionMatrix, false);
+		std::vector<EvaluationResult<Number>> offsets = _source.multiEvaluate(templateDirectionMatrix, false, false);
 		assert(offsets.size() == unsigned(templateDirectionMatrix.rows()));
 
 		//std::cout << "Multi-Eval done, reduce to relevant dimensions" << std::endl;
@@ -22,21 +22,8 @@ typename Converter<Number>::SupportFunction Converter<Number>::toSupportFunction
     unsigned dim = _source.dimension();                                                     //gets dimension of box
     assert( dim >= 1);                                                                      //only continue if dimension is at least 1
 
-    matrix_t<Number> directions = matrix_t<Number>::Zero( 2 * dim, dim );                   //initialize normal matrix as zero matrix with 2*dim rows and dim columns
-    for ( unsigned i = 0; i < dim; ++i ) {                                                  //for every dimension:
-        directions( 2 * i, i ) = -1;
-        directions( 2 * i + 1, i ) = 1;                                                     //write fixed entries (because of box) into the normal matrix (2 each column)
-    }
-
-    vector_t<Number> distances = vector_t<Number>( 2 * dim );                               //initialize distance vector with 2*dim rows
-
-    std::vector<carl::Interval<Number>> intervals = _source.boundaries();                   //gets intervals of box
-    for ( unsigned i = 0; i < dim; ++i ) {                                                  //for every dimension:
-        distances( 2 * i ) = -intervals[i].lower();
-        distances( 2 * i + 1 ) = intervals[i].upper();                                      //write inverted lower bound values and upper bound values into the distance vector
-    }
-
-    return SupportFunction( directions, distances);
+    // boxes are kept as closed-form leaves, their evaluation does not require linear programming.
+    return SupportFunction( SF_TYPE::BOX, vector_t<Number>(_source.limits().first.rawCoordinates()), vector_t<Number>(_source.limits().second.rawCoordinates()) );
 }
 
 template <typename Number>
@@ -62,12 +49,10 @@ typename Converter<Number>::SupportFunction Converter<Number>::toSupportFunction
 // conversion from Zonotope to support function (no differentiation between conversion modes - always EXACT)
 template <typename Number>
 typename Converter<Number>::SupportFunction Converter<Number>::toSupportFunction( const Zonotope& _source, const CONV_MODE ) {
-    typename std::vector<Point<Number>> vertices = _source.vertices();           //computes the vertices from the source zonotope
-    if(vertices.empty()){
+    if(_source.dimension() == 0){
     	return SupportFunctionT<Number,Converter>();
     }
 
-    HPolytope temp = HPolytope(vertices);
-
-    return SupportFunction( temp.constraints() );
+    // zonotopes are kept as closed-form leaves, their evaluation does not require linear programming.
+    return SupportFunction( SF_TYPE::ZONOTOPE, _source.center(), _source.generators() );
 }
@@ -99,7 +99,7 @@ typename Converter<Number>::VPolytope Converter<Number>::toVPolytope( const Supp
 		}
 
                 //lets the support function evaluate the offset of the halfspaces for each direction
-                std::vector<EvaluationResult<Number>> offsets = _source.multiEvaluate(templateDirectionMatrix);
+                std::vector<EvaluationResult<Number>> offsets = _source.multiEvaluate(templateDirectionMatrix, true, false);
                 assert(offsets.size() == std::size_t(templateDirectionMatrix.rows()));
                 std::vector<std::size_t> boundedConstraints;
                 for(unsigned offsetIndex = 0; offsetIndex < offsets.size(); ++offsetIndex){
@@ -0,0 +1,237 @@
+/**
+ * Ranges which enumerate the vertices of boxes and zonotopes lazily.
+ * @file   VertexRange.h
+ */
+
+#pragma once
+
+#include "../datastructures/Point.h"
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Forward iterator over the vertices of a range whose vertices are indexed by sign vectors.
+ * @details    The sign vectors are traversed in Gray code order, such that two consecutive vertices differ in exactly one
+ * sign. The iterator holds the current vertex and lets the range update it in place, thus advancing does not allocate.
+ * @tparam     Range   The range, which provides first() and flip(point, index, positive).
+ * @tparam     Number  The used number type.
+ */
+template <typename Range, typename Number>
+class GrayCodeVertexIterator {
+  public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = Point<Number>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Point<Number>*;
+	using reference = const Point<Number>&;
+
+  private:
+	const Range* mRange;
+	std::uint64_t mStep;
+	Point<Number> mCurrent;
+
+  public:
+	GrayCodeVertexIterator( const Range* range, std::uint64_t step ) : mRange( range ), mStep( step ), mCurrent() {
+		if ( mStep < mRange->size() ) {
+			assert( mStep == 0 );
+			mCurrent = mRange->first();
+		}
+	}
+
+	reference operator*() const { return mCurrent; }
+	pointer operator->() const { return &mCurrent; }
+
+	GrayCodeVertexIterator& operator++() {
+		++mStep;
+		if ( mStep < mRange->size() ) {
+			// the Gray codes of step-1 and step differ in the lowest set bit of step.
+			unsigned index = 0;
+			while ( ( ( mStep >> index ) & 1 ) == 0 ) {
+				++index;
+			}
+			bool positive = ( ( ( mStep ^ ( mStep >> 1 ) ) >> index ) & 1 ) == 1;
+			mRange->flip( mCurrent, index, positive );
+		}
+		return *this;
+	}
+
+	GrayCodeVertexIterator operator++( int ) {
+		GrayCodeVertexIterator tmp = *this;
+		++( *this );
+		return tmp;
+	}
+
+	friend bool operator==( const GrayCodeVertexIterator& lhs, const GrayCodeVertexIterator& rhs ) {
+		return lhs.mRange == rhs.mRange && lhs.mStep == rhs.mStep;
+	}
+	friend bool operator!=( const GrayCodeVertexIterator& lhs, const GrayCodeVertexIterator& rhs ) { return !( lhs == rhs ); }
+};
+
+/**
+ * @brief      Range over the vertices of a box, optionally projected onto a subset of its dimensions.
+ * @details    Only dimensions whose bounds differ are enumerated, thus each vertex is visited exactly once. Projected
+ * vertices live in the space of the selected dimensions, i.e. a box with d dimensions projected onto k dimensions yields
+ * at most 2^k vertices.
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class BoxVertexRange {
+  public:
+	using iterator = GrayCodeVertexIterator<BoxVertexRange<Number>, Number>;
+	using const_iterator = iterator;
+	friend iterator;
+
+  private:
+	vector_t<Number> mLower;
+	vector_t<Number> mUpper;
+	std::vector<unsigned> mFree;  // dimensions with a non-degenerate interval
+
+  public:
+	/**
+	 * @brief      Constructor from the minimal and the maximal point of a box.
+	 */
+	BoxVertexRange( const Point<Number>& lower, const Point<Number>& upper )
+		: mLower( lower.rawCoordinates() ), mUpper( upper.rawCoordinates() ), mFree() {
+		initialize();
+	}
+
+	/**
+	 * @brief      Constructor from the minimal and the maximal point of a box, which is projected onto the passed dimensions.
+	 */
+	BoxVertexRange( const Point<Number>& lower, const Point<Number>& upper, const std::vector<unsigned>& dimensions )
+		: mLower( dimensions.size() ), mUpper( dimensions.size() ), mFree() {
+		for ( unsigned pos = 0; pos < dimensions.size(); ++pos ) {
+			assert( dimensions[pos] < lower.dimension() );
+			mLower( pos ) = lower.at( dimensions[pos] );
+			mUpper( pos ) = upper.at( dimensions[pos] );
+		}
+		initialize();
+	}
+
+	/**
+	 * @brief      Returns the number of vertices.
+	 */
+	std::uint64_t size() const { return std::uint64_t( 1 ) << mFree.size(); }
+
+	iterator begin() const { return iterator( this, 0 ); }
+	iterator end() const { return iterator( this, size() ); }
+
+	/**
+	 * @brief      Collects all vertices.
+	 */
+	std::vector<Point<Number>> collect() const {
+		std::vector<Point<Number>> result;
+		result.reserve( size() );
+		for ( const auto& vertex : *this ) {
+			result.emplace_back( vertex );
+		}
+		return result;
+	}
+
+  private:
+	void initialize() {
+		for ( unsigned d = 0; d < mLower.rows(); ++d ) {
+			if ( mLower( d ) != mUpper( d ) ) {
+				mFree.push_back( d );
+			}
+		}
+		assert( mFree.size() < 64 );
+	}
+
+	Point<Number> first() const { return Point<Number>( mLower ); }
+
+	void flip( Point<Number>& vertex, unsigned index, bool positive ) const {
+		std::size_t d = mFree[index];
+		vertex[d] = positive ? mUpper( d ) : mLower( d );
+	}
+};
+
+/**
+ * @brief      Range over the points center + sum_i s_i * g_i, s_i in {-1,1}, of a zonotope, optionally projected onto a
+ * subset of its dimensions.
+ * @details    The points contain all vertices of the zonotope. Generators which are zero (after projection) are dropped,
+ * each step adds or subtracts one doubled generator. For floating point numbers the incremental updates accumulate
+ * rounding errors.
+ * @tparam     Number  The used number type.
+ */
+template <typename Number>
+class ZonotopeVertexRange {
+  public:
+	using iterator = GrayCodeVertexIterator<ZonotopeVertexRange<Number>, Number>;
+	using const_iterator = iterator;
+	friend iterator;
+
+  private:
+	vector_t<Number> mFirst;
+	std::vector<vector_t<Number>> mSteps;  // doubled generators
+
+  public:
+	/**
+	 * @brief      Constructor from the center and the generators of a zonotope.
+	 */
+	ZonotopeVertexRange( const vector_t<Number>& center, const matrix_t<Number>& generators ) : mFirst( center ), mSteps() {
+		initialize( generators );
+	}
+
+	/**
+	 * @brief      Constructor from the center and the generators of a zonotope, which is projected onto the passed
+	 * dimensions.
+	 */
+	ZonotopeVertexRange( const vector_t<Number>& center, const matrix_t<Number>& generators, const std::vector<unsigned>& dimensions )
+		: mFirst( dimensions.size() ), mSteps() {
+		matrix_t<Number> projected = matrix_t<Number>( dimensions.size(), generators.cols() );
+		for ( unsigned pos = 0; pos < dimensions.size(); ++pos ) {
+			assert( dimensions[pos] < center.rows() );
+			mFirst( pos ) = center( dimensions[pos] );
+			projected.row( pos ) = generators.row( dimensions[pos] );
+		}
+		initialize( projected );
+	}
+
+	/**
+	 * @brief      Returns the number of enumerated points.
+	 */
+	std::uint64_t size() const { return mFirst.rows() == 0 ? 0 : std::uint64_t( 1 ) << mSteps.size(); }
+
+	iterator begin() const { return iterator( this, 0 ); }
+	iterator end() const { return iterator( this, size() ); }
+
+	/**
+	 * @brief      Collects all enumerated points.
+	 */
+	std::vector<Point<Number>> collect() const {
+		std::vector<Point<Number>> result;
+		result.reserve( size() );
+		for ( const auto& vertex : *this ) {
+			result.emplace_back( vertex );
+		}
+		return result;
+	}
+
+  private:
+	void initialize( const matrix_t<Number>& generators ) {
+		for ( unsigned col = 0; col < generators.cols(); ++col ) {
+			if ( generators.col( col ) == vector_t<Number>::Zero( generators.rows() ) ) {
+				continue;
+			}
+			mFirst -= generators.col( col );
+			mSteps.emplace_back( Number( 2 ) * generators.col( col ) );
+		}
+		assert( mSteps.size() < 64 );
+	}
+
+	Point<Number> first() const { return Point<Number>( mFirst ); }
+
+	void flip( Point<Number>& vertex, unsigned index, bool positive ) const {
+		if ( positive ) {
+			vertex += mSteps[index];
+		} else {
+			vertex -= mSteps[index];
+		}
+	}
+};
+
+}  // namespace hypro
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "ScopedLock.h"
+#include <carl/util/Singleton.h>
+#include <cassert>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace hypro {
+
+/**
+ * @brief      Class for a fixed-size pool of worker threads processing enqueued tasks in FIFO order.
+ * @details    The pool is implemented using carl::Singleton and is created lazily with one worker per hardware thread.
+ * Tasks which are enqueued from a worker thread should not block on the results of other tasks of the same pool,
+ * use isWorkerThread() to fall back to sequential processing in this case.
+ */
+class ThreadPool : public carl::Singleton<ThreadPool> {
+	friend carl::Singleton<ThreadPool>;
+
+  private:
+	std::vector<std::thread> mWorkers;
+	std::queue<std::function<void()>> mTasks;
+	std::mutex mQueueMutex;
+	std::condition_variable mCondition;
+	bool mStop;
+
+  protected:
+	ThreadPool() : ThreadPool( std::thread::hardware_concurrency() ) {}
+
+	explicit ThreadPool( std::size_t threads ) : mStop( false ) {
+		threads = threads == 0 ? 1 : threads;
+		for ( std::size_t i = 0; i < threads; ++i ) {
+			mWorkers.emplace_back( [this] { this->work(); } );
+		}
+	}
+
+  public:
+	~ThreadPool() {
+		{
+			ScopedLock<std::mutex> lock( mQueueMutex );
+			mStop = true;
+		}
+		mCondition.notify_all();
+		for ( auto& worker : mWorkers ) {
+			worker.join();
+		}
+	}
+
+	/**
+	 * @brief      Returns the number of worker threads.
+	 */
+	std::size_t size() const { return mWorkers.size(); }
+
+	/**
+	 * @brief      Enqueues a task.
+	 * @param[in]  f     The callable.
+	 * @param[in]  args  The arguments passed to the callable.
+	 * @return     A future holding the result of the task.
+	 */
+	template <typename F, typename... Args>
+	auto enqueue( F&& f, Args&&... args ) -> std::future<typename std::result_of<F( Args... )>::type> {
+		using ReturnType = typename std::result_of<F( Args... )>::type;
+
+		auto task = std::make_shared<std::packaged_task<ReturnType()>>( std::bind( std::forward<F>( f ), std::forward<Args>( args )... ) );
+		std::future<ReturnType> res = task->get_future();
+		{
+			ScopedLock<std::mutex> lock( mQueueMutex );
+			assert( !mStop );
+			mTasks.emplace( [task]() { ( *task )(); } );
+		}
+		mCondition.notify_one();
+		return res;
+	}
+
+	/**
+	 * @brief      Determines if the calling thread is a worker thread of the pool.
+	 */
+	static bool isWorkerThread() { return workerFlag(); }
+
+  private:
+	static bool& workerFlag() {
+		static thread_local bool isWorker = false;
+		return isWorker;
+	}
+
+	void work() {
+		workerFlag() = true;
+		while ( true ) {
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock( mQueueMutex );
+				mCondition.wait( lock, [this] { return mStop || !mTasks.empty(); } );
+				if ( mStop && mTasks.empty() ) {
+					return;
+				}
+				task = std::move( mTasks.front() );
+				mTasks.pop();
+			}
+			task();
+		}
+	}
+};
+
+}  // namespace hypro
@@ -8,6 +8,7 @@
 #include "../../hypro/representations/Box/Box.h"
 #include "../../hypro/datastructures/Point.h"
 #include "../../hypro/datastructures/hybridAutomata/LocationManager.h"
+#include "../../hypro/datastructures/hybridAutomata/TransitionManager.h"
 #include "../../hypro/algorithms/reachability/Reach.h"
 
 template<typename Number>
@@ -127,7 +128,7 @@ protected:
 	hypro::LocationManager<Number>& locManag = hypro::LocationManager<Number>::getInstance();
 	hypro::Location<Number>* loc1 = locManag.create();
 	hypro::Location<Number>* loc2 = locManag.create();
-	hypro::Transition<Number>* trans = new hypro::Transition<Number>();
+	hypro::Transition<Number>* trans = hypro::TransitionManager<Number>::getInstance().create();
 
 
 
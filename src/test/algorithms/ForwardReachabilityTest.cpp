@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 #include "../defines.h"
 #include "../../hypro/datastructures/hybridAutomata/LocationManager.h"
+#include "../../hypro/datastructures/hybridAutomata/TransitionManager.h"
 #include "../../hypro/datastructures/hybridAutomata/Transition.h"
 #include "../../hypro/datastructures/hybridAutomata/HybridAutomaton.h"
 #include "../../hypro/representations/GeometricObject.h"
@@ -143,7 +144,7 @@ protected:
 
 	Location<mpq_class>* loc1 = locManag.create();
 	Location<mpq_class>* loc2 = locManag.create();
-	hypro::Transition<mpq_class>* trans = new hypro::Transition<mpq_class>();
+	hypro::Transition<mpq_class>* trans = hypro::TransitionManager<mpq_class>::getInstance().create();
 	HybridAutomaton<mpq_class> hybrid = HybridAutomaton<mpq_class>();
 
 	//Other Objects: Vectors, Matrices, Guards...
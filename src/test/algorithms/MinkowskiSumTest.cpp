@@ -312,11 +312,12 @@ TEST_F(MinkowskiSumTest, computeInitVertexTest)
     poly2.print();
 #endif
 
-	Point<double> res = poly.computeInitVertex(poly2);
+	polytope::Decomposition<double> decomposition;
+	Point<double> res = poly.computeInitVertex(poly2, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Point v*: " << res << std::endl;
 
-    std::cout << "v* composed of: " << res.composedOf() << std::endl;
+    std::cout << "v* composed of: " << decomposition.at(res) << std::endl;
 #endif
 
 	Polytope<double> result;
@@ -395,7 +396,8 @@ TEST_F(MinkowskiSumTest, computeEdgeTest)
  */
 TEST_F(MinkowskiSumTest, adjOracleTest)
 {
-	Point<double> res = polyAdj.computeInitVertex(polyAdj2);
+	polytope::Decomposition<double> decomposition;
+	Point<double> res = polyAdj.computeInitVertex(polyAdj2, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Point v*: " << res << std::endl;
 #endif
@@ -405,7 +407,7 @@ TEST_F(MinkowskiSumTest, adjOracleTest)
 	counter.first = 1;
 	counter.second = 1;
 
-	bool exists = polytope::adjOracle(adjPoint, res, counter);
+	bool exists = polytope::adjOracle(adjPoint, res, counter, decomposition);
 	ASSERT_TRUE(exists);
 #ifdef fukuda_DEBUG
 	std::cout << "AdjOracle return value: " << exists << std::endl;
@@ -418,13 +420,14 @@ TEST_F(MinkowskiSumTest, adjOracleTest)
  */
 TEST_F(MinkowskiSumTest, computeMaximizerVectorTest)
 {
-	Point<double> v = polyAdj.computeInitVertex(polyAdj2);
+	polytope::Decomposition<double> decomposition;
+	Point<double> v = polyAdj.computeInitVertex(polyAdj2, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Point v*: " << v << std::endl;
 #endif
 
 	Point<double> target;
-	vector_t<double> result = polytope::computeMaximizerVector(target, v);
+	vector_t<double> result = polytope::computeMaximizerVector(target, v, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Vector: " << std::endl;
 	std::cout << result << std::endl;
@@ -452,9 +455,10 @@ TEST_F(MinkowskiSumTest, computeNormalConeVectorTest)
 	edgeSet.push_back(result);
 
 	//for the maximizer vector we need v=v1+v2
-	Point<double> v = polyAdj.computeInitVertex(polyAdj2);
+	polytope::Decomposition<double> decomposition;
+	Point<double> v = polyAdj.computeInitVertex(polyAdj2, decomposition);
 	Point<double> target;
-	vector_t<double> maximizer = polytope::computeMaximizerVector(target, v);
+	vector_t<double> maximizer = polytope::computeMaximizerVector(target, v, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Maximizer Vector: " << std::endl;
 	std::cout << maximizer << std::endl;
@@ -475,7 +479,8 @@ TEST_F(MinkowskiSumTest, localSearchTest)
 {
 	Polytope<double> sumPoly = Parma_Polyhedra_Library::C_Polyhedron(0,EMPTY);
 
-	Point<double> initVertex = polyAdj.computeInitVertex(polyAdj2);
+	polytope::Decomposition<double> decomposition;
+	Point<double> initVertex = polyAdj.computeInitVertex(polyAdj2, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Point v*: " << initVertex << std::endl;
 	std::cout << "-------------------------" << std::endl;
@@ -488,11 +493,11 @@ TEST_F(MinkowskiSumTest, localSearchTest)
 	counter.first = 1;
 	counter.second = 1;
 
-	bool exists = polytope::adjOracle(adjPoint, initVertex, counter);
+	bool exists = polytope::adjOracle(adjPoint, initVertex, counter, decomposition);
 	ASSERT_TRUE(exists);
 
 	Point<double> sinkMaximizerTarget;
-	vector_t<double> sinkMaximizerVector = polytope::computeMaximizerVector(sinkMaximizerTarget, initVertex);
+	vector_t<double> sinkMaximizerVector = polytope::computeMaximizerVector(sinkMaximizerTarget, initVertex, decomposition);
 
 #ifdef fukuda_DEBUG
     std::cout<< "sinkMaximizerVector: " << sinkMaximizerVector << std::endl;
@@ -500,14 +505,14 @@ TEST_F(MinkowskiSumTest, localSearchTest)
 	std::cout << "-------------------------" << std::endl;
 #endif
 
-	polytope::Cone<double>* cone = polytope::computeCone(initVertex, sinkMaximizerVector);
+	polytope::Cone<double>* cone = polytope::computeCone(initVertex, sinkMaximizerVector, decomposition);
 	sumPoly.rFan().add(cone);
 
 #ifdef fukuda_DEBUG
 	std::cout << "Sink Cone added to Fan." << std::endl;
 #endif
 
-	Point<double> f = sumPoly.localSearch(adjPoint, sinkMaximizerTarget);
+	Point<double> f = sumPoly.localSearch(adjPoint, sinkMaximizerTarget, decomposition);
 }
 
 /**
@@ -525,7 +530,8 @@ TEST_F(MinkowskiSumTest, localSearchTest3D)
 
 	Polytope<double> sumPoly = Parma_Polyhedra_Library::C_Polyhedron(0,EMPTY);
 
-	Point<double> initVertex = polyQ.computeInitVertex(polyP);
+	polytope::Decomposition<double> decomposition;
+	Point<double> initVertex = polyQ.computeInitVertex(polyP, decomposition);
 #ifdef fukuda_DEBUG
 	std::cout << "Point v*: " << initVertex << std::endl;
 	std::cout << "-------------------------" << std::endl;
@@ -538,11 +544,11 @@ TEST_F(MinkowskiSumTest, localSearchTest3D)
 	counter.first = 1;
 	counter.second = 1;
 
-	bool exists = polytope::adjOracle(adjPoint, initVertex, counter);
+	bool exists = polytope::adjOracle(adjPoint, initVertex, counter, decomposition);
 	ASSERT_TRUE(exists);
 
 	Point<double> sinkMaximizerTarget;
-	vector_t<double> sinkMaximizerVector = polytope::computeMaximizerVector(sinkMaximizerTarget, initVertex);
+	vector_t<double> sinkMaximizerVector = polytope::computeMaximizerVector(sinkMaximizerTarget, initVertex, decomposition);
 
 #ifdef fukuda_DEBUG
     std::cout<< "sinkMaximizerVector: " << sinkMaximizerVector << std::endl;
@@ -550,14 +556,14 @@ TEST_F(MinkowskiSumTest, localSearchTest3D)
 	std::cout << "-------------------------" << std::endl;
 #endif
 
-	polytope::Cone<double>* cone = polytope::computeCone(initVertex, sinkMaximizerVector);
+	polytope::Cone<double>* cone = polytope::computeCone(initVertex, sinkMaximizerVector, decomposition);
 	sumPoly.rFan().add(cone);
 
 #ifdef fukuda_DEBUG
 	std::cout << "Sink Cone added to Fan." << std::endl;
 #endif
 
-	Point<double> f = sumPoly.localSearch(adjPoint, sinkMaximizerTarget);
+	Point<double> f = sumPoly.localSearch(adjPoint, sinkMaximizerTarget, decomposition);
 
 }
 
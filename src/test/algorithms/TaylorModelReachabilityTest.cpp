@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+#include "algorithms/reachability/ReachTaylorModel.h"
+#include "datastructures/hybridAutomata/LocationManager.h"
+
+TEST(TaylorModelReachabilityTest, AffineFlow)
+{
+	using namespace hypro;
+	// x' = 1, x in [0,1] initially, x <= 10 as invariant.
+	Location<double>* loc = LocationManager<double>::getInstance().create();
+	matrix_t<double> flow = matrix_t<double>::Zero(2,2);
+	flow(0,1) = 1;
+	loc->setFlow(flow);
+	matrix_t<double> invariantMat = matrix_t<double>(1,1);
+	vector_t<double> invariantVec = vector_t<double>(1);
+	invariantMat << 1;
+	invariantVec << 10;
+	loc->setInvariant(invariantMat, invariantVec);
+
+	matrix_t<double> initialMat = matrix_t<double>(2,1);
+	vector_t<double> initialVec = vector_t<double>(2);
+	initialMat << 1, -1;
+	initialVec << 1, 0;
+	HybridAutomaton<double> automaton;
+	automaton.addLocation(loc);
+	automaton.addInitialState(RawState<double>(loc, std::make_pair(initialMat, initialVec)));
+
+	reachability::ReachabilitySettings<double> settings;
+	settings.timeBound = 1;
+	settings.timeStep = 0.1;
+	settings.jumpDepth = 0;
+
+	reachability::ReachTaylorModel<double> reacher(automaton, settings);
+	std::vector<std::pair<unsigned, reachability::flowpipe_t<Box<double>>>> flowpipes = reacher.computeForwardReachability();
+	EXPECT_FALSE(reacher.reachedBadStates());
+	ASSERT_EQ(std::size_t(1), flowpipes.size());
+	ASSERT_TRUE(flowpipes.front().second.size() > 1);
+
+	// the last segment reaches x = 2, no segment exceeds the reachable interval [0,2] by more than the remainder.
+	carl::Interval<double> last = flowpipes.front().second.back().interval(0);
+	EXPECT_TRUE(last.contains(2));
+	for(const auto& segment : flowpipes.front().second) {
+		EXPECT_LE(-0.1, segment.interval(0).lower());
+		EXPECT_GE(2.1, segment.interval(0).upper());
+	}
+}
+
+TEST(TaylorModelReachabilityTest, PolynomialFlow)
+{
+	using namespace hypro;
+	// x' = -x^2, x in [1,1.1] initially, the solution x0/(1+x0*t) lies in [0.5,0.524] at t = 1.
+	Location<double>* loc = LocationManager<double>::getInstance().create();
+	loc->setFlow(matrix_t<double>::Zero(2,2));
+	matrix_t<double> invariantMat = matrix_t<double>(1,1);
+	vector_t<double> invariantVec = vector_t<double>(1);
+	invariantMat << 1;
+	invariantVec << 10;
+	loc->setInvariant(invariantMat, invariantVec);
+
+	matrix_t<double> initialMat = matrix_t<double>(2,1);
+	vector_t<double> initialVec = vector_t<double>(2);
+	initialMat << 1, -1;
+	initialVec << 1.1, -1;
+	HybridAutomaton<double> automaton;
+	automaton.addLocation(loc);
+	automaton.addInitialState(RawState<double>(loc, std::make_pair(initialMat, initialVec)));
+
+	reachability::ReachabilitySettings<double> settings;
+	settings.timeBound = 1;
+	settings.timeStep = 0.1;
+	settings.jumpDepth = 0;
+
+	reachability::ReachTaylorModel<double> reacher(automaton, settings);
+	carl::Variable x = VariablePool::getInstance().carlVarByIndex(0);
+	PolynomialODE<double> ode;
+	ode.assign(x, MultivariatePolynomial<carl::Interval<double>>(Term<carl::Interval<double>>(carl::Interval<double>(-1), x, 2)));
+	reacher.setPolynomialFlow(loc, ode);
+
+	std::vector<std::pair<unsigned, reachability::flowpipe_t<Box<double>>>> flowpipes = reacher.computeForwardReachability();
+	ASSERT_EQ(std::size_t(1), flowpipes.size());
+	carl::Interval<double> last = flowpipes.front().second.back().interval(0);
+	EXPECT_LE(last.lower(), 0.5);
+	EXPECT_GE(last.upper(), 0.5238);
+	EXPECT_LE(0.45, last.lower());
+	EXPECT_GE(0.6, last.upper());
+}
+
+TEST(TaylorModelReachabilityTest, DispatchedFromReach)
+{
+	using namespace hypro;
+	// x' = -x^2 as polynomial flow of the location, Reach hands the automaton to the Taylor model engine.
+	Location<double>* loc = LocationManager<double>::getInstance().create();
+	loc->setFlow(matrix_t<double>::Zero(2,2));
+	Location<double>::polynomial rhs;
+	rhs[std::vector<unsigned>({0,0})] = -1;
+	loc->setPolynomialFlow(std::vector<Location<double>::polynomial>({rhs}));
+	matrix_t<double> invariantMat = matrix_t<double>(1,1);
+	vector_t<double> invariantVec = vector_t<double>(1);
+	invariantMat << 1;
+	invariantVec << 10;
+	loc->setInvariant(invariantMat, invariantVec);
+
+	matrix_t<double> initialMat = matrix_t<double>(2,1);
+	vector_t<double> initialVec = vector_t<double>(2);
+	initialMat << 1, -1;
+	initialVec << 1.1, -1;
+	HybridAutomaton<double> automaton;
+	automaton.addLocation(loc);
+	automaton.addInitialState(RawState<double>(loc, std::make_pair(initialMat, initialVec)));
+
+	reachability::ReachabilitySettings<double> settings;
+	settings.timeBound = 1;
+	settings.timeStep = 0.1;
+	settings.jumpDepth = 0;
+
+	reachability::Reach<double, Box<double>> reacher(automaton, settings);
+	std::vector<std::pair<unsigned, reachability::flowpipe_t<Box<double>>>> flowpipes = reacher.computeForwardReachability();
+	EXPECT_FALSE(reacher.reachedBadStates());
+	ASSERT_EQ(std::size_t(1), flowpipes.size());
+	EXPECT_EQ(loc->id(), flowpipes.front().first);
+	ASSERT_FALSE(flowpipes.front().second.empty());
+	carl::Interval<double> last = flowpipes.front().second.back().interval(0);
+	EXPECT_LE(last.lower(), 0.5);
+	EXPECT_GE(last.upper(), 0.5238);
+	EXPECT_LE(0.45, last.lower());
+	EXPECT_GE(0.6, last.upper());
+}
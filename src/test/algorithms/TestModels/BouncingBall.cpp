@@ -10,7 +10,7 @@ HybridAutomaton<double>* createBB()
     transitionSet<double>* trans = new transitionSet();
     
     Location<double>* l1 = new Location<double>();
-    Transition<double>* t1 = new Transition<double>();
+    Transition<double>* t1 = TransitionManager<double>::getInstance().create();
     
     // TODO: set values of location and transition correspondent to the exmaple bouncingball.m
     
@@ -60,7 +60,7 @@ HybridAutomaton<double, valuation_t<double>>* createBB()
 {
     //Hybrid Automaton Objects: Locations, Transitions, Automaton itself
     Location<double>* loc1 = new Location<double>();
-    Transition<double>* trans = new Transition<double>();
+    Transition<double>* trans = TransitionManager<double>::getInstance().create();
     HybridAutomaton<double, valuation_t<double>>* hybrid = new HybridAutomaton<double, valuation_t<double>>();
 
     //Other Objects: Vectors, Matrices, Guards...
@@ -1,6 +1,12 @@
 #include "gtest/gtest.h"
+#include "algorithms/reachability/Reach.h"
 #include "algorithms/reachability/Settings.h"
+#include "algorithms/reachability/IntervalHull.h"
+#include "algorithms/reachability/VisitedStates.h"
+#include "datastructures/hybridAutomata/LocationManager.h"
+#include "datastructures/hybridAutomata/TransitionManager.h"
 #include <iostream>
+#include <limits>
 
 TEST(UtilityTest, ReachabilitySettings)
 {
@@ -14,3 +20,163 @@ TEST(UtilityTest, ReachabilitySettings)
 	EXPECT_EQ(settings, copy2);
 	EXPECT_EQ(copy, copy2);
 }
+
+TEST(UtilityTest, IntervalHull)
+{
+	using namespace hypro;
+	vector_t<double> center = vector_t<double>(2);
+	center << 1, 0;
+	matrix_t<double> generators = matrix_t<double>(2,2);
+	generators << 1, 1,
+				  0, 1;
+	reachability::IntervalHull<double> hull = reachability::computeIntervalHull<double>(Zonotope<double>(center, generators));
+	EXPECT_TRUE(hull.valid());
+	EXPECT_TRUE(hull.exact());
+	EXPECT_EQ(-1, hull.lower()(0));
+	EXPECT_EQ(3, hull.upper()(0));
+	EXPECT_EQ(-1, hull.lower()(1));
+	EXPECT_EQ(1, hull.upper()(1));
+
+	// x >= 4 is separated, x + y >= 3 is not.
+	matrix_t<double> mat = matrix_t<double>(1,2);
+	vector_t<double> vec = vector_t<double>(1);
+	mat << -1, 0;
+	vec << -4;
+	EXPECT_TRUE(hull.separatedFrom(mat, vec));
+	mat << -1, -1;
+	vec << -3;
+	EXPECT_FALSE(hull.separatedFrom(mat, vec));
+
+	// rotation by 90 degrees and shift by (0,2) yields [-1,1]x[1,5].
+	matrix_t<double> A = matrix_t<double>(2,2);
+	A << 0, -1,
+		 1, 0;
+	vector_t<double> b = vector_t<double>(2);
+	b << 0, 2;
+	reachability::IntervalHull<double> transformed = hull.affineTransformation(A, b);
+	EXPECT_FALSE(transformed.exact());
+	EXPECT_EQ(-1, transformed.lower()(0));
+	EXPECT_EQ(1, transformed.upper()(0));
+	EXPECT_EQ(1, transformed.lower()(1));
+	EXPECT_EQ(5, transformed.upper()(1));
+
+	// the hull of a box is exact, operations are combined componentwise.
+	reachability::IntervalHull<double> boxHull = reachability::computeIntervalHull<double>(Box<double>(std::make_pair(Point<double>({0,0}), Point<double>({2,2}))));
+	reachability::IntervalHull<double> sum = hull.minkowskiSum(boxHull);
+	EXPECT_EQ(-1, sum.lower()(0));
+	EXPECT_EQ(5, sum.upper()(0));
+	reachability::IntervalHull<double> intersection = transformed.intersect(boxHull);
+	EXPECT_EQ(0, intersection.lower()(0));
+	EXPECT_EQ(1, intersection.upper()(0));
+	EXPECT_EQ(1, intersection.lower()(1));
+	EXPECT_EQ(2, intersection.upper()(1));
+	reachability::IntervalHull<double> united = transformed.unite(boxHull);
+	EXPECT_EQ(-1, united.lower()(0));
+	EXPECT_EQ(5, united.upper()(1));
+
+	// an invalid hull never rejects.
+	EXPECT_FALSE(reachability::IntervalHull<double>().separatedFrom(mat, vec));
+}
+
+TEST(UtilityTest, VisitedStates)
+{
+	using namespace hypro;
+	Location<double>* loc = LocationManager<double>::getInstance().create();
+	Location<double>* other = LocationManager<double>::getInstance().create();
+	reachability::VisitedStates<double> visited;
+
+	visited.add(loc, Box<double>(std::make_pair(Point<double>({-2,-1}), Point<double>({0,1}))));
+	visited.add(loc, Box<double>(std::make_pair(Point<double>({0,-1}), Point<double>({3,1}))));
+
+	EXPECT_TRUE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({-1,0}), Point<double>({2,1})))));
+	EXPECT_FALSE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({2,0}), Point<double>({4,1})))));
+	EXPECT_FALSE(visited.contains(other, Box<double>(std::make_pair(Point<double>({-1,0}), Point<double>({2,1})))));
+
+	// flat boxes are checked against the closure of the visited states.
+	EXPECT_TRUE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({1,-1}), Point<double>({1,1})))));
+	EXPECT_TRUE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({3,0}), Point<double>({3,1})))));
+	EXPECT_FALSE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({3.5,0}), Point<double>({3.5,1})))));
+
+	// boxes below the current offset shift the accumulated set.
+	visited.add(loc, Box<double>(std::make_pair(Point<double>({-5,0}), Point<double>({-4,1}))));
+	EXPECT_TRUE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({-5,0}), Point<double>({-4,1})))));
+	EXPECT_TRUE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({-1,0}), Point<double>({2,1})))));
+	EXPECT_FALSE(visited.contains(loc, Box<double>(std::make_pair(Point<double>({-4,0}), Point<double>({-2,1})))));
+
+	// a second disjoint box doubles the coordinates per dimension, choose the dimension such that this exceeds the cell limit.
+	unsigned dim = 1;
+	while((std::uint64_t(1) << (2*dim)) <= VISITED_STATES_MAX_CELLS) {
+		++dim;
+	}
+	Location<double>* large = LocationManager<double>::getInstance().create();
+	vector_t<double> ones = vector_t<double>::Ones(dim);
+	Box<double> first = Box<double>(std::make_pair(Point<double>(vector_t<double>::Zero(dim)), Point<double>(ones)));
+	Box<double> second = Box<double>(std::make_pair(Point<double>(vector_t<double>(2*ones)), Point<double>(vector_t<double>(3*ones))));
+	visited.add(large, first);
+	visited.add(large, second);
+	EXPECT_TRUE(visited.contains(large, first));
+	EXPECT_FALSE(visited.contains(large, second));
+
+	// a single box with more vertices than the limit is not added either, also beyond the width of std::size_t.
+	for(unsigned cornerDim : {unsigned(2*dim), unsigned(std::numeric_limits<std::size_t>::digits + 1)}) {
+		Location<double>* huge = LocationManager<double>::getInstance().create();
+		vector_t<double> hugeOnes = vector_t<double>::Ones(cornerDim);
+		Box<double> box = Box<double>(std::make_pair(Point<double>(vector_t<double>::Zero(cornerDim)), Point<double>(hugeOnes)));
+		visited.add(huge, box);
+		EXPECT_FALSE(visited.contains(huge, box));
+	}
+}
+
+TEST(UtilityTest, HullRejectsGuards)
+{
+	using namespace hypro;
+	Location<double>* loc = LocationManager<double>::getInstance().create();
+	loc->setFlow(matrix_t<double>::Zero(3,3));
+	HybridAutomaton<double> automaton;
+	automaton.addLocation(loc);
+
+	// x <= 16 and y <= 16, satisfied by the unit box.
+	Transition<double>::Guard guard;
+	guard.mat = matrix_t<double>::Identity(2,2);
+	guard.vec = vector_t<double>::Constant(2,16);
+	Transition<double>::Reset reset;
+	reset.mat = matrix_t<double>::Identity(2,2);
+	reset.vec = vector_t<double>::Zero(2);
+	Transition<double>* bounded = TransitionManager<double>::getInstance().create(loc, loc, guard, reset);
+	loc->addTransition(bounded);
+	automaton.addTransition(bounded);
+
+	reachability::Reach<double, Box<double>> reacher(automaton);
+	State<double> state;
+	state.location = loc;
+	state.set = Box<double>(std::make_pair(Point<double>({0,0}), Point<double>({1,1})));
+	state.timestamp = carl::Interval<double>(0,1);
+	std::vector<boost::tuple<Transition<double>*, State<double>>> nextInitialSets;
+
+	// without a hull the guard is tested exactly.
+	reacher.checkTransitions(state, state.timestamp, nextInitialSets);
+	EXPECT_EQ(std::size_t(1), nextInitialSets.size());
+
+	// a hull separated from the guard skips it without the exact test, even though the set satisfies the guard.
+	nextInitialSets.clear();
+	reachability::IntervalHull<double> separated(vector_t<double>::Constant(2,20), vector_t<double>::Constant(2,21));
+	reacher.checkTransitions(state, state.timestamp, nextInitialSets, &separated);
+	EXPECT_TRUE(nextInitialSets.empty());
+
+	// a lazily computed hull does not reject satisfiable guards.
+	reachability::IntervalHull<double> lazy;
+	reacher.checkTransitions(state, state.timestamp, nextInitialSets, &lazy);
+	EXPECT_EQ(std::size_t(1), nextInitialSets.size());
+	EXPECT_TRUE(lazy.valid());
+
+	// guards without constraints are never rejected and do not trigger the computation of the hull.
+	Transition<double>::Guard unconstrained;
+	unconstrained.mat = matrix_t<double>(0,2);
+	unconstrained.vec = vector_t<double>(0);
+	bounded->setGuard(unconstrained);
+	nextInitialSets.clear();
+	reachability::IntervalHull<double> untouched;
+	reacher.checkTransitions(state, state.timestamp, nextInitialSets, &untouched);
+	EXPECT_EQ(std::size_t(1), nextInitialSets.size());
+	EXPECT_FALSE(untouched.valid());
+}
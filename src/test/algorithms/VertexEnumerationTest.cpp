@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 #include "../defines.h"
 #include "../../src/hypro/algorithms/convexHull/vertexEnumeration.h"
+#include "../../src/hypro/algorithms/convexHull/DoubleDescription.h"
+#include "../../src/hypro/algorithms/convexHull/QuickHull.h"
+#include "../../src/hypro/algorithms/convexHull/ZonotopeEnumeration.h"
 #include "../../src/hypro/config.h"
 
 using namespace hypro;
@@ -255,3 +258,149 @@ public:
 		EXPECT_TRUE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({-2,-2,-1})) != vertices.end());
 		EXPECT_TRUE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({-2,-2,-2})) != vertices.end());
 	}
+
+	TEST_F(VertexEnumerationTest, DoubleDescription) {
+		DoubleDescription<mpq_class> exact(a,b);
+		exact.enumerateVertices();
+		std::vector<Point<mpq_class>> vertices = exact.getPoints();
+		EXPECT_EQ(vertices.size(), unsigned(3));
+		EXPECT_TRUE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({-1,0})) != vertices.end());
+		EXPECT_TRUE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({mpq_class(-2,7),mpq_class(10,7)})) != vertices.end());
+		EXPECT_TRUE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({mpq_class(8,7),mpq_class(-5,7)})) != vertices.end());
+		EXPECT_TRUE(exact.getCones().empty());
+
+		// degenerate apex, which is the intersection of four constraints.
+		matrix_t<double> m = matrix_t<double>(5,3);
+		vector_t<double> c = vector_t<double>(m.rows());
+		m << 1,1,0,
+			0,1,1,
+			-1,1,0,
+			0,1,-1,
+			0,-1,0;
+		c << 1,1,1,1,0;
+		DoubleDescription<double> deg(m,c);
+		deg.enumerateVertices();
+		std::vector<Point<double>> degVertices = deg.getPoints();
+		EXPECT_EQ(degVertices.size(), unsigned(5));
+		EXPECT_TRUE(std::find(degVertices.begin(), degVertices.end(), Point<double>({0,1,0})) != degVertices.end());
+		EXPECT_TRUE(std::find(degVertices.begin(), degVertices.end(), Point<double>({1,0,1})) != degVertices.end());
+		EXPECT_TRUE(std::find(degVertices.begin(), degVertices.end(), Point<double>({-1,0,-1})) != degVertices.end());
+
+		// unbounded polyhedra yield recession directions, empty ones no vertices.
+		matrix_t<mpq_class> quadrant = matrix_t<mpq_class>(2,2);
+		quadrant << -1,0,0,-1;
+		DoubleDescription<mpq_class> unbounded(quadrant, vector_t<mpq_class>::Zero(2));
+		unbounded.enumerateVertices();
+		EXPECT_EQ(unbounded.getPoints().size(), unsigned(1));
+		EXPECT_EQ(unbounded.getCones().size(), unsigned(2));
+
+		matrix_t<mpq_class> contradicting = matrix_t<mpq_class>(2,1);
+		contradicting << 1,-1;
+		vector_t<mpq_class> contradictingConstants = vector_t<mpq_class>(2);
+		contradictingConstants << -1,-1;
+		DoubleDescription<mpq_class> empty(contradicting, contradictingConstants);
+		empty.enumerateVertices();
+		EXPECT_TRUE(empty.getPoints().empty());
+	}
+
+	TEST_F(VertexEnumerationTest, QuickHull) {
+		// unit cube with additional points on its edges, on its facets and in its interior.
+		std::vector<Point<mpq_class>> points;
+		for(int x = 0; x < 3; ++x) {
+			for(int y = 0; y < 3; ++y) {
+				for(int z = 0; z < 3; ++z) {
+					points.emplace_back(Point<mpq_class>({mpq_class(x,2),mpq_class(y,2),mpq_class(z,2)}));
+				}
+			}
+		}
+		points.emplace_back(Point<mpq_class>({mpq_class(1,3),mpq_class(1,4),mpq_class(1,5)}));
+
+		QuickHull<mpq_class> exact(points);
+		exact.compute();
+		EXPECT_TRUE(exact.isFullDimensional());
+		EXPECT_EQ(exact.getHsv().size(), unsigned(6));
+		EXPECT_EQ(exact.getVertices().size(), unsigned(8));
+		for(const auto& plane : exact.getHsv()) {
+			EXPECT_TRUE(plane.contains(points));
+		}
+		std::map<Point<mpq_class>, std::set<Point<mpq_class>>> neighborhood = exact.getNeighborhood();
+		EXPECT_EQ(neighborhood.size(), unsigned(8));
+		for(const auto& pointNeighborsPair : neighborhood) {
+			EXPECT_EQ(pointNeighborsPair.second.size(), unsigned(3));
+		}
+
+		// coplanar points are detected by the exact fallback of the floating point visibility test.
+		std::vector<Point<double>> fpPoints;
+		for(const auto& point : points) {
+			fpPoints.emplace_back(convert<mpq_class,double>(point));
+		}
+		fpPoints.emplace_back(Point<double>({0.1,0.7,1.0}));
+		QuickHull<double> fp(fpPoints);
+		fp.compute();
+		EXPECT_EQ(fp.getHsv().size(), unsigned(6));
+		EXPECT_EQ(fp.getVertices().size(), unsigned(8));
+
+		// lower dimensional point sets have no facets.
+		std::vector<Point<mpq_class>> flat = {Point<mpq_class>({0,0,0}), Point<mpq_class>({1,0,0}), Point<mpq_class>({0,1,0}), Point<mpq_class>({1,1,0})};
+		QuickHull<mpq_class> degenerate(flat);
+		degenerate.compute();
+		EXPECT_FALSE(degenerate.isFullDimensional());
+		EXPECT_TRUE(degenerate.getHsv().empty());
+	}
+
+	TEST_F(VertexEnumerationTest, ZonotopeEnumeration) {
+		// planar: the parallel generators (1,1) and (2,2) are merged, which leaves a hexagon.
+		matrix_t<mpq_class> planarGenerators = matrix_t<mpq_class>(2,5);
+		planarGenerators << 1,0,1,2,0,
+							0,1,1,2,0;
+		vector_t<mpq_class> planarCenter = vector_t<mpq_class>::Zero(2);
+		ZonotopeEnumeration<mpq_class> planar(planarCenter, planarGenerators);
+		EXPECT_EQ(planar.generators().size(), unsigned(3));
+		planar.enumerateVertices();
+		std::vector<Point<mpq_class>> planarVertices = planar.getVertices();
+		EXPECT_EQ(planarVertices.size(), unsigned(6));
+		EXPECT_TRUE(std::find(planarVertices.begin(), planarVertices.end(), Point<mpq_class>({4,4})) != planarVertices.end());
+		EXPECT_TRUE(std::find(planarVertices.begin(), planarVertices.end(), Point<mpq_class>({2,4})) != planarVertices.end());
+		EXPECT_TRUE(std::find(planarVertices.begin(), planarVertices.end(), Point<mpq_class>({-4,-4})) != planarVertices.end());
+		planar.enumerateFacets();
+		EXPECT_EQ(planar.getHsv().size(), unsigned(6));
+
+		// four generators in general position in R^3 yield 14 vertices and 12 facets.
+		matrix_t<mpq_class> generators = matrix_t<mpq_class>(3,4);
+		generators << 1,0,0,1,
+					  0,1,0,1,
+					  0,0,1,1;
+		vector_t<mpq_class> center = vector_t<mpq_class>(3);
+		center << 1,2,3;
+		ZonotopeEnumeration<mpq_class> zonotope(center, generators);
+		EXPECT_TRUE(zonotope.isFullDimensional());
+		zonotope.enumerateVertices();
+		zonotope.enumerateFacets();
+		std::vector<Point<mpq_class>> vertices = zonotope.getVertices();
+		std::vector<Halfspace<mpq_class>> facets = zonotope.getHsv();
+		EXPECT_EQ(vertices.size(), unsigned(14));
+		EXPECT_EQ(facets.size(), unsigned(12));
+		EXPECT_TRUE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({3,4,5})) != vertices.end());
+		EXPECT_FALSE(std::find(vertices.begin(), vertices.end(), Point<mpq_class>({1,2,3})) != vertices.end());
+		for(const auto& plane : facets) {
+			EXPECT_TRUE(plane.contains(vertices));
+			// each facet is a parallelogram.
+			unsigned tight = 0;
+			for(const auto& vertex : vertices) {
+				tight += plane.normal().dot(vertex.rawCoordinates()) == plane.offset() ? 1 : 0;
+			}
+			EXPECT_EQ(tight, unsigned(4));
+		}
+
+		// flat zonotopes have vertices but no facets.
+		matrix_t<mpq_class> flatGenerators = matrix_t<mpq_class>(3,2);
+		flatGenerators << 1,0,
+						  0,1,
+						  0,0;
+		ZonotopeEnumeration<mpq_class> flat(center, flatGenerators);
+		EXPECT_FALSE(flat.isFullDimensional());
+		flat.enumerateVertices();
+		flat.enumerateFacets();
+		EXPECT_EQ(flat.getVertices().size(), unsigned(4));
+		EXPECT_TRUE(flat.getHsv().empty());
+	}
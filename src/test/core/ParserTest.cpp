@@ -1,7 +1,12 @@
 #include "gtest/gtest.h"
 #include "parser/flowstar/ParserWrapper.h"
 #include "datastructures/hybridAutomata/HybridAutomaton.h"
+#include "datastructures/hybridAutomata/HybridAutomatonSerialization.h"
+#include "util/VariablePool.h"
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
+#include <sstream>
 
 TEST(ParserTest, ParseAutomaton)
 {
@@ -26,3 +31,112 @@ TEST(ParserTest, ParseAutomaton)
 	EXPECT_EQ(automaton.locations().size(), unsigned(2));
 	EXPECT_EQ(automaton.transitions().size(), unsigned(3));
 }
+
+TEST(ParserTest, CachedAutomaton)
+{
+	using namespace hypro;
+
+	std::ofstream file("/tmp/cachedAutomaton.model");
+	#include "models/automaton.h"
+	file << autString;
+	file.close();
+	std::remove("/tmp/cachedAutomaton.model.cache");
+
+	// the parser creates the state variables anew, start with an empty pool.
+	VariablePool::getInstance().clear();
+	std::string filename = "/tmp/cachedAutomaton.model";
+	boost::tuple<HybridAutomaton<mpq_class>, reachability::ReachabilitySettings<mpq_class>> parseResult = parseFlowstarFileCached<mpq_class>(filename);
+	std::ifstream cache("/tmp/cachedAutomaton.model.cache");
+	EXPECT_TRUE(cache.good());
+
+	// the second call loads the automaton from the cache.
+	boost::tuple<HybridAutomaton<mpq_class>, reachability::ReachabilitySettings<mpq_class>> cachedResult = parseFlowstarFileCached<mpq_class>(filename);
+	HybridAutomaton<mpq_class> automaton = boost::get<0>(parseResult);
+	HybridAutomaton<mpq_class> cached = boost::get<0>(cachedResult);
+
+	EXPECT_EQ(boost::get<1>(parseResult), boost::get<1>(cachedResult));
+	EXPECT_EQ(automaton.locations().size(), cached.locations().size());
+	EXPECT_EQ(automaton.transitions().size(), cached.transitions().size());
+	EXPECT_EQ(automaton.initialStates().size(), cached.initialStates().size());
+	ASSERT_FALSE(cached.initialStates().empty());
+	EXPECT_EQ(automaton.initialStates().begin()->second.set, cached.initialStates().begin()->second.set);
+	EXPECT_EQ(automaton.initialStates().begin()->second.location->flow(), cached.initialStates().begin()->second.location->flow());
+
+	// transitions are stored by address, find a cached transition with the same guard and reset for each parsed one.
+	for(const auto transition : automaton.transitions()) {
+		EXPECT_TRUE(std::any_of(cached.transitions().begin(), cached.transitions().end(), [&](const Transition<mpq_class>* other) {
+			return transition->guard().mat == other->guard().mat && transition->guard().vec == other->guard().vec &&
+				   transition->reset().mat == other->reset().mat && transition->reset().vec == other->reset().vec;
+		}));
+	}
+
+	// local bad states and rationals, which are not representable as doubles, survive a round trip.
+	Location<mpq_class>* loc = automaton.initialStates().begin()->second.location;
+	matrix_t<mpq_class> badMat = matrix_t<mpq_class>::Zero(1, loc->flow().cols() - 1);
+	vector_t<mpq_class> badVec = vector_t<mpq_class>(1);
+	badMat(0,0) = 1;
+	badVec << mpq_class(1,3);
+	automaton.addLocalBadState(RawState<mpq_class>(loc, std::make_pair(badMat, badVec)));
+
+	std::stringstream stream;
+	serialization::write(stream, automaton);
+	HybridAutomaton<mpq_class> restored;
+	ASSERT_TRUE(serialization::read(stream, restored));
+	ASSERT_FALSE(restored.initialStates().empty());
+	const auto& badStates = restored.localBadStates(restored.initialStates().begin()->second.location);
+	ASSERT_EQ(std::size_t(1), badStates.size());
+	EXPECT_EQ(badMat, badStates.front()->set.first);
+	EXPECT_EQ(mpq_class(1,3), badStates.front()->set.second(0));
+	EXPECT_EQ(automaton.localBadStates().size(), restored.localBadStates().size());
+}
+
+TEST(ParserTest, PolynomialFlow)
+{
+	using namespace hypro;
+
+	std::ofstream file("/tmp/polynomialAutomaton.model");
+	#include "models/polynomialAutomaton.h"
+	file << polynomialAutString;
+	file.close();
+
+	std::string filename = "/tmp/polynomialAutomaton.model";
+	boost::tuple<HybridAutomaton<mpq_class>, reachability::ReachabilitySettings<mpq_class>> parseResult = parseFlowstarFile<mpq_class>(filename);
+	HybridAutomaton<mpq_class> automaton = boost::get<0>(parseResult);
+
+	ASSERT_EQ(automaton.locations().size(), unsigned(1));
+	Location<mpq_class>* loc = *automaton.locations().begin();
+	ASSERT_TRUE(loc->hasPolynomialFlow());
+	ASSERT_EQ(std::size_t(2), loc->polynomialFlow().size());
+
+	// x' = 2*x*y is kept as polynomial, the flow matrix only holds the affine part.
+	Location<mpq_class>::polynomial xFlow;
+	xFlow[std::vector<unsigned>({0,1})] = mpq_class(2);
+	EXPECT_EQ(xFlow, loc->polynomialFlow()[0]);
+	Location<mpq_class>::polynomial yFlow;
+	yFlow[std::vector<unsigned>()] = mpq_class(1);
+	yFlow[std::vector<unsigned>({1})] = mpq_class(-1);
+	EXPECT_EQ(yFlow, loc->polynomialFlow()[1]);
+
+	matrix_t<mpq_class> affineFlow = matrix_t<mpq_class>::Zero(3,3);
+	affineFlow(1,1) = -1;
+	affineFlow(1,2) = 1;
+	EXPECT_EQ(affineFlow, loc->flow());
+
+	// the polynomial flow survives a round trip through the cache format.
+	std::stringstream stream;
+	serialization::write(stream, automaton);
+	HybridAutomaton<mpq_class> restored;
+	ASSERT_TRUE(serialization::read(stream, restored));
+	ASSERT_EQ(restored.locations().size(), unsigned(1));
+	EXPECT_EQ(loc->polynomialFlow(), (*restored.locations().begin())->polynomialFlow());
+
+	// linear models are not affected.
+	std::ofstream linearFile("/tmp/automaton.model");
+	#include "models/automaton.h"
+	linearFile << autString;
+	linearFile.close();
+	HybridAutomaton<mpq_class> linearAutomaton = boost::get<0>(parseFlowstarFile<mpq_class>("/tmp/automaton.model"));
+	for(const auto location : linearAutomaton.locations()) {
+		EXPECT_FALSE(location->hasPolynomialFlow());
+	}
+}
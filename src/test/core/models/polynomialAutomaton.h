@@ -0,0 +1,48 @@
+auto polynomialAutString = R"HYPROAUT(
+hybrid reachability
+{
+ state var x,y
+
+ setting
+ {
+  fixed steps 0.01
+  time 1
+  remainder estimation 1e-5
+  identity precondition
+  gnuplot octagon x,y
+  fixed orders 5
+  cutoff 1e-15
+  precision 128
+  output testpolynomialautomaton
+  max jumps 0
+  print on
+ }
+
+ modes
+ {
+  l0
+  {
+   poly ode 3
+   {
+    x' = 2*x*y
+    y' = 1 - y
+   }
+
+   inv
+   {
+    x <= 10
+   }
+  }
+ }
+
+ init
+ {
+  l0
+  {
+   x in [1,1.1]
+   y in [0,0]
+  }
+ }
+
+}
+)HYPROAUT";
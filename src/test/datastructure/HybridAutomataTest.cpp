@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 #include "../defines.h"
 #include "datastructures/hybridAutomata/LocationManager.h"
+#include "datastructures/hybridAutomata/TransitionManager.h"
 #include "datastructures/hybridAutomata/Transition.h"
 #include "datastructures/hybridAutomata/HybridAutomaton.h"
 #include "datastructures/hybridAutomata/RawState.h"
@@ -36,7 +37,7 @@ protected:
     	loc2 = locMan.create();
 
 
-    	trans = new hypro::Transition<Number>();
+    	trans = hypro::TransitionManager<Number>::getInstance().create();
 
 		invariantVec(0) = 10;
 		invariantVec(1) = 20;
@@ -210,7 +211,7 @@ TYPED_TEST(HybridAutomataTest, TransitionTest)
 	EXPECT_EQ(this->trans->guard().mat, this->guard.mat);
 
 	// creation of transitions from source and target
-	Transition<TypeParam>* t = new Transition<TypeParam>(this->loc1, this->loc2);
+	Transition<TypeParam>* t = TransitionManager<TypeParam>::getInstance().create(this->loc1, this->loc2);
 	EXPECT_EQ(t->source(), this->loc1);
 	EXPECT_EQ(t->target(), this->loc2);
 	EXPECT_EQ(t->aggregation(), Aggregation::boxAgg);
@@ -250,6 +251,28 @@ TYPED_TEST(HybridAutomataTest, HybridAutomatonTest)
 	// copy assignment operator
 	HybridAutomaton<TypeParam> h2 = h1;
 	EXPECT_EQ(h1, h2);
+
+	// local bad states are looked up by location.
+	h1.addLocalBadState(RawState<TypeParam>(this->loc2, std::make_pair(matr, vec)));
+	EXPECT_TRUE(h1.localBadStates(this->loc1).empty());
+	ASSERT_EQ(h1.localBadStates(this->loc2).size(), std::size_t(1));
+	EXPECT_EQ(h1.localBadStates(this->loc2).front()->set.second, vec);
+
+	HybridAutomaton<TypeParam> h3 = h1;
+	ASSERT_EQ(h3.localBadStates(this->loc2).size(), std::size_t(1));
+	EXPECT_EQ(h3.localBadStates(this->loc2).front(), &h3.localBadStates().begin()->second);
+
+	// locations are stored ordered by id independent of the insertion order, states are keyed by location id.
+	HybridAutomaton<TypeParam> h4;
+	h4.addLocation(this->loc2);
+	h4.addLocation(this->loc1);
+	h4.addLocation(this->loc2);
+	ASSERT_EQ(h4.locations().size(), std::size_t(2));
+	EXPECT_TRUE(h4.locations().front()->id() < h4.locations().back()->id());
+	EXPECT_EQ(h4.location(this->loc1->id()), this->loc1);
+	EXPECT_EQ(h4.location(this->loc2->id()), this->loc2);
+	EXPECT_TRUE(h4.location(std::max(this->loc1->id(), this->loc2->id())+1) == nullptr);
+	EXPECT_EQ(h1.initialStates().begin()->first, this->loc1->id());
 }
 
 TYPED_TEST(HybridAutomataTest, LocationManagerTest)
@@ -260,6 +283,40 @@ TYPED_TEST(HybridAutomataTest, LocationManagerTest)
 
 	unsigned id = this->locMan.id(loc);
 	EXPECT_EQ(this->locMan.location(id), loc);
+
+	// reserved locations are placed contiguously and have consecutive ids.
+	this->locMan.reserve(2);
+	Location<TypeParam>* first = this->locMan.create(flow);
+	Location<TypeParam>* second = this->locMan.create(flow);
+	EXPECT_EQ(first->id() + 1, second->id());
+	EXPECT_EQ(first + 1, second);
+	EXPECT_EQ(this->locMan.location(second->id()), second);
+}
+
+TYPED_TEST(HybridAutomataTest, TransitionManagerTest)
+{
+	TransitionManager<TypeParam>& transMan = TransitionManager<TypeParam>::getInstance();
+	Transition<TypeParam>* t = transMan.create(this->loc1, this->loc2, this->guard, this->reset);
+	EXPECT_EQ(t->guard().mat, this->guard.mat);
+	EXPECT_EQ(transMan.transition(transMan.id(t)), t);
+
+	// reserved transitions are placed contiguously and have consecutive ids.
+	transMan.reserve(2);
+	Transition<TypeParam>* first = transMan.create(this->loc1, this->loc2);
+	Transition<TypeParam>* second = transMan.create(first);
+	EXPECT_EQ(first->id() + 1, second->id());
+	EXPECT_EQ(first + 1, second);
+	EXPECT_EQ(second->target(), this->loc2);
+
+	// the outgoing transitions of a location are ordered by id.
+	this->loc1->addTransition(second);
+	this->loc1->addTransition(first);
+	this->loc1->addTransition(first);
+	ASSERT_EQ(std::size_t(3), this->loc1->outgoing().size());
+	EXPECT_EQ(this->trans, this->loc1->outgoing()[0]);
+	EXPECT_EQ(first, this->loc1->outgoing()[1]);
+	EXPECT_EQ(second, this->loc1->outgoing()[2]);
+	EXPECT_EQ(this->loc1->transitions().size(), this->loc1->outgoing().size());
 }
 
 
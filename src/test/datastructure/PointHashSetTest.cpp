@@ -0,0 +1,71 @@
+/**
+ * @file PointHashSetTest.cpp
+ *
+ * @covers PointHashSet
+ */
+
+#include "gtest/gtest.h"
+#include "../defines.h"
+#include "../../hypro/datastructures/PointHashSet.h"
+
+using namespace hypro;
+
+template<typename Number>
+class PointHashSetTest : public ::testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		p1 = Point<Number>({Number(2),Number(5)});
+		p2 = Point<Number>({Number(7),Number(8)});
+		p3 = Point<Number>({Number(-9),Number(-13)});
+	}
+
+	virtual void TearDown()
+	{
+	}
+
+	Point<Number> p1;
+	Point<Number> p2;
+	Point<Number> p3;
+};
+
+TYPED_TEST(PointHashSetTest, Insertion)
+{
+	PointHashSet<TypeParam> set;
+	EXPECT_TRUE(set.empty());
+	EXPECT_EQ(set.insert(this->p1), std::make_pair(std::size_t(0), true));
+	EXPECT_EQ(set.insert(this->p2), std::make_pair(std::size_t(1), true));
+	EXPECT_EQ(set.insert(this->p1.rawCoordinates()), std::make_pair(std::size_t(0), false));
+	EXPECT_EQ(set.size(), std::size_t(2));
+	EXPECT_EQ(set.dimension(), std::size_t(2));
+
+	EXPECT_TRUE(set.contains(this->p2));
+	EXPECT_FALSE(set.contains(this->p3));
+	EXPECT_EQ(set.find(this->p3), PointHashSet<TypeParam>::npos);
+	EXPECT_EQ(set.at(1), this->p2.rawCoordinates());
+
+	std::vector<Point<TypeParam>> points = set.points();
+	EXPECT_EQ(points.size(), std::size_t(2));
+	EXPECT_EQ(points[0], this->p1);
+	EXPECT_EQ(points[1], this->p2);
+
+	set.clear();
+	EXPECT_TRUE(set.empty());
+	EXPECT_FALSE(set.contains(this->p1));
+}
+
+TYPED_TEST(PointHashSetTest, Growth)
+{
+	// insertion order and lookup survive rehashing.
+	PointHashSet<TypeParam> set;
+	for(int x = 0; x < 50; ++x) {
+		for(int y = 0; y < 50; ++y) {
+			set.insert(Point<TypeParam>({TypeParam(x),TypeParam(y)}));
+			set.insert(Point<TypeParam>({TypeParam(x),TypeParam(y)}));
+		}
+	}
+	EXPECT_EQ(set.size(), std::size_t(2500));
+	EXPECT_EQ(set.find(Point<TypeParam>({TypeParam(3),TypeParam(7)})), std::size_t(157));
+	EXPECT_FALSE(set.contains(Point<TypeParam>({TypeParam(50),TypeParam(0)})));
+}
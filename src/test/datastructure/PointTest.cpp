@@ -323,3 +323,63 @@ TYPED_TEST(PointTest, Addition)
 	EXPECT_EQ(p1+p3, Point<TypeParam>({0,0}));
 }
 
+
+TYPED_TEST(PointTest, CopyMoveSwap)
+{
+	EXPECT_FALSE(std::is_polymorphic<Point<TypeParam>>::value);
+
+	Point<TypeParam> p1({1,2,3});
+	std::size_t hash = p1.hash();
+	Point<TypeParam> copy(p1);
+	EXPECT_EQ(p1, copy);
+	EXPECT_EQ(hash, copy.hash());
+
+	Point<TypeParam> moved(std::move(copy));
+	EXPECT_EQ(p1, moved);
+	EXPECT_EQ(hash, moved.hash());
+
+	Point<TypeParam> p2({4,5});
+	moved.swap(p2);
+	EXPECT_EQ(moved, Point<TypeParam>({4,5}));
+	EXPECT_EQ(p2, p1);
+	EXPECT_EQ(p2.hash(), hash);
+
+	p2 += Point<TypeParam>({1,1,1});
+	EXPECT_EQ(p2.hash(), std::hash<vector_t<TypeParam>>()(p2.rawCoordinates()));
+}
+
+TYPED_TEST(PointTest, InlineAndHeapStorage)
+{
+	// points up to POINT_INLINE_DIMENSION store their coordinates in place, larger ones on the heap.
+	vector_t<TypeParam> large = vector_t<TypeParam>::Zero(POINT_INLINE_DIMENSION + 2);
+	for(unsigned d = 0; d < large.rows(); ++d) {
+		large(d) = TypeParam(d);
+	}
+	Point<TypeParam> heap(large);
+	Point<TypeParam> small({1,2});
+	EXPECT_EQ(vector_t<TypeParam>(heap.rawCoordinates()), large);
+	EXPECT_EQ(heap.hash(), std::hash<vector_t<TypeParam>>()(large));
+
+	Point<TypeParam> heapCopy(heap);
+	heapCopy.swap(small);
+	EXPECT_EQ(heapCopy, Point<TypeParam>({1,2}));
+	EXPECT_EQ(small, heap);
+
+	Point<TypeParam> moved(std::move(small));
+	EXPECT_EQ(moved, heap);
+	EXPECT_EQ(small.dimension(), unsigned(0));
+
+	// growing across the threshold keeps the coordinates.
+	Point<TypeParam> growing = Point<TypeParam>::Zero(POINT_INLINE_DIMENSION);
+	growing[0] = TypeParam(5);
+	growing.extend(TypeParam(7));
+	EXPECT_EQ(growing.dimension(), POINT_INLINE_DIMENSION + 1);
+	EXPECT_EQ(growing.at(0), TypeParam(5));
+	EXPECT_EQ(growing.at(POINT_INLINE_DIMENSION), TypeParam(7));
+	growing.reduceDimension(2);
+	EXPECT_EQ(growing, Point<TypeParam>({5,0}));
+
+	// assigning an expression which refers to the point itself.
+	growing = growing.rawCoordinates() * TypeParam(2);
+	EXPECT_EQ(growing, Point<TypeParam>({10,0}));
+}
@@ -50,6 +50,7 @@ TYPED_TEST_CASE(EigenAdaptionsTest, allTypes);
 // Datastructure
 TYPED_TEST_CASE(HalfspaceTest, allTypes);
 TYPED_TEST_CASE(PointTest, rationalTypes);
+TYPED_TEST_CASE(PointHashSetTest, allTypes);
 TYPED_TEST_CASE(HybridAutomataTest, allTypes);
 TYPED_TEST_CASE(VertexContainerTest, allTypes);
 TYPED_TEST_CASE(VertexTest, allTypes);
@@ -474,3 +474,40 @@ TYPED_TEST(BoxTest, Projection)
 
 	EXPECT_EQ(box.project(dims), hypro::Box<TypeParam>( std::make_pair(hypro::Point<TypeParam>({1}), hypro::Point<TypeParam>({2}))));
 }
+
+TYPED_TEST(BoxTest, VertexRange)
+{
+	std::vector<carl::Interval<TypeParam>> intervals;
+	intervals.emplace_back(TypeParam(3), TypeParam(5));
+	intervals.emplace_back(TypeParam(1), TypeParam(1));
+	intervals.emplace_back(TypeParam(2), TypeParam(5));
+	intervals.emplace_back(TypeParam(-1), TypeParam(0));
+	hypro::Box<TypeParam> box(intervals);
+
+	// the degenerate second dimension is not enumerated.
+	EXPECT_EQ(std::uint64_t(8), box.vertexRange().size());
+	std::set<hypro::Point<TypeParam>> corners;
+	hypro::Point<TypeParam> previous;
+	for(const auto& vertex : box.vertexRange()) {
+		EXPECT_TRUE(vertex.at(1) == TypeParam(1));
+		if(previous.dimension() > 0) {
+			// Gray code order: consecutive vertices differ in one coordinate.
+			unsigned differences = 0;
+			for(unsigned d = 0; d < 4; ++d) {
+				differences += previous.at(d) != vertex.at(d) ? 1 : 0;
+			}
+			EXPECT_EQ(unsigned(1), differences);
+		}
+		previous = vertex;
+		corners.insert(vertex);
+	}
+	EXPECT_EQ(std::size_t(8), corners.size());
+	EXPECT_TRUE(corners.find(hypro::Point<TypeParam>({5,1,2,0})) != corners.end());
+	EXPECT_EQ(std::size_t(8), box.vertices().size());
+
+	std::vector<unsigned> dims = {3,0};
+	std::vector<hypro::Point<TypeParam>> projected = box.vertexRange(dims).collect();
+	EXPECT_EQ(std::size_t(4), projected.size());
+	EXPECT_TRUE(std::find(projected.begin(), projected.end(), hypro::Point<TypeParam>({-1,3})) != projected.end());
+	EXPECT_TRUE(std::find(projected.begin(), projected.end(), hypro::Point<TypeParam>({0,5})) != projected.end());
+}
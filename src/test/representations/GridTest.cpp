@@ -60,12 +60,12 @@ TYPED_TEST(GridTest, Properties)
 
     EXPECT_FALSE(this->grid1.empty());
     EXPECT_EQ(this->grid1.size(), (unsigned)6);
-    EXPECT_TRUE(this->grid1.find(p1) != this->grid1.end());
+    EXPECT_TRUE(this->grid1.hasColor(p1));
 
     this->grid1.clear();
     EXPECT_TRUE(this->grid1.empty());
     EXPECT_EQ(this->grid1.size(),(unsigned)0);
-    EXPECT_FALSE(this->grid1.find(p1) != this->grid1.end());
+    EXPECT_FALSE(this->grid1.hasColor(p1));
 }
 
 TYPED_TEST(GridTest, Insert)
@@ -152,6 +152,32 @@ TYPED_TEST(GridTest, ColorAtInduced)
     EXPECT_EQ(false, this->grid1.colorAtInduced(p));
 }
 
+TYPED_TEST(GridTest, ColorAll)
+{
+    this->grid1.colorAll();
+    for(unsigned x = 0; x < 4; ++x) {
+        for(unsigned y = 0; y < 4; ++y) {
+            EXPECT_TRUE(this->grid1.hasColorInduced(Point<unsigned>({x, y})));
+        }
+    }
+
+    std::vector<Point<TypeParam>> black = this->grid1.allBlack();
+    EXPECT_TRUE(std::find(black.begin(), black.end(), Point<TypeParam>({2, 2})) != black.end());
+    EXPECT_TRUE(std::find(black.begin(), black.end(), Point<TypeParam>({4, 4})) != black.end());
+    for(const auto& point : black) {
+        EXPECT_TRUE(this->grid1.colorAt(point));
+    }
+
+    // points beyond the grid are stored separately, colors are kept when coordinates are added.
+    Point<unsigned> outside({7, 7});
+    this->grid1.insertInduced(outside, true);
+    EXPECT_TRUE(this->grid1.colorAtInduced(outside));
+    this->grid1.addCoordinate(TypeParam(8), 0);
+    EXPECT_TRUE(this->grid1.colorAtInduced(outside));
+    EXPECT_TRUE(this->grid1.colorAtInduced(Point<unsigned>({1, 1})));
+    EXPECT_FALSE(this->grid1.colorAtInduced(Point<unsigned>({0, 0})));
+}
+
 TYPED_TEST(GridTest, CalculateInduced)
 {
     Point<unsigned>::coordinateMap i;
@@ -204,3 +230,18 @@ TYPED_TEST(GridTest, Translate)
     EXPECT_EQ(induced, this->grid1.translateToInduced(this->vertices));
     EXPECT_EQ(this->vertices, this->grid1.translateToOriginal(induced));
 }
+
+TYPED_TEST(GridTest, Combine)
+{
+    // coordinates are added one by one, the color store is adapted on the next access.
+    hypro::Grid<TypeParam> combined = hypro::Grid<TypeParam>::combine(this->grid1, this->grid1);
+    EXPECT_EQ(this->grid1.inducedDimensionAt(0), combined.inducedDimensionAt(0));
+    EXPECT_FALSE(combined.colorAtInduced(Point<unsigned>::Zero(2)));
+
+    combined.addCoordinate(TypeParam(8), 1);
+    combined.addCoordinate(TypeParam(9), 1);
+    EXPECT_EQ(std::size_t(6), combined.inducedDimensionAt(1).size());
+    combined.insertInduced(Point<unsigned>({4, 6}), true);
+    EXPECT_TRUE(combined.colorAtInduced(Point<unsigned>({4, 6})));
+    EXPECT_FALSE(combined.colorAtInduced(Point<unsigned>::Zero(2)));
+}
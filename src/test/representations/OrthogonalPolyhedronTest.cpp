@@ -204,6 +204,32 @@ TYPED_TEST(OrthogonalPolyhedronTest, Intersect)
 	EXPECT_EQ(expected, result);
 }
 
+TYPED_TEST(OrthogonalPolyhedronTest, ContainsPolyhedron)
+{
+	VertexContainer<TypeParam> container;
+	container.insert(Point<TypeParam>({10,10}), true);
+	container.insert(Point<TypeParam>({10,11}), false);
+	container.insert(Point<TypeParam>({11,10}), false);
+	container.insert(Point<TypeParam>({11,11}), false);
+	OrthogonalPolyhedron<TypeParam> p3(container);
+
+	OrthogonalPolyhedron<TypeParam> intersection = this->p1.intersect(this->p2);
+	OrthogonalPolyhedron<TypeParam> united = this->p1.unite(this->p2);
+
+	EXPECT_TRUE(this->p1.contains(this->p1));
+	EXPECT_TRUE(this->p1.contains(intersection));
+	EXPECT_TRUE(this->p2.contains(intersection));
+	EXPECT_FALSE(this->p1.contains(this->p2));
+	EXPECT_FALSE(this->p2.contains(this->p1));
+	EXPECT_TRUE(united.contains(this->p1));
+	EXPECT_TRUE(united.contains(this->p2));
+	EXPECT_FALSE(united.contains(p3));
+
+	// disjoint polyhedra have an empty intersection.
+	EXPECT_TRUE(this->p1.intersect(p3).empty());
+	EXPECT_TRUE(this->p1.contains(this->p1.intersect(p3)));
+}
+
 TYPED_TEST(OrthogonalPolyhedronTest, Hull)
 {
 	VertexContainer<TypeParam> container;
@@ -138,6 +138,90 @@ TYPED_TEST(SupportFunctionTest, simpleEvaluation) {
 	//EXPECT_EQ(res.supportValue, TypeParam(3));
 }
 
+TYPED_TEST(SupportFunctionTest, closedFormMultiEvaluation) {
+	matrix_t<TypeParam> directions = matrix_t<TypeParam>(3,2);
+	directions << 1,0,3,4,0,-3;
+
+	BallSupportFunction<TypeParam> ball(TypeParam(3), SF_TYPE::TWO_BALL);
+	vector_t<TypeParam> values = ball.multiEvaluateSupportValues(directions);
+	EXPECT_TRUE(carl::AlmostEqual2sComplement(TypeParam(3), values(0), 4));
+	EXPECT_TRUE(carl::AlmostEqual2sComplement(TypeParam(15), values(1), 4));
+	EXPECT_TRUE(carl::AlmostEqual2sComplement(TypeParam(9), values(2), 4));
+
+	BallSupportFunction<TypeParam> box(TypeParam(3), SF_TYPE::INFTY_BALL);
+	values = box.multiEvaluateSupportValues(directions);
+	EXPECT_EQ(TypeParam(3), values(0));
+	EXPECT_EQ(TypeParam(21), values(1));
+	EXPECT_EQ(TypeParam(9), values(2));
+	std::vector<EvaluationResult<TypeParam>> results = box.multiEvaluate(directions);
+	for(unsigned rowIndex = 0; rowIndex < directions.rows(); ++rowIndex) {
+		EXPECT_EQ(values(rowIndex), results[rowIndex].supportValue);
+		EXPECT_EQ(values(rowIndex), results[rowIndex].optimumValue.dot(vector_t<TypeParam>(directions.row(rowIndex))));
+	}
+
+	matrix_t<TypeParam> shape = matrix_t<TypeParam>::Zero(2,2);
+	shape << 4,0,0,1;
+	EllipsoidSupportFunction<TypeParam> ellipsoid(shape);
+	values = ellipsoid.multiEvaluateSupportValues(directions);
+	EXPECT_TRUE(carl::AlmostEqual2sComplement(TypeParam(2), values(0), 4));
+	EXPECT_TRUE(carl::AlmostEqual2sComplement(TypeParam(3), values(2), 4));
+	// support values must not under-approximate for exact number types.
+	if(!std::is_same<TypeParam,double>::value) {
+		EXPECT_TRUE(values(1) * values(1) >= TypeParam(52));
+	}
+	results = ellipsoid.multiEvaluate(directions, false);
+	for(unsigned rowIndex = 0; rowIndex < directions.rows(); ++rowIndex) {
+		EXPECT_EQ(values(rowIndex), results[rowIndex].supportValue);
+		EXPECT_EQ(0, results[rowIndex].optimumValue.rows());
+	}
+	// optimum points lie on the boundary of the (non-spherical) ellipsoid.
+	results = ellipsoid.multiEvaluate(directions);
+	EXPECT_EQ(vector_t<TypeParam>(Point<TypeParam>({2,0}).rawCoordinates()), results[0].optimumValue);
+	EXPECT_EQ(vector_t<TypeParam>(Point<TypeParam>({0,-1}).rawCoordinates()), results[2].optimumValue);
+}
+
+TYPED_TEST(SupportFunctionTest, boxAndZonotopeLeaves) {
+	matrix_t<TypeParam> directions = matrix_t<TypeParam>(3,2);
+	directions << 1,0,3,4,0,-3;
+
+	Box<TypeParam> box(std::make_pair(Point<TypeParam>({-1,0}), Point<TypeParam>({2,3})));
+	SupportFunction<TypeParam> boxSF = Converter<TypeParam>::toSupportFunction(box);
+	EXPECT_EQ(SF_TYPE::BOX, boxSF.sfType());
+	std::vector<EvaluationResult<TypeParam>> boxResults = boxSF.multiEvaluate(directions);
+	EXPECT_EQ(TypeParam(2), boxResults[0].supportValue);
+	EXPECT_EQ(TypeParam(18), boxResults[1].supportValue);
+	EXPECT_EQ(TypeParam(0), boxResults[2].supportValue);
+	for(unsigned rowIndex = 0; rowIndex < directions.rows(); ++rowIndex) {
+		EXPECT_EQ(boxResults[rowIndex].supportValue, boxResults[rowIndex].optimumValue.dot(vector_t<TypeParam>(directions.row(rowIndex))));
+	}
+	EXPECT_TRUE(boxSF.contains(Point<TypeParam>({2,0})));
+	EXPECT_FALSE(boxSF.contains(Point<TypeParam>({2,4})));
+
+	vector_t<TypeParam> center = vector_t<TypeParam>(2);
+	center << 1,0;
+	matrix_t<TypeParam> generators = matrix_t<TypeParam>(2,2);
+	generators << 1,1,
+	              0,1;
+	Zonotope<TypeParam> zonotope(center, generators);
+	SupportFunction<TypeParam> zonotopeSF = Converter<TypeParam>::toSupportFunction(zonotope);
+	EXPECT_EQ(SF_TYPE::ZONOTOPE, zonotopeSF.sfType());
+	std::vector<EvaluationResult<TypeParam>> zonotopeResults = zonotopeSF.multiEvaluate(directions);
+	EXPECT_EQ(TypeParam(3), zonotopeResults[0].supportValue);
+	EXPECT_EQ(TypeParam(13), zonotopeResults[1].supportValue);
+	EXPECT_EQ(TypeParam(3), zonotopeResults[2].supportValue);
+	for(unsigned rowIndex = 0; rowIndex < directions.rows(); ++rowIndex) {
+		EXPECT_EQ(zonotopeResults[rowIndex].supportValue, zonotopeResults[rowIndex].optimumValue.dot(vector_t<TypeParam>(directions.row(rowIndex))));
+	}
+	EXPECT_TRUE(zonotopeSF.contains(Point<TypeParam>({2,1})));
+	EXPECT_FALSE(zonotopeSF.contains(Point<TypeParam>({3,-1})));
+
+	// both leaves are evaluated in closed form within composed trees.
+	std::vector<EvaluationResult<TypeParam>> sumResults = boxSF.minkowskiSum(zonotopeSF).multiEvaluate(directions, true, false);
+	for(unsigned rowIndex = 0; rowIndex < directions.rows(); ++rowIndex) {
+		EXPECT_EQ(boxResults[rowIndex].supportValue + zonotopeResults[rowIndex].supportValue, sumResults[rowIndex].supportValue);
+	}
+}
+
 TYPED_TEST(SupportFunctionTest, Supremum) {
 	SupportFunction<TypeParam> psf1 = SupportFunction<TypeParam>(this->constraints, this->constants);
 	TypeParam supremum = psf1.supremum();
@@ -164,6 +248,57 @@ TYPED_TEST(SupportFunctionTest, Supremum) {
 	EXPECT_EQ(ball.supremumPoint().rawCoordinates(), expectedPointCoordinates);
 }
 
+TYPED_TEST(SupportFunctionTest, multiEvaluate) {
+	// enough directions to trigger chunked evaluation when multithreading is enabled.
+	std::vector<vector_t<TypeParam>> directions = computeTemplate<TypeParam>(2, 64);
+	matrix_t<TypeParam> directionMatrix = matrix_t<TypeParam>(directions.size(), 2);
+	for(unsigned rowIndex = 0; rowIndex < directions.size(); ++rowIndex) {
+		directionMatrix.row(rowIndex) = directions[rowIndex];
+	}
+
+	std::vector<EvaluationResult<TypeParam>> results = this->sfChainComplete.multiEvaluate(directionMatrix);
+	EXPECT_EQ(directions.size(), results.size());
+	for(unsigned rowIndex = 0; rowIndex < directions.size(); ++rowIndex) {
+		EvaluationResult<TypeParam> single = this->sfChainComplete.evaluate(directions[rowIndex]);
+		EXPECT_EQ(single.errorCode, results[rowIndex].errorCode);
+		EXPECT_TRUE(carl::AlmostEqual2sComplement(single.supportValue, results[rowIndex].supportValue, 4));
+	}
+
+	// value-only evaluation propagates transformed directions and does not return optimum points.
+	std::vector<EvaluationResult<TypeParam>> values = this->sfChainComplete.multiEvaluate(directionMatrix, true, false);
+	EXPECT_EQ(directions.size(), values.size());
+	for(unsigned rowIndex = 0; rowIndex < directions.size(); ++rowIndex) {
+		EXPECT_EQ(results[rowIndex].errorCode, values[rowIndex].errorCode);
+		EXPECT_EQ(0, values[rowIndex].optimumValue.rows());
+		EXPECT_TRUE(carl::AlmostEqual2sComplement(results[rowIndex].supportValue, values[rowIndex].supportValue, 4));
+	}
+}
+
+#ifdef HYPRO_USE_MULTITHREADING
+TYPED_TEST(SupportFunctionTest, multiEvaluateInWorker) {
+	std::vector<vector_t<TypeParam>> directions = computeTemplate<TypeParam>(2, 64);
+	matrix_t<TypeParam> directionMatrix = matrix_t<TypeParam>(directions.size(), 2);
+	for(unsigned rowIndex = 0; rowIndex < directions.size(); ++rowIndex) {
+		directionMatrix.row(rowIndex) = directions[rowIndex];
+	}
+
+	// evaluations issued from a worker thread are not split again and must not block the pool.
+	std::vector<EvaluationResult<TypeParam>> parallel = this->sfChainComplete.multiEvaluate(directionMatrix);
+	const SupportFunction<TypeParam>& sf = this->sfChainComplete;
+	std::vector<EvaluationResult<TypeParam>> sequential = ThreadPool::getInstance().enqueue([&sf, &directionMatrix](){
+		EXPECT_TRUE(ThreadPool::isWorkerThread());
+		return sf.multiEvaluate(directionMatrix);
+	}).get();
+	EXPECT_FALSE(ThreadPool::isWorkerThread());
+
+	EXPECT_EQ(directions.size(), parallel.size());
+	EXPECT_EQ(directions.size(), sequential.size());
+	for(unsigned rowIndex = 0; rowIndex < directions.size(); ++rowIndex) {
+		EXPECT_EQ(sequential[rowIndex].errorCode, parallel[rowIndex].errorCode);
+		EXPECT_TRUE(carl::AlmostEqual2sComplement(sequential[rowIndex].supportValue, parallel[rowIndex].supportValue, 4));
+	}
+}
+#endif
 
 TYPED_TEST(SupportFunctionTest, linearTransformation) {
 	SupportFunction<TypeParam> psf1 = SupportFunction<TypeParam>(this->constraints, this->constants);
@@ -184,6 +319,81 @@ TYPED_TEST(SupportFunctionTest, linearTransformation) {
 	EXPECT_TRUE(carl::AlmostEqual2sComplement(TypeParam(17), res.evaluate(v3Rot).supportValue) || TypeParam(17) <= res.evaluate(v3Rot).supportValue);
 }
 
+TYPED_TEST(SupportFunctionTest, composedTransformations) {
+	SupportFunction<TypeParam> psf1 = SupportFunction<TypeParam>(this->constraints, this->constants);
+	matrix_t<TypeParam> rotation = matrix_t<TypeParam>(2,2);
+	rotation << 0,1,-1,0;
+	matrix_t<TypeParam> stretch = matrix_t<TypeParam>(2,2);
+	stretch << 2,0,0,1;
+	vector_t<TypeParam> translation = vector_t<TypeParam>(2);
+	translation << 1,-1;
+
+	// successive different transformations are composed into a single node.
+	SupportFunction<TypeParam> res = psf1.affineTransformation(rotation, translation).affineTransformation(stretch, translation);
+	EXPECT_EQ(psf1.depth()+1, res.depth());
+
+	SupportFunction<TypeParam> expected = psf1.affineTransformation(stretch*rotation, stretch*translation + translation);
+	EXPECT_EQ(expected.evaluate(this->vec1).supportValue, res.evaluate(this->vec1).supportValue);
+	EXPECT_EQ(expected.evaluate(this->vec2).supportValue, res.evaluate(this->vec2).supportValue);
+	EXPECT_EQ(expected.evaluate(this->vec3).supportValue, res.evaluate(this->vec3).supportValue);
+}
+
+TYPED_TEST(SupportFunctionTest, repeatedTransformationsAfterComposition) {
+	SupportFunction<TypeParam> psf1 = SupportFunction<TypeParam>(this->constraints, this->constants);
+	matrix_t<TypeParam> rotation = matrix_t<TypeParam>(2,2);
+	rotation << 0,1,-1,0;
+	matrix_t<TypeParam> stretch = matrix_t<TypeParam>(2,2);
+	stretch << 2,0,0,1;
+	vector_t<TypeParam> translation = vector_t<TypeParam>(2);
+	translation << 1,-1;
+
+	SupportFunction<TypeParam> composed = psf1.affineTransformation(rotation, translation).affineTransformation(stretch, translation);
+	EXPECT_EQ(psf1.depth()+1, composed.depth());
+
+	// further steps are stacked on the composed root instead of being folded into it ...
+	SupportFunction<TypeParam> res = composed.affineTransformation(stretch, translation);
+	EXPECT_EQ(composed.depth()+1, res.depth());
+	res = res.affineTransformation(stretch, translation).affineTransformation(stretch, translation);
+	EXPECT_EQ(composed.depth()+3, res.depth());
+	// ... such that four identical steps are reduced to a single node.
+	res = res.affineTransformation(stretch, translation);
+	EXPECT_EQ(composed.depth()+1, res.depth());
+
+	matrix_t<TypeParam> power = stretch*stretch*stretch*stretch;
+	vector_t<TypeParam> accumulated = translation;
+	for(unsigned step = 1; step < 4; ++step) {
+		accumulated = stretch*accumulated + translation;
+	}
+	SupportFunction<TypeParam> reference = composed.affineTransformation(power, accumulated);
+	EXPECT_EQ(reference.evaluate(this->vec1).supportValue, res.evaluate(this->vec1).supportValue);
+	EXPECT_EQ(reference.evaluate(this->vec2).supportValue, res.evaluate(this->vec2).supportValue);
+	EXPECT_EQ(reference.evaluate(this->vec3).supportValue, res.evaluate(this->vec3).supportValue);
+}
+
+TYPED_TEST(SupportFunctionTest, transformationPowerTable) {
+	matrix_t<TypeParam> A = matrix_t<TypeParam>(2,2);
+	A << 1,1,0,1;
+	vector_t<TypeParam> b = vector_t<TypeParam>(2);
+	b << 1,0;
+	lintrafoParameters<TypeParam> parameters(A,b);
+	parameters.precompute(16);
+	EXPECT_EQ(std::size_t(3), parameters.parameters.size());
+
+	matrix_t<TypeParam> power = A;
+	vector_t<TypeParam> accumulated = b;
+	for(unsigned exponent = 2; exponent <= 16; ++exponent) {
+		power = A*power;
+		accumulated = A*accumulated + b;
+		if(exponent == 4 || exponent == 16) {
+			EXPECT_EQ(power, parameters.getParameterSet(exponent).first);
+			EXPECT_EQ(accumulated, parameters.getParameterSet(exponent).second);
+			EXPECT_EQ(matrix_t<TypeParam>(power.transpose()), parameters.getTransposedMatrix(exponent));
+		}
+	}
+	// lookups do not extend an already computed table.
+	EXPECT_EQ(std::size_t(3), parameters.parameters.size());
+}
+
 TYPED_TEST(SupportFunctionTest, scale) {
 	SupportFunction<TypeParam> psf1 = SupportFunction<TypeParam>(this->constraints, this->constants);
 	TypeParam factor = 2;
@@ -362,6 +362,123 @@ TYPED_TEST(TaylorModelTest, Picard_Operation)
 	std::cout << tmvResult << std::endl;
 }
 
+TYPED_TEST(TaylorModelTest, DenseArithmetic)
+{
+	carl::Variable x0 = this->vpool.newCarlVariable("x0");
+	carl::Variable y0 = this->vpool.newCarlVariable("y0");
+
+	carl::Interval<TypeParam> unit(-1,1);
+	Domain<TypeParam> domain;
+	domain.assign(x0, unit);
+	domain.assign(y0, unit);
+
+	// 1, x0, y0, x0^2, x0*y0, y0^2
+	std::shared_ptr<const DenseTaylorModelBasis<TypeParam>> basis = DenseTaylorModelBasis<TypeParam>::get({x0, y0}, 2);
+	EXPECT_EQ(std::size_t(6), basis->size());
+	EXPECT_EQ(basis, DenseTaylorModelBasis<TypeParam>::get({y0, x0}, 2));
+	EXPECT_EQ(std::size_t(3), basis->degreeEnd(1));
+	// the 9 monomials of degree 3 and 4 follow the basis, they are ranked but not stored
+	EXPECT_EQ(std::size_t(15), basis->productEnd());
+
+	// indices and products are computed from the exponents
+	for(std::size_t i = 0; i < basis->size(); ++i) {
+		std::size_t index = basis->size();
+		EXPECT_TRUE(basis->index(basis->exponents(i), index));
+		EXPECT_EQ(i, index);
+		for(std::size_t j = 0; j < basis->size(); ++j) {
+			std::vector<exponent> sum = {exponent(basis->exponents(i)[0] + basis->exponents(j)[0]), exponent(basis->exponents(i)[1] + basis->exponents(j)[1])};
+			if(basis->degree(i) + basis->degree(j) <= basis->order()) {
+				EXPECT_TRUE(basis->index(sum, index));
+				EXPECT_EQ(index, basis->product(i, j));
+			} else {
+				EXPECT_FALSE(basis->index(sum, index));
+				EXPECT_LE(basis->size(), basis->product(i, j));
+				EXPECT_GT(basis->productEnd(), basis->product(i, j));
+			}
+		}
+	}
+
+	typename DenseTaylorModelBasis<TypeParam>::Ranges ranges = basis->evaluate(domain);
+
+	TaylorModel<TypeParam> tm_1({Term<carl::Interval<TypeParam>>(1), (carl::Interval<TypeParam>)1*x0});
+	TaylorModel<TypeParam> tm_2({(carl::Interval<TypeParam>)1*x0*y0});
+
+	DenseTaylorModel<TypeParam> dense_1(basis, tm_1, ranges);
+	DenseTaylorModel<TypeParam> dense_2(basis, tm_2, ranges);
+
+	// (1 + x0) * x0*y0 = x0*y0 + x0^2*y0, the truncated term is bounded by [0,1]*[-1,1].
+	DenseTaylorModel<TypeParam> product = dense_1.multiply(dense_2, ranges);
+	std::size_t i = 0;
+	EXPECT_TRUE(basis->index({1,1}, i));
+	EXPECT_EQ(carl::Interval<TypeParam>(1), product.coefficient(i));
+	EXPECT_EQ(unit, product.remainder());
+	EXPECT_EQ(carl::Interval<TypeParam>(-2,2), product.enclosure(ranges));
+
+	carl::Interval<TypeParam> I;
+	product.toTaylorModel().poly_enclosure(I, domain);
+	EXPECT_EQ(unit, I);
+}
+
+TYPED_TEST(TaylorModelTest, DensePicard)
+{
+	// a cyclic linear ODE with enough components to be processed in parallel
+	std::vector<carl::Variable> x, x0;
+	for(unsigned i = 0; i < 6; ++i) {
+		x.push_back(this->vpool.newCarlVariable("x" + std::to_string(i)));
+		x0.push_back(this->vpool.newCarlVariable("x0_" + std::to_string(i)));
+	}
+	carl::Variable t = this->vpool.newCarlVariable("t");
+
+	Domain<TypeParam> domain;
+	PolynomialODE<TypeParam> ode;
+	TaylorModelVec<TypeParam> tmv0;
+	for(unsigned i = 0; i < x.size(); ++i) {
+		domain.assign(x0[i], carl::Interval<TypeParam>(-1,1));
+		ode.assign(x[i], MultivariatePolynomial<carl::Interval<TypeParam>>({(carl::Interval<TypeParam>)1*x[(i+1) % x.size()]}));
+		tmv0.assign(x[i], TaylorModel<TypeParam>({(carl::Interval<TypeParam>)1*x0[i]}));
+	}
+	carl::Interval<TypeParam> range_of_t(0,0.5);
+	domain.assign(t, range_of_t);
+
+	// x_i = x0_i + x0_{i+1}*t
+	TaylorModelVec<TypeParam> tmvResult = tmv0.Picard(tmv0, ode, domain, t, range_of_t, 2);
+	ASSERT_EQ(x.size(), tmvResult.tms.size());
+	for(unsigned i = 0; i < x.size(); ++i) {
+		const TaylorModel<TypeParam>& tm = tmvResult.tms.at(x[i]);
+		carl::Interval<TypeParam> I;
+		tm.poly_enclosure(I, domain);
+		EXPECT_EQ(carl::Interval<TypeParam>(-1.5,1.5), I);
+		// no terms are truncated
+		tm.enclosure(I, domain);
+		EXPECT_EQ(carl::Interval<TypeParam>(-1.5,1.5), I);
+	}
+}
+
+TYPED_TEST(TaylorModelTest, HornerEnclosure)
+{
+	carl::Variable x0 = this->vpool.newCarlVariable("x0");
+	carl::Variable t = this->vpool.newCarlVariable("t");
+
+	Domain<TypeParam> domain;
+	domain.assign(x0, carl::Interval<TypeParam>(-1,1));
+	domain.assign(t, carl::Interval<TypeParam>(0,1));
+
+	EXPECT_EQ(carl::Interval<TypeParam>(0,1), domain.power(x0, 2));
+	EXPECT_EQ(carl::Interval<TypeParam>(-1,1), domain.power(x0, 3));
+
+	// x0^2 + t - t^2 = x0^2 + t*(1 - t)
+	TaylorModel<TypeParam> tm({(carl::Interval<TypeParam>)1*x0*x0, (carl::Interval<TypeParam>)1*t, (carl::Interval<TypeParam>)(-1)*t*t});
+	carl::Interval<TypeParam> I;
+	tm.poly_enclosure(I, domain);
+	EXPECT_EQ(carl::Interval<TypeParam>(0,2), I);
+
+	// reassigning t drops its cached powers
+	domain.assign(t, carl::Interval<TypeParam>(0,2));
+	EXPECT_EQ(carl::Interval<TypeParam>(0,4), domain.power(t, 2));
+	tm.poly_enclosure(I, domain);
+	EXPECT_EQ(carl::Interval<TypeParam>(-2,3), I);
+}
+
 /*
 TYPED_TEST(TaylorModelTest, Brusselator)
 {
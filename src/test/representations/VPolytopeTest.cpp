@@ -261,6 +261,46 @@ TYPED_TEST(VPolytopeTest, MinkowskiSum)
 	}
 }
 
+TYPED_TEST(VPolytopeTest, RemoveRedundancy)
+{
+	VPolytope<TypeParam> vpt1 = VPolytope<TypeParam>(this->points1);
+	VPolytope<TypeParam> vpt2 = VPolytope<TypeParam>(this->points2);
+	VPolytope<TypeParam> sum = vpt1.minkowskiSum(vpt2);
+	sum.removeRedundancy();
+	EXPECT_EQ(sum.size(), unsigned(4));
+	EXPECT_TRUE(sum.hasVertex(Point<TypeParam>({3,3})));
+	EXPECT_TRUE(sum.hasVertex(Point<TypeParam>({7,3})));
+	EXPECT_TRUE(sum.hasVertex(Point<TypeParam>({7,7})));
+	EXPECT_TRUE(sum.hasVertex(Point<TypeParam>({3,7})));
+
+	// points on edges, in the interior and duplicates are removed, vertices are kept.
+	typename VPolytope<TypeParam>::pointVector points = this->points1;
+	points.push_back(Point<TypeParam>({2,2}));
+	points.push_back(Point<TypeParam>({2,3}));
+	points.push_back(Point<TypeParam>({TypeParam(5)/TypeParam(2),TypeParam(7)/TypeParam(2)}));
+	points.push_back(Point<TypeParam>({3,3}));
+	points.push_back(this->points1.front());
+	points.push_back(Point<TypeParam>({4,3}));
+	VPolytope<TypeParam> vpt3;
+	for(const auto& point : points) {
+		vpt3.insert(point);
+	}
+	vpt3.setNeighbors(this->points1[0], {this->points1[1], this->points1[3], Point<TypeParam>({3,3})});
+	vpt3.removeRedundancy();
+	EXPECT_EQ(vpt3.size(), unsigned(5));
+	// neighbors among the remaining vertices are kept.
+	std::vector<Point<TypeParam>> neighbors = vpt3.neighbors(this->points1[0]);
+	EXPECT_EQ(std::size_t(2), neighbors.size());
+	EXPECT_TRUE(std::find(neighbors.begin(), neighbors.end(), this->points1[1]) != neighbors.end());
+	EXPECT_TRUE(std::find(neighbors.begin(), neighbors.end(), this->points1[3]) != neighbors.end());
+	EXPECT_EQ(std::size_t(1), vpt3.neighbors(this->points1[1]).size());
+	EXPECT_TRUE(vpt3.hasVertex(Point<TypeParam>({4,3})));
+	EXPECT_FALSE(vpt3.hasVertex(Point<TypeParam>({3,3})));
+	for(const auto& point : points) {
+		EXPECT_TRUE(vpt3.contains(point));
+	}
+}
+
 TYPED_TEST(VPolytopeTest, Intersection)
 {
 	VPolytope<TypeParam> vpt1 = VPolytope<TypeParam>(this->points1);
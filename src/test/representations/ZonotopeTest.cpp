@@ -430,3 +430,64 @@ TYPED_TEST(ZonotopeTest, IntervalHull) {
     EXPECT_EQ(result.generators(), expected_generators);
     EXPECT_EQ(result.center(), center);
 }
+
+TYPED_TEST(ZonotopeTest, VertexRange) {
+	hypro::matrix_t<TypeParam> gen = hypro::matrix_t<TypeParam>(3,3);
+	gen << 2,0,1,
+	       4,0,0,
+	       0,0,3;
+	hypro::vector_t<TypeParam> center = hypro::vector_t<TypeParam>(3);
+	center << 1,2,0;
+	hypro::Zonotope<TypeParam> z(center, gen);
+
+	// the zero generator is skipped.
+	EXPECT_EQ(std::uint64_t(4), z.vertexRange().size());
+	std::vector<hypro::Point<TypeParam>> points = z.vertices();
+	EXPECT_EQ(std::size_t(4), points.size());
+	EXPECT_TRUE(std::find(points.begin(), points.end(), hypro::Point<TypeParam>({4,6,3})) != points.end());
+	EXPECT_TRUE(std::find(points.begin(), points.end(), hypro::Point<TypeParam>({-2,-2,-3})) != points.end());
+
+	// projected onto the second dimension only the first generator remains.
+	std::vector<unsigned> dims = {1};
+	std::vector<hypro::Point<TypeParam>> projected = z.vertexRange(dims).collect();
+	EXPECT_EQ(std::size_t(2), projected.size());
+	EXPECT_TRUE(std::find(projected.begin(), projected.end(), hypro::Point<TypeParam>({6})) != projected.end());
+	EXPECT_TRUE(std::find(projected.begin(), projected.end(), hypro::Point<TypeParam>({-2})) != projected.end());
+}
+
+TYPED_TEST(ZonotopeTest, SatisfiesHalfspaces) {
+	hypro::vector_t<TypeParam> center = hypro::vector_t<TypeParam>::Zero(2);
+	hypro::matrix_t<TypeParam> gen = hypro::matrix_t<TypeParam>::Identity(2,2);
+	hypro::Zonotope<TypeParam> z(center, gen);
+
+	hypro::matrix_t<TypeParam> mat = hypro::matrix_t<TypeParam>(3,2);
+	mat << 1,0,
+	       0,1,
+	       1,1;
+	std::pair<hypro::vector_t<TypeParam>,hypro::vector_t<TypeParam>> bounds = ZUtility::rowBounds(center, gen, mat);
+	EXPECT_EQ(bounds.first, hypro::vector_t<TypeParam>(-mat.rowwise().sum()));
+	EXPECT_EQ(bounds.second, hypro::vector_t<TypeParam>(mat.rowwise().sum()));
+
+	// all halfspaces are redundant.
+	hypro::vector_t<TypeParam> vec = hypro::vector_t<TypeParam>(3);
+	vec << 2,2,2;
+	std::pair<bool,hypro::Zonotope<TypeParam>> result = z.satisfiesHalfspaces(mat, vec);
+	EXPECT_TRUE(result.first);
+	EXPECT_EQ(result.second.center(), center);
+	EXPECT_EQ(result.second.generators(), gen);
+
+	// the zonotope lies outside of the second halfspace.
+	vec << 2,-2,2;
+	result = z.satisfiesHalfspaces(mat, vec);
+	EXPECT_FALSE(result.first);
+	EXPECT_TRUE(result.second.empty());
+	EXPECT_TRUE(z.intersectHalfspaces(mat, vec).empty());
+
+	// only the second halfspace cuts the zonotope.
+	vec << 2,0,2;
+	result = z.satisfiesHalfspaces(mat, vec);
+	EXPECT_TRUE(result.first);
+	EXPECT_TRUE(result.second.center() != center);
+	bounds = ZUtility::rowBounds(result.second.center(), result.second.generators(), mat);
+	EXPECT_TRUE(bounds.second(1) < TypeParam(1));
+}